@@ -0,0 +1,80 @@
+
+// Compares the throughput of set-valued logic on `bool_set_array` with a scalar loop over a vector of `set<bool>`.
+
+#include <random>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include <intervals/set.hpp>
+#include <intervals/bool_set_array.hpp>
+
+#include "benchmark.hpp"
+
+using namespace intervals;
+using namespace intervals::benchmark;
+
+
+int
+main()
+{
+    constexpr long long n = 1 << 16;
+    constexpr int repetitions = 500;
+
+    auto rng = std::mt19937_64{ 42 };
+    auto dist = std::uniform_int_distribution<unsigned>{ 1, 3 };
+
+    auto xs = std::vector<set<bool>>{ };
+    auto ys = std::vector<set<bool>>{ };
+    for (long long i = 0; i != n; ++i)
+    {
+        xs.push_back(set<bool>::from_bits(dist(rng)));
+        ys.push_back(set<bool>::from_bits(dist(rng)));
+    }
+    auto xa = bool_set_array(xs);
+    auto ya = bool_set_array(ys);
+
+    auto run = [&](char const* name, auto scalar_op, auto array_op)
+    {
+        auto rs = std::vector<set<bool>>(xs.size());
+        double scalar_ns = measure(repetitions, [&]
+        {
+            for (std::size_t i = 0; i != xs.size(); ++i)
+            {
+                rs[i].reset(scalar_op(xs[i], ys[i]));
+            }
+            do_not_optimize(rs.data());
+        });
+        double array_ns = measure(repetitions, [&]
+        {
+            auto ra = array_op(xa, ya);
+            do_not_optimize(ra.true_bits().data());
+        });
+        report(fmt::format("{} (scalar)", name), scalar_ns, n, scalar_ns);
+        report(fmt::format("{} (bool_set_array)", name), array_ns, n, scalar_ns);
+    };
+
+    run("x & y", [](auto x, auto y) { return x & y; }, [](auto const& x, auto const& y) { return x & y; });
+    run("x | !y", [](auto x, auto y) { return x | !y; }, [](auto const& x, auto const& y) { return x | !y; });
+    run("x ^ y", [](auto x, auto y) { return x ^ y; }, [](auto const& x, auto const& y) { return x ^ y; });
+
+        // Reduction: is any element contingent?
+    bool anyContingent = false;
+    double scalar_ns = measure(repetitions, [&]
+    {
+        bool result = false;
+        for (std::size_t i = 0; i != xs.size(); ++i)
+        {
+            result |= contingent(xs[i] & ys[i]);
+        }
+        anyContingent = result;
+        do_not_optimize(anyContingent);
+    });
+    double array_ns = measure(repetitions, [&]
+    {
+        anyContingent = possibly(any_of(contingent(xa & ya)));
+        do_not_optimize(anyContingent);
+    });
+    report("any contingent(x & y) (scalar)", scalar_ns, n, scalar_ns);
+    report("any contingent(x & y) (bool_set_array)", array_ns, n, scalar_ns);
+}
@@ -0,0 +1,76 @@
+
+// Compares the eager evaluation of a linear interpolation formula with its lazy evaluation through `lazy()` and `evaluate()`.
+
+#include <random>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include <intervals/interval.hpp>
+#include <intervals/rounding.hpp>
+#include <intervals/expression.hpp>
+
+#include "benchmark.hpp"
+
+using namespace intervals;
+using namespace intervals::benchmark;
+
+
+int
+main()
+{
+    constexpr long long n = 1 << 12;
+    constexpr int repetitions = 2000;
+
+    auto rng = std::mt19937_64{ 42 };
+    auto dist = std::uniform_real_distribution<double>{ -4., 4. };
+    auto xs0 = std::vector<interval<double>>{ };
+    auto ys0 = std::vector<interval<double>>{ };
+    for (long long i = 0; i != n; ++i)
+    {
+        xs0.push_back(interval<double>::from_unordered_bounds(dist(rng), dist(rng)));
+        ys0.push_back(interval<double>::from_unordered_bounds(dist(rng), dist(rng)));
+    }
+
+    auto measure_type = [&]<typename I>(I const*, auto op)
+    {
+        auto xs = std::vector<I>(xs0.begin(), xs0.end());
+        auto ys = std::vector<I>(ys0.begin(), ys0.end());
+        auto rs = std::vector<I>(xs.size());
+        return measure(repetitions, [&]
+        {
+            for (std::size_t i = 1; i != xs.size(); ++i)
+            {
+                rs[i].reset(op(xs[i], -5., -4., ys[i - 1], ys[i]));
+            }
+            do_not_optimize(rs.data());
+        });
+    };
+    auto run = [&]<typename I>(char const* name, I const* tag)
+    {
+        double eager_ns = measure_type(tag, [](auto const& x, double x0, double x1, auto const& y0, auto const& y1)
+        {
+            return y0 + (x - x0)/(x1 - x0)*(y1 - y0);
+        });
+        double lazy_ns = measure_type(tag, [](auto const& x, double x0, double x1, auto const& y0, auto const& y1)
+        {
+            return evaluate(y0 + (lazy(x) - x0)/(x1 - x0)*(y1 - y0));
+        });
+        report(fmt::format("y0 + (x - x0)/(x1 - x0)*(y1 - y0) ({})", name), eager_ns, n, eager_ns);
+        report(fmt::format("lazy ({})", name), lazy_ns, n, eager_ns);
+
+        double eager2_ns = measure_type(tag, [](auto const& x, double, double, auto const& y0, auto const& y1)
+        {
+            return (x - y0)*(x + y1) - y0*y1;
+        });
+        double lazy2_ns = measure_type(tag, [](auto const& x, double, double, auto const& y0, auto const& y1)
+        {
+            return evaluate((lazy(x) - y0)*(lazy(x) + y1) - lazy(y0)*y1);
+        });
+        report(fmt::format("(x - y0)*(x + y1) - y0*y1 ({})", name), eager2_ns, n, eager2_ns);
+        report(fmt::format("lazy ({})", name), lazy2_ns, n, eager2_ns);
+    };
+
+    run("interval<double>", (interval<double> const*) nullptr);
+    run("interval<double, error_free_rounding>", (interval<double, error_free_rounding> const*) nullptr);
+}
@@ -0,0 +1,62 @@
+
+// Compares the throughput of chains of arithmetic operations on `interval<double, finite_only>` with `interval<double>`.
+
+#include <random>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include <intervals/interval.hpp>
+#include <intervals/rounding.hpp>
+
+#include "benchmark.hpp"
+
+using namespace intervals;
+using namespace intervals::benchmark;
+
+
+int
+main()
+{
+    constexpr long long n = 1 << 12;
+    constexpr int repetitions = 2000;
+
+    auto rng = std::mt19937_64{ 42 };
+    auto dist = std::uniform_real_distribution<double>{ -4., 4. };
+    auto xs0 = std::vector<interval<double>>{ };
+    auto ys0 = std::vector<interval<double>>{ };
+    for (long long i = 0; i != n; ++i)
+    {
+        xs0.push_back(interval<double>::from_unordered_bounds(dist(rng), dist(rng)));
+        ys0.push_back(abs(interval<double>::from_unordered_bounds(dist(rng), dist(rng))) + 1.);
+    }
+
+    auto measure_policy = [&]<typename PolicyT>(PolicyT, auto op)
+    {
+        using I = interval<double, PolicyT>;
+        auto xs = std::vector<I>(xs0.begin(), xs0.end());
+        auto ys = std::vector<I>(ys0.begin(), ys0.end());
+        auto rs = std::vector<I>(xs.size());
+        return measure(repetitions, [&]
+        {
+            for (std::size_t i = 0; i != xs.size(); ++i)
+            {
+                rs[i].reset(op(xs[i], ys[i]));
+            }
+            do_not_optimize(rs.data());
+        });
+    };
+    auto run = [&](char const* name, auto op)
+    {
+        double default_ns = measure_policy(no_rounding{ }, op);
+        double finite_ns = measure_policy(finite_only{ }, op);
+        report(fmt::format("{} (no_rounding)", name), default_ns, n, default_ns);
+        report(fmt::format("{} (finite_only)", name), finite_ns, n, default_ns);
+    };
+
+    run("x + y + x + y", [](auto const& x, auto const& y) { return x + y + x + y; });
+    run("x - y - x - y", [](auto const& x, auto const& y) { return x - y - x - y; });
+    run("x*y*y*y", [](auto const& x, auto const& y) { return x*y*y*y; });
+    run("x/y/y/y", [](auto const& x, auto const& y) { return x/y/y/y; });
+    run("(x + y)*x/y - x", [](auto const& x, auto const& y) { return (x + y)*x/y - x; });
+}
@@ -0,0 +1,63 @@
+
+// Compares the cost of evaluating a polynomial with Horner's scheme using `fma()` and using the operators  *  and  + .
+
+#include <array>
+#include <random>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include <intervals/interval.hpp>
+#include <intervals/rounding.hpp>
+
+#include "benchmark.hpp"
+
+using namespace intervals;
+using namespace intervals::benchmark;
+
+
+int
+main()
+{
+    constexpr long long n = 1 << 12;
+    constexpr int repetitions = 2000;
+
+    auto rng = std::mt19937_64{ 42 };
+    auto dist = std::uniform_real_distribution<double>{ -2., 2. };
+    auto xs0 = std::vector<interval<double>>{ };
+    for (long long i = 0; i != n; ++i)
+    {
+        xs0.push_back(interval<double>::from_unordered_bounds(dist(rng), dist(rng)));
+    }
+    constexpr auto coefficients = std::array{ 0.5, -1.25, 3., 0.75, -2., 1. };
+
+    auto measure_type = [&]<typename I>(I const*, auto horner_step)
+    {
+        auto xs = std::vector<I>(xs0.begin(), xs0.end());
+        auto rs = std::vector<I>(xs.size());
+        return measure(repetitions, [&]
+        {
+            for (std::size_t i = 0; i != xs.size(); ++i)
+            {
+                auto p = I(coefficients[0]);
+                for (std::size_t j = 1; j != coefficients.size(); ++j)
+                {
+                    p.reset(horner_step(p, xs[i], coefficients[j]));
+                }
+                rs[i].reset(p);
+            }
+            do_not_optimize(rs.data());
+        });
+    };
+    auto run = [&]<typename I>(char const* name, I const* tag)
+    {
+        double op_ns = measure_type(tag, [](auto const& p, auto const& x, double c) { return p*x + c; });
+        double fma_ns = measure_type(tag, [](auto const& p, auto const& x, double c) { return fma(p, x, c); });
+        report(fmt::format("p*x + c ({})", name), op_ns, n, op_ns);
+        report(fmt::format("fma(p, x, c) ({})", name), fma_ns, n, op_ns);
+    };
+
+    run("interval<double>", (interval<double> const*) nullptr);
+    run("interval<double, error_free_rounding>", (interval<double, error_free_rounding> const*) nullptr);
+    run("interval<double, finite_only>", (interval<double, finite_only> const*) nullptr);
+}
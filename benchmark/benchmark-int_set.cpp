@@ -0,0 +1,67 @@
+
+// Compares table look-ups with a sparse set of indices represented as `int_set<>` with look-ups with the hull of the indices
+// represented as `interval<int>`.
+
+#include <cmath>   // for sin()
+#include <random>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include <intervals/int_set.hpp>
+#include <intervals/interval.hpp>
+#include <intervals/algorithm.hpp>
+
+#include "benchmark.hpp"
+
+using namespace intervals;
+using namespace intervals::benchmark;
+
+
+int
+main()
+{
+    constexpr int tableSize = 256;
+    constexpr long long n = 1 << 12;
+    constexpr int repetitions = 200;
+
+    auto rng = std::mt19937_64{ 42 };
+    auto dist = std::uniform_int_distribution<int>{ 0, tableSize - 1 };
+
+    auto table = std::vector<double>(tableSize);
+    for (int i = 0; i != tableSize; ++i)
+    {
+        table[i] = std::sin(0.1*i);
+    }
+
+        // Index sets with 3 elements each.
+    auto sets = std::vector<int_set<0, tableSize - 1>>{ };
+    auto hulls = std::vector<interval<gsl_lite::index>>{ };
+    for (long long i = 0; i != n; ++i)
+    {
+        auto s = int_set<0, tableSize - 1>{ dist(rng), dist(rng), dist(rng) };
+        hulls.push_back(interval<gsl_lite::index>{ s.lower(), s.upper() });
+        sets.push_back(s);
+    }
+
+    double hull_ns = measure(repetitions, [&]
+    {
+        double sum = 0;
+        for (auto const& h : hulls)
+        {
+            sum += at(table, h).upper();
+        }
+        do_not_optimize(sum);
+    });
+    double set_ns = measure(repetitions, [&]
+    {
+        double sum = 0;
+        for (auto const& s : sets)
+        {
+            sum += at(table, s).upper();
+        }
+        do_not_optimize(sum);
+    });
+    report("at(table, interval<index>)", hull_ns, n, hull_ns);
+    report("at(table, int_set<>)", set_ns, n, hull_ns);
+}
@@ -0,0 +1,92 @@
+
+// Compares the throughput of element-wise arithmetic and comparisons on `interval_array<>` with a scalar loop over a vector of `interval<>`.
+
+#include <random>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include <intervals/interval.hpp>
+#include <intervals/interval_array.hpp>
+
+#include "benchmark.hpp"
+
+using namespace intervals;
+using namespace intervals::benchmark;
+
+
+int
+main()
+{
+    constexpr long long n = 1 << 12;
+    constexpr int repetitions = 2000;
+
+    auto rng = std::mt19937_64{ 42 };
+    auto dist = std::uniform_real_distribution<double>{ -4., 4. };
+    auto random_interval = [&]
+    {
+        return interval<double>::from_unordered_bounds(dist(rng), dist(rng));
+    };
+
+    auto xs = std::vector<interval<double>>{ };
+    auto ys = std::vector<interval<double>>{ };
+    for (long long i = 0; i != n; ++i)
+    {
+        xs.push_back(random_interval());
+        ys.push_back(abs(random_interval()) + 1.);
+    }
+    auto xa = interval_array<double>(xs);
+    auto ya = interval_array<double>(ys);
+
+    auto run = [&](char const* name, auto scalar_op, auto array_op)
+    {
+        auto rs = std::vector<interval<double>>(xs.size());
+        double scalar_ns = measure(repetitions, [&]
+        {
+            for (std::size_t i = 0; i != xs.size(); ++i)
+            {
+                rs[i].reset(scalar_op(xs[i], ys[i]));
+            }
+            do_not_optimize(rs.data());
+        });
+        double array_ns = measure(repetitions, [&]
+        {
+            auto ra = array_op(xa, ya);
+            do_not_optimize(ra.lower().data());
+        });
+        report(fmt::format("{} (scalar)", name), scalar_ns, n, scalar_ns);
+        report(fmt::format("{} (interval_array)", name), array_ns, n, scalar_ns);
+    };
+
+    run("x + y", [](auto const& x, auto const& y) { return x + y; }, [](auto const& x, auto const& y) { return x + y; });
+    run("x - y", [](auto const& x, auto const& y) { return x - y; }, [](auto const& x, auto const& y) { return x - y; });
+    run("x*y", [](auto const& x, auto const& y) { return x*y; }, [](auto const& x, auto const& y) { return x*y; });
+    run("x/y", [](auto const& x, auto const& y) { return x/y; }, [](auto const& x, auto const& y) { return x/y; });
+    run("min(x, y)", [](auto const& x, auto const& y) { return min(x, y); }, [](auto const& x, auto const& y) { return min(x, y); });
+    run("square(x)", [](auto const& x, auto const&) { return square(x); }, [](auto const& x, auto const&) { return square(x); });
+    run("abs(x)", [](auto const& x, auto const&) { return abs(x); }, [](auto const& x, auto const&) { return abs(x); });
+    run("sqrt(y)", [](auto const&, auto const& y) { return sqrt(y); }, [](auto const&, auto const& y) { return sqrt(y); });
+    run("exp(x)", [](auto const& x, auto const&) { return exp(x); }, [](auto const& x, auto const&) { return exp(x); });
+    run("log(y)", [](auto const&, auto const& y) { return log(y); }, [](auto const&, auto const& y) { return log(y); });
+    run("sin(x)", [](auto const& x, auto const&) { return sin(x); }, [](auto const& x, auto const&) { return sin(x); });
+    run("cos(x)", [](auto const& x, auto const&) { return cos(x); }, [](auto const& x, auto const&) { return cos(x); });
+    run("atan(x)", [](auto const& x, auto const&) { return atan(x); }, [](auto const& x, auto const&) { return atan(x); });
+    run("if_else(x < y, x, y)", [](auto const& x, auto const& y) { return if_else(x < y, x, y); }, [](auto const& x, auto const& y) { return if_else(x < y, x, y); });
+
+    auto cs = std::vector<set<bool>>(xs.size());
+    double scalar_ns = measure(repetitions, [&]
+    {
+        for (std::size_t i = 0; i != xs.size(); ++i)
+        {
+            cs[i].reset(xs[i] < ys[i]);
+        }
+        do_not_optimize(cs.data());
+    });
+    double array_ns = measure(repetitions, [&]
+    {
+        auto ca = xa < ya;
+        do_not_optimize(ca.true_bits().data());
+    });
+    report("x < y (scalar)", scalar_ns, n, scalar_ns);
+    report("x < y (interval_array)", array_ns, n, scalar_ns);
+}
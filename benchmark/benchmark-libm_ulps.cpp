@@ -0,0 +1,165 @@
+
+// Calibrates the error bounds in `libm_ulp_bounds` against the standard library of the build machine: the largest error
+// of every elementary function is estimated for random arguments by comparison with a `long double` reference, and the
+// program fails if an observed error exceeds the tabulated bound. Also measures the cost of padding the bounds.
+//
+// The reference is only meaningful if `long double` has more precision than the type checked; `float` is always
+// checked against `double`.
+
+#include <cmath>
+#include <tuple>
+#include <limits>
+#include <random>
+#include <vector>
+#include <algorithm>    // for max()
+#include <string_view>
+#include <type_traits>  // for conditional_t<>, type_identity<>
+
+#include <fmt/core.h>
+
+#include <intervals/interval.hpp>
+#include <intervals/rounding.hpp>
+
+#include "benchmark.hpp"
+
+using namespace intervals;
+using namespace intervals::benchmark;
+
+
+namespace {
+
+
+    // Return the error of  y  in units of the last place of the exact result  ref  of type  T .
+template <typename T, typename R>
+double
+ulp_error(T y, R ref)
+{
+    if (ref == 0)
+    {
+        return y == 0 ? 0. : double(std::numeric_limits<int>::max());
+    }
+    int e = std::max(std::ilogb(ref), std::numeric_limits<T>::min_exponent - 1);
+    R ulp = std::ldexp(R(1), e - (std::numeric_limits<T>::digits - 1));
+    return double(std::abs(R(y) - ref)/ulp);
+}
+
+template <typename T>
+using reference_t = std::conditional_t<std::is_same_v<T, float>, double, long double>;
+
+bool failed = false;
+
+template <typename T, typename F, typename RF, typename DistT>
+void
+calibrate(std::string_view name, int bound, F f, RF rf, DistT dist)
+{
+    auto rng = std::mt19937_64{ 42 };
+    double max_err = 0;
+    for (int i = 0; i != 1 << 20; ++i)
+    {
+        auto args = dist(rng);
+        double err = ulp_error(std::apply(f, args), std::apply(rf, args));
+        max_err = std::max(max_err, err);
+    }
+    bool ok = max_err <= bound;
+    failed |= !ok;
+    fmt::print("{:<8} {:>10.4f} ulp   bound {} ulp   {}\n", name, max_err, bound, ok ? "ok" : "EXCEEDED");
+}
+
+template <typename T, typename BoundsT = libm_ulp_bounds>
+void
+calibrate_all(std::string_view label)
+{
+    using R = reference_t<T>;
+
+    fmt::print("{}\n", label);
+    auto uniform = [](T lo, T hi)
+    {
+        return [dist = std::uniform_real_distribution<T>{ lo, hi }](std::mt19937_64& rng) mutable
+        {
+            return std::tuple{ dist(rng) };
+        };
+    };
+    auto log_uniform = [](int emin, int emax)
+    {
+        return [dm = std::uniform_real_distribution<T>{ 1, 2 }, de = std::uniform_int_distribution<int>{ emin, emax }](std::mt19937_64& rng) mutable
+        {
+            return std::tuple{ std::ldexp(dm(rng), de(rng)) };
+        };
+    };
+    auto atan2_args = [](std::mt19937_64& rng)
+    {
+        auto dist = std::uniform_real_distribution<T>{ -10, 10 };
+        return std::tuple{ dist(rng), dist(rng) };
+    };
+
+    T log_max = std::log(std::numeric_limits<T>::max());
+    calibrate<T>("exp", BoundsT::exp, [](T x) { return std::exp(x); }, [](R x) { return std::exp(x); }, uniform(-log_max, log_max));
+    calibrate<T>("log", BoundsT::log, [](T x) { return std::log(x); }, [](R x) { return std::log(x); }, log_uniform(-100, 100));
+    auto pow_args = [](std::mt19937_64& rng)
+    {
+        auto dx = std::uniform_real_distribution<T>{ T(0.5), 2 };
+        auto dy = std::uniform_real_distribution<T>{ -50, 50 };
+        return std::tuple{ dx(rng), dy(rng) };
+    };
+    calibrate<T>("pow", BoundsT::pow, [](T x, T y) { return std::pow(x, y); }, [](R x, R y) { return std::pow(x, y); }, pow_args);
+    calibrate<T>("cbrt", BoundsT::cbrt, [](T x) { return std::cbrt(x); }, [](R x) { return std::cbrt(x); }, log_uniform(-100, 100));
+    calibrate<T>("sin", BoundsT::sin, [](T x) { return std::sin(x); }, [](R x) { return std::sin(x); }, uniform(-10, 10));
+    calibrate<T>("cos", BoundsT::cos, [](T x) { return std::cos(x); }, [](R x) { return std::cos(x); }, uniform(-10, 10));
+    calibrate<T>("tan", BoundsT::tan, [](T x) { return std::tan(x); }, [](R x) { return std::tan(x); }, uniform(-10, 10));
+    calibrate<T>("asin", BoundsT::asin, [](T x) { return std::asin(x); }, [](R x) { return std::asin(x); }, uniform(-1, 1));
+    calibrate<T>("acos", BoundsT::acos, [](T x) { return std::acos(x); }, [](R x) { return std::acos(x); }, uniform(-1, 1));
+    calibrate<T>("atan", BoundsT::atan, [](T x) { return std::atan(x); }, [](R x) { return std::atan(x); }, uniform(-100, 100));
+    calibrate<T>("atan2", BoundsT::atan2, [](T y, T x) { return std::atan2(y, x); }, [](R y, R x) { return std::atan2(y, x); }, atan2_args);
+}
+
+
+} // anonymous namespace
+
+
+int
+main()
+{
+    if constexpr (std::numeric_limits<long double>::digits > std::numeric_limits<double>::digits)
+    {
+        calibrate_all<double>("double");
+    }
+    else
+    {
+        fmt::print("double: skipped, long double has no extra precision\n");
+    }
+    calibrate_all<float>("float");
+
+    constexpr long long n = 1 << 12;
+    constexpr int repetitions = 2000;
+
+    auto rng = std::mt19937_64{ 42 };
+    auto dist = std::uniform_real_distribution<double>{ -10., 10. };
+    auto xs = std::vector<double>(n);
+    for (auto& x : xs)
+    {
+        x = dist(rng);
+    }
+    auto measure_op = [&]<typename I>(std::type_identity<I>, auto op)
+    {
+        auto rs = std::vector<I>(n);
+        return measure(repetitions, [&]
+        {
+            for (long long i = 0; i != n; ++i)
+            {
+                rs[i].reset(op(I{ xs[i], xs[i] + 1 }));
+            }
+            do_not_optimize(rs.data());
+        });
+    };
+    using I0 = interval<double, error_free_rounding>;
+    using I1 = interval<double, libm_error_padding<error_free_rounding>>;
+    fmt::print("\ncost of padding\n");
+    double exp_ns = measure_op(std::type_identity<I0>{ }, [](auto const& x) { return exp(x); });
+    report("exp(x)", exp_ns, n, exp_ns);
+    report("exp(x), padded", measure_op(std::type_identity<I1>{ }, [](auto const& x) { return exp(x); }), n, exp_ns);
+    double sin_ns = measure_op(std::type_identity<I0>{ }, [](auto const& x) { return sin(x); });
+    report("sin(x)", sin_ns, n, sin_ns);
+    report("sin(x), padded", measure_op(std::type_identity<I1>{ }, [](auto const& x) { return sin(x); }), n, sin_ns);
+
+    return failed ? 1 : 0;
+}
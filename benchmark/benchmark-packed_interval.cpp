@@ -0,0 +1,77 @@
+
+// Compares the throughput of arithmetic on `packed_interval<>` with `interval<double>` for both supported rounding policies.
+// Must be compiled with `-frounding-math` (GCC, Clang) or `/fp:strict` (MSVC) for `upward_rounding` to be correct.
+
+#include <random>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include <intervals/interval.hpp>
+#include <intervals/rounding.hpp>
+#include <intervals/packed_interval.hpp>
+
+#include "benchmark.hpp"
+
+using namespace intervals;
+using namespace intervals::benchmark;
+
+
+int
+main()
+{
+    constexpr long long n = 1 << 12;
+    constexpr int repetitions = 2000;
+
+    auto rng = std::mt19937_64{ 42 };
+    auto dist = std::uniform_real_distribution<double>{ -4., 4. };
+    auto xs0 = std::vector<interval<double>>{ };
+    auto ys0 = std::vector<interval<double>>{ };
+    for (long long i = 0; i != n; ++i)
+    {
+        xs0.push_back(interval<double>::from_unordered_bounds(dist(rng), dist(rng)));
+        ys0.push_back(abs(interval<double>::from_unordered_bounds(dist(rng), dist(rng))) + 1.);
+    }
+
+    auto measure_type = [&]<typename I>(I const*, auto op)
+    {
+        auto xs = std::vector<I>{ };
+        auto ys = std::vector<I>{ };
+        for (long long i = 0; i != n; ++i)
+        {
+            xs.push_back(I(typename I::interval_type(xs0[i])));
+            ys.push_back(I(typename I::interval_type(ys0[i])));
+        }
+        auto rs = std::vector<I>(xs.size());
+        return measure(repetitions, [&]
+        {
+            for (std::size_t i = 0; i != xs.size(); ++i)
+            {
+                rs[i].reset(op(xs[i], ys[i]));
+            }
+            do_not_optimize(rs.data());
+        });
+    };
+    auto run = [&](char const* name, auto op)
+    {
+        double interval_ns = measure_type((interval<double> const*) nullptr, op);
+        double packed_ns = measure_type((packed_interval<> const*) nullptr, op);
+        double interval_upward_ns;
+        double packed_upward_ns;
+        {
+            auto guard = upward_rounding_guard{ };
+            interval_upward_ns = measure_type((interval<double, upward_rounding> const*) nullptr, op);
+            packed_upward_ns = measure_type((packed_interval<upward_rounding> const*) nullptr, op);
+        }
+        report(fmt::format("{} (interval)", name), interval_ns, n, interval_ns);
+        report(fmt::format("{} (packed_interval)", name), packed_ns, n, interval_ns);
+        report(fmt::format("{} (interval, upward)", name), interval_upward_ns, n, interval_upward_ns);
+        report(fmt::format("{} (packed_interval, upward)", name), packed_upward_ns, n, interval_upward_ns);
+    };
+
+    run("x + y", [](auto const& x, auto const& y) { return x + y; });
+    run("x - y", [](auto const& x, auto const& y) { return x - y; });
+    run("x*y", [](auto const& x, auto const& y) { return x*y; });
+    run("x/y", [](auto const& x, auto const& y) { return x/y; });
+    run("(x + y)*x - y/x", [](auto const& x, auto const& y) { return (x + y)*x - y/x; });
+}
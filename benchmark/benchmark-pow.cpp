@@ -0,0 +1,57 @@
+
+// Compares the cost of integer powers of intervals computed with `pow()`, `pown()`, and `pow<N>()`.
+
+#include <random>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include <intervals/interval.hpp>
+
+#include "benchmark.hpp"
+
+using namespace intervals;
+using namespace intervals::benchmark;
+
+
+int
+main()
+{
+    constexpr long long n = 1 << 12;
+    constexpr int repetitions = 2000;
+
+    auto rng = std::mt19937_64{ 42 };
+    auto dist = std::uniform_real_distribution<double>{ -4., 4. };
+    auto xs = std::vector<interval<double>>{ };
+    auto ps = std::vector<interval<double>>{ };
+    for (long long i = 0; i != n; ++i)
+    {
+        xs.push_back(interval<double>::from_unordered_bounds(dist(rng), dist(rng)));
+        ps.push_back(abs(interval<double>::from_unordered_bounds(dist(rng), dist(rng))) + 0.5);
+    }
+
+    auto measure_op = [&](std::vector<interval<double>> const& args, auto op)
+    {
+        auto rs = std::vector<interval<double>>(args.size());
+        return measure(repetitions, [&]
+        {
+            for (std::size_t i = 0; i != args.size(); ++i)
+            {
+                rs[i].reset(op(args[i]));
+            }
+            do_not_optimize(rs.data());
+        });
+    };
+
+    double pow_ns = measure_op(xs, [](auto const& x) { return pow(x, 3.); });
+    report("pow(x, 3.)", pow_ns, n, pow_ns);
+    report("pown(x, 3)", measure_op(xs, [](auto const& x) { return pown(x, 3); }), n, pow_ns);
+    report("pow<3>(x)", measure_op(xs, [](auto const& x) { return pow<3>(x); }), n, pow_ns);
+    report("cube(x)", measure_op(xs, [](auto const& x) { return cube(x); }), n, pow_ns);
+    report("pow<2>(x)", measure_op(xs, [](auto const& x) { return pow<2>(x); }), n, pow_ns);
+    report("square(x)", measure_op(xs, [](auto const& x) { return square(x); }), n, pow_ns);
+
+    double pos_pow_ns = measure_op(ps, [](auto const& x) { return pow(x, 1.7); });
+    report("pow(x, 1.7), x > 0", pos_pow_ns, n, pos_pow_ns);
+    report("pow<5>(x), x > 0", measure_op(ps, [](auto const& x) { return pow<5>(x); }), n, pos_pow_ns);
+}
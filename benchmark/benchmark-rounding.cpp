@@ -0,0 +1,72 @@
+
+// Compares the cost of the outward-rounding policies for scalar interval arithmetic with the default `no_rounding` policy.
+// Must be compiled with `-frounding-math` (GCC, Clang) or `/fp:strict` (MSVC) for `upward_rounding` to be correct.
+
+#include <random>
+#include <vector>
+#include <string>
+
+#include <fmt/core.h>
+
+#include <intervals/interval.hpp>
+#include <intervals/rounding.hpp>
+
+#include "benchmark.hpp"
+
+using namespace intervals;
+using namespace intervals::benchmark;
+
+
+int
+main()
+{
+    constexpr long long n = 1 << 12;
+    constexpr int repetitions = 2000;
+
+    auto rng = std::mt19937_64{ 42 };
+    auto dist = std::uniform_real_distribution<double>{ -4., 4. };
+    auto xs0 = std::vector<interval<double>>{ };
+    auto ys0 = std::vector<interval<double>>{ };
+    for (long long i = 0; i != n; ++i)
+    {
+        xs0.push_back(interval<double>::from_unordered_bounds(dist(rng), dist(rng)));
+        ys0.push_back(abs(interval<double>::from_unordered_bounds(dist(rng), dist(rng))) + 1.);
+    }
+
+    auto measure_policy = [&]<typename PolicyT>(PolicyT, auto op)
+    {
+        using I = interval<double, PolicyT>;
+        auto xs = std::vector<I>(xs0.begin(), xs0.end());
+        auto ys = std::vector<I>(ys0.begin(), ys0.end());
+        auto rs = std::vector<I>(xs.size());
+        return measure(repetitions, [&]
+        {
+            for (std::size_t i = 0; i != xs.size(); ++i)
+            {
+                rs[i].reset(op(xs[i], ys[i]));
+            }
+            do_not_optimize(rs.data());
+        });
+    };
+    auto run = [&](char const* name, auto op)
+    {
+        double no_rounding_ns = measure_policy(no_rounding{ }, op);
+        double nextafter_ns = measure_policy(nextafter_rounding{ }, op);
+        double error_free_ns = measure_policy(error_free_rounding{ }, op);
+        double upward_ns;
+        {
+            auto guard = upward_rounding_guard{ };
+            upward_ns = measure_policy(upward_rounding{ }, op);
+        }
+        report(fmt::format("{} (no_rounding)", name), no_rounding_ns, n, no_rounding_ns);
+        report(fmt::format("{} (nextafter_rounding)", name), nextafter_ns, n, no_rounding_ns);
+        report(fmt::format("{} (error_free_rounding)", name), error_free_ns, n, no_rounding_ns);
+        report(fmt::format("{} (upward_rounding)", name), upward_ns, n, no_rounding_ns);
+    };
+
+    run("x + y", [](auto const& x, auto const& y) { return x + y; });
+    run("x - y", [](auto const& x, auto const& y) { return x - y; });
+    run("x*y", [](auto const& x, auto const& y) { return x*y; });
+    run("x/y", [](auto const& x, auto const& y) { return x/y; });
+    run("sqrt(y)", [](auto const&, auto const& y) { return sqrt(y); });
+}
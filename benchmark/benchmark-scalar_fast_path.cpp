@@ -0,0 +1,123 @@
+
+// Measures the benefit of `scalar_fast_path()` for interval-aware functions when most arguments are degenerate, and the
+// cost of the degenerate shortcuts of `cos()`, `pow()`, and `atan2()` relative to the scalar functions.
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include <intervals/interval.hpp>
+#include <intervals/algorithm.hpp>
+
+#include "benchmark.hpp"
+
+using namespace intervals;
+using namespace intervals::benchmark;
+
+
+template <typename T>
+T
+max3(T a, T b)
+{
+    using namespace intervals::math;   // for constrain(), assign_partial()
+    using namespace intervals::logic;  // for possibly()
+    auto x = T{ };
+    auto c = (a < b);
+    if (possibly(c))
+    {
+        auto bc = constrain(b, c);
+        assign_partial(x, bc);
+    }
+    if (possibly(!c))
+    {
+        auto ac = constrain(a, !c);
+        assign_partial(x, ac);
+    }
+    return x;
+}
+
+template <typename X, typename Y>
+Y
+interpolate_linear(X x, Y y0, Y y1)
+{
+    using namespace intervals::math;  // for min(), max()
+    return y0 + (y1 - y0)*max(X(0), min(x, X(1)));
+}
+
+
+int
+main()
+{
+    constexpr long long n = 1 << 12;
+    constexpr int repetitions = 2000;
+
+    auto rng = std::mt19937_64{ 42 };
+    auto dist = std::uniform_real_distribution<double>{ 0., 1. };
+    auto make_args = [&](double degenerate_fraction)
+    {
+        auto xs = std::vector<interval<double>>{ };
+        for (long long i = 0; i != n; ++i)
+        {
+            double a = dist(rng);
+            xs.push_back(dist(rng) < degenerate_fraction ? interval{ a } : interval{ a, a + 0.1*dist(rng) });
+        }
+        return xs;
+    };
+
+    auto max3_fast = scalar_fast_path([](auto a, auto b) { return max3(a, b); });
+    auto interpolate_fast = scalar_fast_path([](auto x, auto y0, auto y1) { return interpolate_linear(x, y0, y1); });
+
+    auto run = [&](std::string_view label, double degenerate_fraction)
+    {
+        auto xs = make_args(degenerate_fraction);
+        auto ys = make_args(degenerate_fraction);
+        auto rs = std::vector<interval<double>>(n);
+        auto measure_op = [&](auto op)
+        {
+            return measure(repetitions, [&]
+            {
+                for (long long i = 0; i != n; ++i)
+                {
+                    rs[i].reset(op(xs[i], ys[i]));
+                }
+                do_not_optimize(rs.data());
+            });
+        };
+        fmt::print("{}\n", label);
+        double max3_ns = measure_op([](auto const& x, auto const& y) { return max3(interval(x), interval(y)); });
+        report("max3(x, y)", max3_ns, n, max3_ns);
+        report("max3_fast(x, y)", measure_op([&](auto const& x, auto const& y) { return max3_fast(interval(x), interval(y)); }), n, max3_ns);
+        double interp_ns = measure_op([](auto const& x, auto const& y) { return interpolate_linear(interval(x), interval(y), interval{ 2. }); });
+        report("interpolate_linear(x, y, 2)", interp_ns, n, interp_ns);
+        report("interpolate_fast(x, y, 2)", measure_op([&](auto const& x, auto const& y) { return interpolate_fast(interval(x), interval(y), interval{ 2. }); }), n, interp_ns);
+    };
+    run("all arguments degenerate", 1.);
+    run("95% of arguments degenerate", 0.95);
+    run("no argument degenerate", 0.);
+
+    auto xs = make_args(1.);
+    auto rs = std::vector<interval<double>>(n);
+    auto measure_op = [&](auto op)
+    {
+        return measure(repetitions, [&]
+        {
+            for (long long i = 0; i != n; ++i)
+            {
+                rs[i].reset(op(xs[i]));
+            }
+            do_not_optimize(rs.data());
+        });
+    };
+    fmt::print("degenerate transcendental functions\n");
+    double cos_ns = measure_op([](auto const& x) { return interval{ std::cos(x.lower()) }; });
+    report("std::cos()", cos_ns, n, cos_ns);
+    report("cos(x)", measure_op([](auto const& x) { return cos(x); }), n, cos_ns);
+    double pow_ns = measure_op([](auto const& x) { return interval{ std::pow(1.5, x.lower()) }; });
+    report("std::pow()", pow_ns, n, pow_ns);
+    report("pow(1.5, x)", measure_op([](auto const& x) { return pow(interval{ 1.5 }, x); }), n, pow_ns);
+    double atan2_ns = measure_op([](auto const& x) { return interval{ std::atan2(x.lower(), 2.) }; });
+    report("std::atan2()", atan2_ns, n, atan2_ns);
+    report("atan2(x, 2)", measure_op([](auto const& x) { return atan2(x, interval{ 2. }); }), n, atan2_ns);
+}
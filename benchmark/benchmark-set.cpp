@@ -0,0 +1,211 @@
+
+// Compares the cost of constructing and querying `set<>` of a large enumeration type with a linear search over the reflected
+// values, the cost of enumerating its elements with testing every index, and the cost of `lift()` with hand-written
+// set operations.
+
+#include <array>
+#include <random>
+#include <vector>
+#include <cstddef>  // for size_t
+
+#include <gsl-lite/gsl-lite.hpp>  // for type_identity<>
+
+#include <fmt/core.h>
+
+#include <intervals/set.hpp>
+#include <intervals/algorithm.hpp>  // for enumerate()
+
+#include "benchmark.hpp"
+
+using namespace intervals;
+using namespace intervals::benchmark;
+
+
+namespace {
+
+
+    // A state enumeration with 150 contiguous values, and one with 150 values spread out in steps of 3.
+enum class State : int { };
+enum class Code : int { };
+
+consteval auto
+reflect(gsl_lite::type_identity<State>)
+{
+    auto result = std::array<State, 150>{ };
+    for (int i = 0; i != 150; ++i)
+    {
+        result[i] = State(i);
+    }
+    return result;
+}
+consteval auto
+reflect(gsl_lite::type_identity<Code>)
+{
+    auto result = std::array<Code, 150>{ };
+    for (int i = 0; i != 150; ++i)
+    {
+        result[i] = Code(3*i + 1);
+    }
+    return result;
+}
+
+template <typename E>
+std::size_t
+linear_find(E value)
+{
+    auto const& values = set<E>::values;
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        if (values[i] == value)
+        {
+            return i;
+        }
+    }
+    return values.size();
+}
+
+
+    // Product of sign sets written as a chain of `contains()` tests.
+set<sign>
+multiply_signs(set<sign> lhs, set<sign> rhs)
+{
+    bool lp = lhs.contains(positive_sign);
+    bool lz = lhs.contains(zero_sign);
+    bool ln = lhs.contains(negative_sign);
+    bool rp = rhs.contains(positive_sign);
+    bool rz = rhs.contains(zero_sign);
+    bool rn = rhs.contains(negative_sign);
+    set<sign> result;
+    if ((lp && rn) || (ln && rp))
+    {
+        result.assign(negative_sign);
+    }
+    if ((lp && rp) || (ln && rn))
+    {
+        result.assign(positive_sign);
+    }
+    if (lz || rz)
+    {
+        result.assign(zero_sign);
+    }
+    return result;
+}
+
+
+} // anonymous namespace
+
+
+int
+main()
+{
+    constexpr long long n = 1 << 14;
+    constexpr int repetitions = 500;
+
+    auto rng = std::mt19937_64{ 42 };
+    auto dist = std::uniform_int_distribution<int>{ 0, 149 };
+
+    auto run = [&]<typename E>(char const* name, E (*make)(int))
+    {
+        auto xs = std::vector<E>{ };
+        for (long long i = 0; i != n; ++i)
+        {
+            xs.push_back(make(dist(rng)));
+        }
+        double linear_ns = measure(repetitions, [&]
+        {
+            std::size_t sum = 0;
+            for (E x : xs)
+            {
+                sum += linear_find(x);
+            }
+            do_not_optimize(sum);
+        });
+        double table_ns = measure(repetitions, [&]
+        {
+            std::size_t sum = 0;
+            auto s = set<E>{ };
+            for (E x : xs)
+            {
+                s.assign(x);
+                sum += s.contains(x) ? 1 : 0;
+            }
+            do_not_optimize(sum);
+            do_not_optimize(s);
+        });
+        report(fmt::format("{} (linear search)", name), linear_ns, n, linear_ns);
+        report(fmt::format("{} (index table)", name), table_ns, n, linear_ns);
+    };
+
+    run("set<State>", +[](int i) { return State(i); });
+    run("set<Code>", +[](int i) { return Code(3*i + 1); });
+
+        // Enumerate sparse sets with 4 elements each.
+    auto sets = std::vector<set<State>>{ };
+    for (long long i = 0; i != n; ++i)
+    {
+        auto s = set<State>{ };
+        for (int j = 0; j != 4; ++j)
+        {
+            s.assign(State(dist(rng)));
+        }
+        sets.push_back(s);
+    }
+    double scan_ns = measure(repetitions/10, [&]
+    {
+        int sum = 0;
+        for (auto const& s : sets)
+        {
+            for (gsl_lite::index i = 0; i != gsl_lite::ssize(set<State>::values); ++i)
+            {
+                if (s.contains_index(i))
+                {
+                    sum += int(set<State>::values[i]);
+                }
+            }
+        }
+        do_not_optimize(sum);
+    });
+    double enumerate_ns = measure(repetitions/10, [&]
+    {
+        int sum = 0;
+        for (auto const& s : sets)
+        {
+            for (State x : enumerate(s))
+            {
+                sum += int(x);
+            }
+        }
+        do_not_optimize(sum);
+    });
+    report("enumerate(set<State>) (scan)", scan_ns, n, scan_ns);
+    report("enumerate(set<State>)", enumerate_ns, n, scan_ns);
+
+        // Product of sign sets.
+    auto signDist = std::uniform_int_distribution<unsigned>{ 1, 7 };
+    auto xs = std::vector<set<sign>>{ };
+    auto ys = std::vector<set<sign>>{ };
+    for (long long i = 0; i != n; ++i)
+    {
+        xs.push_back(set<sign>::from_bits(signDist(rng)));
+        ys.push_back(set<sign>::from_bits(signDist(rng)));
+    }
+    auto rs = std::vector<set<sign>>(n);
+    double chain_ns = measure(repetitions, [&]
+    {
+        for (std::size_t i = 0; i != xs.size(); ++i)
+        {
+            rs[i].reset(multiply_signs(xs[i], ys[i]));
+        }
+        do_not_optimize(rs.data());
+    });
+    double lift_ns = measure(repetitions, [&]
+    {
+        for (std::size_t i = 0; i != xs.size(); ++i)
+        {
+            rs[i].reset(xs[i]*ys[i]);
+        }
+        do_not_optimize(rs.data());
+    });
+    report("set<sign>*set<sign> (contains)", chain_ns, n, chain_ns);
+    report("set<sign>*set<sign> (lift)", lift_ns, n, chain_ns);
+}
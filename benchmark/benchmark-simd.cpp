@@ -0,0 +1,122 @@
+
+// Compares interval-aware generic functions evaluated for `interval<double>` one element at a time with the same functions
+// evaluated for `interval<simd<double, N>>` on  N  elements at once.
+
+#include <array>
+#include <random>
+#include <vector>
+#include <string_view>
+
+#include <fmt/core.h>
+
+#include <intervals/interval.hpp>
+#include <intervals/simd.hpp>
+
+#include "benchmark.hpp"
+
+using namespace intervals;
+using namespace intervals::benchmark;
+
+
+template <typename T>
+T
+max3(T a, T b)
+{
+    using namespace intervals::math;   // for constrain(), assign_partial()
+    using namespace intervals::logic;  // for possibly()
+    auto x = T{ };
+    auto c = (a < b);
+    if (possibly(c))
+    {
+        auto bc = constrain(b, c);
+        assign_partial(x, bc);
+    }
+    if (possibly(!c))
+    {
+        auto ac = constrain(a, !c);
+        assign_partial(x, ac);
+    }
+    return x;
+}
+
+template <typename T>
+T
+horner(T x)
+{
+    return ((0.5*x - 1.)*x + 2.)*x - 3.;
+}
+
+
+template <int N, typename F>
+double
+measure_lanes(std::vector<interval<double>> const& xs, std::vector<interval<double>> const& ys, F f, int repetitions)
+{
+    using I = interval<simd<double, N>>;
+
+    auto n = std::ssize(xs);
+    auto xv = std::vector<I>{ };
+    auto yv = std::vector<I>{ };
+    for (long long i = 0; i + N <= n; i += N)
+    {
+        auto xl = std::array<interval<double>, N>{ };
+        auto yl = std::array<interval<double>, N>{ };
+        for (int j = 0; j != N; ++j)
+        {
+            xl[j].reset(xs[i + j]);
+            yl[j].reset(ys[i + j]);
+        }
+        xv.push_back(I(xl));
+        yv.push_back(I(yl));
+    }
+    auto rs = std::vector<I>(xv.size());
+    return measure(repetitions, [&]
+    {
+        for (std::size_t i = 0; i != xv.size(); ++i)
+        {
+            rs[i].reset(f(xv[i], yv[i]));
+        }
+        do_not_optimize(rs.data());
+    });
+}
+
+
+int
+main()
+{
+    constexpr long long n = 1 << 12;
+    constexpr int repetitions = 2000;
+
+    auto rng = std::mt19937_64{ 42 };
+    auto dist = std::uniform_real_distribution<double>{ -1., 1. };
+    auto xs = std::vector<interval<double>>{ };
+    auto ys = std::vector<interval<double>>{ };
+    for (long long i = 0; i != n; ++i)
+    {
+        xs.push_back(interval<double>::from_unordered_bounds(dist(rng), dist(rng)));
+        ys.push_back(interval<double>::from_unordered_bounds(dist(rng), dist(rng)));
+    }
+    auto rs = std::vector<interval<double>>(n);
+    auto measure_scalar = [&](auto f)
+    {
+        return measure(repetitions, [&]
+        {
+            for (long long i = 0; i != n; ++i)
+            {
+                rs[i].reset(f(xs[i], ys[i]));
+            }
+            do_not_optimize(rs.data());
+        });
+    };
+
+    auto run = [&](std::string_view label, auto f)
+    {
+        fmt::print("{}\n", label);
+        double scalar_ns = measure_scalar(f);
+        report("interval<double>", scalar_ns, n, scalar_ns);
+        report("interval<simd<double, 2>>", measure_lanes<2>(xs, ys, f, repetitions), n, scalar_ns);
+        report("interval<simd<double, 4>>", measure_lanes<4>(xs, ys, f, repetitions), n, scalar_ns);
+        report("interval<simd<double, 8>>", measure_lanes<8>(xs, ys, f, repetitions), n, scalar_ns);
+    };
+    run("max3(x, y)", [](auto const& x, auto const& y) { return max3(x, y); });
+    run("horner(x)*y", [](auto const& x, auto const& y) { return horner(x)*y; });
+}
@@ -0,0 +1,75 @@
+
+// Measures the cost of the interval trigonometric functions for moderate and large arguments, relative to evaluating
+// `std::cos()` at both bounds.
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include <intervals/interval.hpp>
+
+#include "benchmark.hpp"
+
+using namespace intervals;
+using namespace intervals::benchmark;
+
+
+int
+main()
+{
+    constexpr long long n = 1 << 12;
+    constexpr int repetitions = 2000;
+
+    auto rng = std::mt19937_64{ 42 };
+    auto dist = std::uniform_real_distribution<double>{ -1., 1. };
+    auto make_args = [&](double scale)
+    {
+        auto xs = std::vector<interval<double>>{ };
+        for (long long i = 0; i != n; ++i)
+        {
+            double a = scale*dist(rng);
+            xs.push_back(interval{ a, a + 2*std::abs(dist(rng)) });
+        }
+        return xs;
+    };
+
+    auto measure_op = [&](std::vector<interval<double>> const& args, auto op)
+    {
+        auto rs = std::vector<interval<double>>(args.size());
+        return measure(repetitions, [&]
+        {
+            for (std::size_t i = 0; i != args.size(); ++i)
+            {
+                rs[i].reset(op(args[i]));
+            }
+            do_not_optimize(rs.data());
+        });
+    };
+    auto run = [&](std::string_view label, double scale)
+    {
+        auto xs = make_args(scale);
+        fmt::print("{}\n", label);
+        double base_ns = measure_op(xs, [](auto const& x)
+        {
+            double c1 = std::cos(x.lower());
+            double c2 = std::cos(x.upper());
+            return interval{ c1 < c2 ? c1 : c2, c1 < c2 ? c2 : c1 };
+        });
+        report("std::cos() at both bounds", base_ns, n, base_ns);
+        report("cos(x)", measure_op(xs, [](auto const& x) { return cos(x); }), n, base_ns);
+        report("sin(x)", measure_op(xs, [](auto const& x) { return sin(x); }), n, base_ns);
+        report("tan(x)", measure_op(xs, [](auto const& x) { return tan(x); }), n, base_ns);
+        report("sin(x) + cos(x)", measure_op(xs, [](auto const& x) { return sin(x) + cos(x); }), n, base_ns);
+        report("sincos(x), summed", measure_op(xs, [](auto const& x)
+        {
+            auto [s, c] = sincos(x);
+            return s + c;
+        }), n, base_ns);
+    };
+
+    run("|x| ≤ 10", 10.);
+    run("|x| ≤ 10⁵", 1.e5);
+    run("|x| ≤ 10¹⁵", 1.e15);
+}
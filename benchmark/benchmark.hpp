@@ -0,0 +1,60 @@
+
+#ifndef INCLUDED_INTERVALS_BENCHMARK_BENCHMARK_HPP_
+#define INCLUDED_INTERVALS_BENCHMARK_BENCHMARK_HPP_
+
+
+#include <chrono>
+#include <string_view>
+
+#include <fmt/core.h>
+
+
+namespace intervals::benchmark {
+
+
+    // Prevent the compiler from optimizing away the computation of  value .
+template <typename T>
+inline void
+do_not_optimize(T const& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile char const* sink;
+    sink = reinterpret_cast<char const volatile*>(&value);
+#endif
+}
+
+    // Run  f()  repeatedly and return the best time per repetition in nanoseconds.
+template <typename F>
+double
+measure(int repetitions, F&& f)
+{
+    using clock = std::chrono::steady_clock;
+
+    double best = 0;
+    for (int i = 0; i != repetitions; ++i)
+    {
+        auto start = clock::now();
+        f();
+        auto elapsed = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+        if (i == 0 || elapsed < best)
+        {
+            best = elapsed;
+        }
+    }
+    return best;
+}
+
+    // Print a line of the form  "<name>  <ns/element> ns/elem  <speedup>x" .
+inline void
+report(std::string_view name, double ns, long long elements, double baseline_ns)
+{
+    fmt::print("{:<32} {:8.3f} ns/elem {:7.2f}x\n", name, ns/double(elements), baseline_ns/ns);
+}
+
+
+} // namespace intervals::benchmark
+
+
+#endif // INCLUDED_INTERVALS_BENCHMARK_BENCHMARK_HPP_
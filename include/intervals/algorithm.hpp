@@ -14,6 +14,7 @@
 #include <gsl-lite/gsl-lite.hpp>
 
 #include <intervals/set.hpp>
+#include <intervals/int_set.hpp>
 #include <intervals/interval.hpp>
 #include <intervals/concepts.hpp>
 #include <intervals/type_traits.hpp>
@@ -104,18 +105,8 @@ partition_point(R&& range, PredicateT&& predicate)
     }
     else if constexpr (std::is_convertible_v<PredVal, set<bool>>)
     {
-        auto pos = interval{
-            std::ranges::partition_point(range,
-                [&predicate](Value const& value)
-                {
-                    return intervals::always(predicate(value));
-                }),
-            std::ranges::partition_point(range,
-                [&predicate](Value const& value)
-                {
-                    return intervals::possibly(predicate(value));
-                })
-        };
+        auto [alwaysPos, possiblyPos] = detail::set_partition_points(range, predicate);
+        auto pos = interval{ alwaysPos, possiblyPos };
         return std::pair{
             detail::partitioning<R, PredicateT>{ std::forward<R>(range), std::forward<PredicateT>(predicate) },
             pos
@@ -184,6 +175,14 @@ enumerate(set<T> const& value)
 
     return { value };
 }
+template <int Min, int Max>
+[[nodiscard]] constexpr detail::int_set_value_range<Min, Max>
+enumerate(int_set<Min, Max> const& value)
+{
+    gsl_Expects(value.assigned());
+
+    return { .bits = { value.to_words() } };
+}
 template <typename T>
 [[nodiscard]] constexpr detail::interval_value_range<T>
 enumerate(detail::interval_base<T> const& value)
@@ -219,6 +218,45 @@ at(R const& range, interval<gsl::index> const& indexInterval)
     }
     return result;
 }
+template <std::ranges::random_access_range R, int Min, int Max>
+[[nodiscard]] constexpr set_of_t<std::ranges::range_value_t<R>>
+at(R const& range, int_set<Min, Max> const& indexSet)
+{
+    using Result = set_of_t<std::ranges::range_value_t<R>>;
+
+    gsl_Expects(indexSet.assigned());
+    gsl_Expects(indexSet.lower() >= 0 && indexSet.upper() < std::ranges::ssize(range));
+
+    auto result = Result{ };
+    for (int index : intervals::enumerate(indexSet))
+    {
+        intervals::assign_partial(result, range[index]);
+    }
+    return result;
+}
+
+
+    //
+    // Wrap a function object written in interval-aware style such that it is called with scalar arguments if all arguments
+    // are degenerate, i.e. if all interval arguments have coinciding bounds and all set arguments have a single element.
+    // Otherwise, the arguments are passed on unchanged. The result of the scalar call is converted to the result type of
+    // the call with the original arguments:
+    //
+    //     auto max3_fast = intervals::scalar_fast_path([](auto a, auto b) { return max3(a, b); });
+    //     auto x = max3_fast(interval{ 2. }, interval{ 3. });  // calls `max3<double>()`, returns  [3,3]
+    //     auto y = max3_fast(interval{ 0., 3. }, interval{ 1., 2. });  // calls `max3<interval<double>>()`, returns  [1,3]
+    //
+    // This pays off if most arguments carry no uncertainty, since the scalar instantiation needs neither interval arithmetic
+    // nor the branches of the interval-aware control flow. Scalar arguments are not passed by reference. The scalar path is
+    // taken only for intervals which use `no_rounding` or `finite_only`; intervals with other rounding policies or with
+    // `libm_error_padding<>` are always passed unchanged because the scalar result would not enclose the exact result.
+    //
+template <typename F>
+[[nodiscard]] constexpr detail::scalar_fast_path_fn<std::decay_t<F>>
+scalar_fast_path(F&& f)
+{
+    return detail::scalar_fast_path_fn<std::decay_t<F>>(std::forward<F>(f));
+}
 
 
 } // namespace intervals
@@ -0,0 +1,405 @@
+
+#ifndef INCLUDED_INTERVALS_BOOL_SET_ARRAY_HPP_
+#define INCLUDED_INTERVALS_BOOL_SET_ARRAY_HPP_
+
+
+#include <span>
+#include <vector>
+#include <cstddef>           // for size_t
+#include <cstdint>           // for uint64_t
+#include <algorithm>         // for ranges::fill()
+#include <initializer_list>
+
+#include <gsl-lite/gsl-lite.hpp>  // for dim, index, gsl_Expects(), gsl_ExpectsDebug()
+
+#include <intervals/set.hpp>
+
+#include <intervals/detail/bool_set_array.hpp>
+
+
+namespace intervals {
+
+namespace gsl = gsl_lite;
+
+
+    //
+    // Packed array of `set<bool>` values.
+    //
+    // Every element occupies two bits, one indicating whether the element may be `false` and one indicating whether it may be
+    // `true`, which are stored in two separate arrays of 64-bit words. The logical operators `!`, `&`, `|`, `^` are applied
+    // element-wise to 64 elements at a time with bitwise operations on whole words, and the loops over the words can be
+    // vectorized by the compiler. The results are identical to those obtained by applying the corresponding operator to each
+    // element as a `set<bool>`.
+    //
+    // The predicates `possibly()`, `possibly_not()`, `always()`, `never()`, `contingent()`, and `vacuous()` are also applied
+    // element-wise and yield arrays of definite truth values. `any_of()` and `all_of()` reduce an array to a `set<bool>` with the
+    // Kleene disjunction and conjunction of its elements; for example, `possibly(any_of(contingent(xs)))` checks whether any
+    // element of  xs  is contingent.
+    //
+class bool_set_array
+{
+    friend detail::bool_set_array_access;
+
+    using storage = std::vector<std::uint64_t, detail::aligned_allocator<std::uint64_t, detail::interval_array_alignment>>;
+
+    storage false_;
+    storage true_;
+    gsl::dim size_ = 0;
+
+    struct uninitialized_tag { };
+
+        // Allocates storage for  n  elements without initializing them.
+    explicit bool_set_array(gsl::dim n, uninitialized_tag)
+        : false_(detail::bool_set_word_count(gsl::narrow_cast<std::size_t>(n))),
+          true_(detail::bool_set_word_count(gsl::narrow_cast<std::size_t>(n))),
+          size_(n)
+    {
+    }
+
+    [[nodiscard]] static constexpr std::uint64_t
+    _bit(gsl::index i) noexcept
+    {
+        return std::uint64_t(1) << (gsl::narrow_cast<std::size_t>(i) % detail::bool_set_word_bits);
+    }
+    [[nodiscard]] static constexpr std::size_t
+    _word(gsl::index i) noexcept
+    {
+        return gsl::narrow_cast<std::size_t>(i)/detail::bool_set_word_bits;
+    }
+
+public:
+    using value_type = set<bool>;
+
+        // Constructs an empty array.
+    bool_set_array() = default;
+
+        // Constructs an array of  n  unassigned elements.
+    explicit bool_set_array(gsl::dim n)
+        : false_(detail::bool_set_word_count(gsl::narrow_cast<std::size_t>(n)), 0),
+          true_(detail::bool_set_word_count(gsl::narrow_cast<std::size_t>(n)), 0),
+          size_(n)
+    {
+        gsl_Expects(n >= 0);
+    }
+
+        // Constructs an array of  n  copies of the given value.
+    explicit bool_set_array(gsl::dim n, set<bool> value)
+        : bool_set_array(n, uninitialized_tag{ })
+    {
+        gsl_Expects(n >= 0);
+
+        auto x = detail::bool_set_array_access::operand(value);
+        std::ranges::fill(false_, x.f);
+        std::ranges::fill(true_, x.t);
+        detail::bool_set_array_access::clear_tail(*this);
+    }
+
+        // Constructs an array from a list of values.
+    bool_set_array(std::initializer_list<set<bool>> values)
+        : bool_set_array(std::span<set<bool> const>(values.begin(), values.size()))
+    {
+    }
+
+        // Constructs an array from a sequence of values.
+    explicit bool_set_array(std::span<set<bool> const> values)
+        : bool_set_array(gsl::ssize(values))
+    {
+        for (gsl::index i = 0, n = size_; i != n; ++i)
+        {
+            reset(i, values[gsl::narrow_cast<std::size_t>(i)]);
+        }
+    }
+
+    [[nodiscard]] gsl::dim
+    size() const noexcept
+    {
+        return size_;
+    }
+    [[nodiscard]] bool
+    empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+        // Resizes the array to  n  elements. New elements are unassigned.
+    void
+    resize(gsl::dim n)
+    {
+        gsl_Expects(n >= 0);
+
+        false_.resize(detail::bool_set_word_count(gsl::narrow_cast<std::size_t>(n)), 0);
+        true_.resize(detail::bool_set_word_count(gsl::narrow_cast<std::size_t>(n)), 0);
+        size_ = n;
+        detail::bool_set_array_access::clear_tail(*this);
+    }
+
+        // Direct access to the bit planes. The  i -th bit of the  (i/64) -th word of `false_bits()` and `true_bits()` is set if the
+        //  i -th element may be `false` and `true`, respectively. Bits beyond the size of the array are zero.
+    [[nodiscard]] std::span<std::uint64_t const>
+    false_bits() const noexcept
+    {
+        return false_;
+    }
+    [[nodiscard]] std::span<std::uint64_t const>
+    true_bits() const noexcept
+    {
+        return true_;
+    }
+
+    [[nodiscard]] set<bool>
+    operator [](gsl::index i) const
+    {
+        gsl_ExpectsDebug(i >= 0 && i < size());
+
+        std::size_t w = _word(i);
+        std::uint64_t b = _bit(i);
+        return set<bool>::from_bits(((false_[w] & b) != 0 ? 1u : 0u) | ((true_[w] & b) != 0 ? 2u : 0u));
+    }
+
+        // Marks the  i -th element as unassigned.
+    bool_set_array&
+    reset(gsl::index i)
+    {
+        gsl_ExpectsDebug(i >= 0 && i < size());
+
+        std::size_t w = _word(i);
+        std::uint64_t b = _bit(i);
+        false_[w] &= ~b;
+        true_[w] &= ~b;
+        return *this;
+    }
+        // Sets the  i -th element to the given value.
+    bool_set_array&
+    reset(gsl::index i, set<bool> value)
+    {
+        reset(i);
+        if (value.assigned())
+        {
+            assign(i, value);
+        }
+        return *this;
+    }
+        // Adds the given values to the  i -th element.
+    bool_set_array&
+    assign(gsl::index i, set<bool> value)
+    {
+        gsl_ExpectsDebug(i >= 0 && i < size());
+        gsl_Expects(value.assigned());
+
+        std::size_t w = _word(i);
+        std::uint64_t b = _bit(i);
+        if (value.contains(false))
+        {
+            false_[w] |= b;
+        }
+        if (value.contains(true))
+        {
+            true_[w] |= b;
+        }
+        return *this;
+    }
+
+    [[nodiscard]] friend bool_set_array
+    operator !(bool_set_array const& x)
+    {
+        return detail::bool_set_array_access::apply(detail::not_bool_sets, x);
+    }
+
+    template <typename X, typename Y>
+    requires detail::bool_set_array_operands<X, Y>
+    [[nodiscard]] friend bool_set_array
+    operator &(X const& x, Y const& y)
+    {
+        return detail::bool_set_array_access::apply(detail::and_bool_sets, x, y);
+    }
+    template <typename X, typename Y>
+    requires detail::bool_set_array_operands<X, Y>
+    [[nodiscard]] friend bool_set_array
+    operator |(X const& x, Y const& y)
+    {
+        return detail::bool_set_array_access::apply(detail::or_bool_sets, x, y);
+    }
+    template <typename X, typename Y>
+    requires detail::bool_set_array_operands<X, Y>
+    [[nodiscard]] friend bool_set_array
+    operator ^(X const& x, Y const& y)
+    {
+        return detail::bool_set_array_access::apply(detail::xor_bool_sets, x, y);
+    }
+};
+
+    // Instead of short-circuiting Boolean operators `&&` and `||`, use operators `&` and `|` for `bool_set_array`.
+bool_set_array operator &&(bool_set_array const&, bool_set_array const&) = delete;
+bool_set_array operator ||(bool_set_array const&, bool_set_array const&) = delete;
+
+
+inline namespace logic {
+
+
+[[nodiscard]] inline bool_set_array
+possibly(bool_set_array const& x)
+{
+    return detail::bool_set_array_access::apply(detail::possibly_bool_sets, x);
+}
+[[nodiscard]] inline bool_set_array
+possibly_not(bool_set_array const& x)
+{
+    return detail::bool_set_array_access::apply(detail::possibly_not_bool_sets, x);
+}
+[[nodiscard]] inline bool_set_array
+always(bool_set_array const& x)
+{
+    return detail::bool_set_array_access::apply(detail::always_bool_sets, x);
+}
+[[nodiscard]] inline bool_set_array
+never(bool_set_array const& x)
+{
+    return detail::bool_set_array_access::apply(detail::never_bool_sets, x);
+}
+[[nodiscard]] inline bool_set_array
+contingent(bool_set_array const& x)
+{
+    return detail::bool_set_array_access::apply(detail::contingent_bool_sets, x);
+}
+[[nodiscard]] inline bool_set_array
+vacuous(bool_set_array const& x)
+{
+    return detail::bool_set_array_access::apply(detail::vacuous_bool_sets, x);
+}
+
+    // Kleene disjunction of all elements. The result is unassigned if any element is unassigned, and it is `false` for an empty
+    // array.
+[[nodiscard]] inline set<bool>
+any_of(bool_set_array const& x) noexcept
+{
+    return detail::bool_set_array_access::any_of(x);
+}
+    // Kleene conjunction of all elements. The result is unassigned if any element is unassigned, and it is `true` for an empty
+    // array.
+[[nodiscard]] inline set<bool>
+all_of(bool_set_array const& x) noexcept
+{
+    return detail::bool_set_array_access::all_of(x);
+}
+
+
+} // inline namespace logic
+
+
+namespace detail {
+
+
+inline bool_set_array_words
+bool_set_array_access::operand(bool_set_array const& x) noexcept
+{
+    return { x.false_.data(), x.true_.data() };
+}
+
+inline gsl::dim
+bool_set_array_access::size(bool_set_array const& x) noexcept
+{
+    return x.size();
+}
+
+inline void
+bool_set_array_access::clear_tail(bool_set_array& x) noexcept
+{
+    if (!x.false_.empty())
+    {
+        std::uint64_t mask = detail::bool_set_tail_mask(gsl::narrow_cast<std::size_t>(x.size_));
+        x.false_.back() &= mask;
+        x.true_.back() &= mask;
+    }
+}
+
+template <typename G>
+inline bool_set_array
+bool_set_array_access::generate(gsl::dim n, G g)
+{
+    gsl_Expects(n >= 0);
+
+    auto result = bool_set_array(n, bool_set_array::uninitialized_tag{ });
+    g(result.false_.data(), result.true_.data());
+    clear_tail(result);
+    return result;
+}
+
+template <typename F>
+inline bool_set_array
+bool_set_array_access::apply(F f, bool_set_array const& x)
+{
+    auto result = bool_set_array(x.size(), bool_set_array::uninitialized_tag{ });
+    detail::_transform_words(x.false_.size(), result.false_.data(), result.true_.data(), f, operand(x));
+    clear_tail(result);
+    return result;
+}
+template <typename F, typename X, typename Y>
+inline bool_set_array
+bool_set_array_access::apply(F f, X const& x, Y const& y)
+{
+    gsl::dim nx = size(x);
+    gsl::dim ny = size(y);
+    gsl_Expects(nx < 0 || ny < 0 || nx == ny);
+
+    gsl::dim n = nx >= 0 ? nx : ny;
+    auto result = bool_set_array(n, bool_set_array::uninitialized_tag{ });
+    detail::_transform_words(result.false_.size(), result.false_.data(), result.true_.data(), f, operand(x), operand(y));
+    clear_tail(result);
+    return result;
+}
+
+    // The reductions accumulate bit masks over all words; the flags are combined as integers so as not to impede
+    // vectorization. In the last word, the bits beyond the size of the array are excluded with the tail mask.
+inline set<bool>
+bool_set_array_access::any_of(bool_set_array const& x) noexcept
+{
+    std::size_t n = x.false_.size();
+    std::uint64_t anyTrue = 0;
+    std::uint64_t anyNotFalse = 0;
+    std::uint64_t anyUnassigned = 0;
+    for (std::size_t i = 0; i + 1 < n; ++i)
+    {
+        anyTrue |= x.true_[i];
+        anyNotFalse |= ~x.false_[i];
+        anyUnassigned |= ~(x.false_[i] | x.true_[i]);
+    }
+    if (n != 0)
+    {
+        std::uint64_t mask = detail::bool_set_tail_mask(gsl::narrow_cast<std::size_t>(x.size_));
+        anyTrue |= x.true_[n - 1];
+        anyNotFalse |= ~x.false_[n - 1] & mask;
+        anyUnassigned |= ~(x.false_[n - 1] | x.true_[n - 1]) & mask;
+    }
+    return set<bool>::from_bits(anyUnassigned != 0 ? 0u : (anyNotFalse == 0 ? 1u : 0u) | (anyTrue != 0 ? 2u : 0u));
+}
+inline set<bool>
+bool_set_array_access::all_of(bool_set_array const& x) noexcept
+{
+    std::size_t n = x.false_.size();
+    std::uint64_t anyFalse = 0;
+    std::uint64_t anyNotTrue = 0;
+    std::uint64_t anyUnassigned = 0;
+    for (std::size_t i = 0; i + 1 < n; ++i)
+    {
+        anyFalse |= x.false_[i];
+        anyNotTrue |= ~x.true_[i];
+        anyUnassigned |= ~(x.false_[i] | x.true_[i]);
+    }
+    if (n != 0)
+    {
+        std::uint64_t mask = detail::bool_set_tail_mask(gsl::narrow_cast<std::size_t>(x.size_));
+        anyFalse |= x.false_[n - 1];
+        anyNotTrue |= ~x.true_[n - 1] & mask;
+        anyUnassigned |= ~(x.false_[n - 1] | x.true_[n - 1]) & mask;
+    }
+    return set<bool>::from_bits(anyUnassigned != 0 ? 0u : (anyFalse != 0 ? 1u : 0u) | (anyNotTrue == 0 ? 2u : 0u));
+}
+
+
+} // namespace detail
+
+
+} // namespace intervals
+
+
+#endif // INCLUDED_INTERVALS_BOOL_SET_ARRAY_HPP_
@@ -3,15 +3,23 @@
 #define INCLUDED_INTERVALS_DETAIL_ALGORITHM_HPP_
 
 
+#include <bit>          // for popcount()
 #include <array>
 #include <ranges>       // for random_access_range
+#include <cstdint>      // for uint64_t
+#include <utility>      // for move(), forward<>()
 #include <iterator>     // for random_access_iterator
-#include <type_traits>  // for is_same<>
+#include <concepts>     // for invocable<>, derived_from<>
+#include <functional>   // for invoke()
+#include <type_traits>  // for is_same<>, remove_cvref<>, invoke_result<>, is_void<>
 
-#include <makeshift/metadata.hpp>  // for metadata::values()
+#include <makeshift/metadata.hpp>     // for metadata::values()
+#include <makeshift/type_traits.hpp>  // for is_instantiation_of<>
 
 #include <intervals/set.hpp>
 #include <intervals/interval.hpp>
+#include <intervals/rounding.hpp>     // for no_rounding
+#include <intervals/type_traits.hpp>  // for interval_arg_policy<>
 #include <intervals/utility.hpp>
 
 
@@ -22,6 +30,51 @@ namespace detail {
 
 struct sentinel { };
 
+    // Partition points of  always(predicate(x))  and  possibly(predicate(x))  for a predicate which returns `set<bool>`. Both
+    // binary searches bisect the same subrange as long as the predicate yields `true` or `false`, so every evaluation of the
+    // predicate is used for both of them. The searches diverge at the first element for which the predicate is contingent
+    // (or vacuous); each search then continues in its own part of the remaining subrange.
+template <typename R, typename PredicateT>
+[[nodiscard]] constexpr auto
+set_partition_points(R& range, PredicateT& predicate)
+{
+    auto first = std::ranges::begin(range);
+    auto count = std::ranges::distance(range);
+    while (count > 0)
+    {
+        auto half = count/2;
+        auto mid = first + half;
+        auto p = set<bool>(predicate(*mid));
+        bool alwaysTrue = intervals::always(p);
+        bool possiblyTrue = intervals::possibly(p);
+        if (alwaysTrue && possiblyTrue)
+        {
+            first = mid + 1;
+            count -= half + 1;
+        }
+        else if (!alwaysTrue && !possiblyTrue)
+        {
+            count = half;
+        }
+        else
+        {
+            auto last = first + count;
+            auto always_ = [&predicate](auto const& value) { return intervals::always(predicate(value)); };
+            auto possibly_ = [&predicate](auto const& value) { return intervals::possibly(predicate(value)); };
+            if (possiblyTrue)
+            {
+                return std::pair{ std::ranges::partition_point(first, mid, always_), std::ranges::partition_point(mid + 1, last, possibly_) };
+            }
+            else
+            {
+                return std::pair{ std::ranges::partition_point(mid + 1, last, always_), std::ranges::partition_point(first, mid, possibly_) };
+            }
+        }
+    }
+    return std::pair{ first, first };
+}
+
+
 template <typename T>
 struct single_value_iterator
 {
@@ -115,14 +168,11 @@ struct set_value_iterator
     {
         gsl_Expects(!exhausted);
 
-        while (++index != gsl::ssize(set<T>::values))
-        {
-            if (value().contains_index(index))
-            {
-                return *this;
-            }
-        }
-        exhausted = true;
+            // Skip directly to the next bit that is set.
+        constexpr auto n = std::size_t(set<T>::num_values);
+        auto next = detail::set_next_index<n>(value().state_, std::size_t(index + 1));
+        index = gsl::index(next);
+        exhausted = next == n;
         return *this;
     }
     constexpr set_value_iterator
@@ -159,6 +209,71 @@ struct set_value_range
     }
 };
 
+template <int Min, int Max>
+struct int_set_value_iterator
+{
+    using difference_type = std::ptrdiff_t;
+    using value_type = int;
+    using pointer = int const*;
+    using reference = int const&;
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::input_iterator_tag;
+
+    static constexpr std::size_t n = std::size_t(Max - Min) + 1;
+
+    set_words<n> bits = { };
+    std::size_t index = n;
+
+    [[nodiscard]] friend constexpr bool
+    operator ==(sentinel, int_set_value_iterator const& it)
+    {
+        return it.index == n;
+    }
+    [[nodiscard]] friend constexpr bool
+    operator ==(int_set_value_iterator const& it, sentinel)
+    {
+        return it.index == n;
+    }
+    constexpr int_set_value_iterator&
+    operator ++()
+    {
+        gsl_Expects(index != n);
+
+        index = detail::set_next_index<n>(bits, index + 1);
+        return *this;
+    }
+    constexpr int_set_value_iterator
+    operator ++(int)
+    {
+        auto result = *this;
+        ++*this;
+        return result;
+    }
+    [[nodiscard]] constexpr int
+    operator *() const
+    {
+        gsl_Expects(index != n);
+
+        return Min + int(index);
+    }
+};
+template <int Min, int Max>
+struct int_set_value_range
+{
+    set_words<std::size_t(Max - Min) + 1> bits;
+
+    [[nodiscard]] constexpr int_set_value_iterator<Min, Max>
+    begin() const
+    {
+        return { .bits = bits, .index = detail::set_next_index<std::size_t(Max - Min) + 1>(bits, 0) };
+    }
+    [[nodiscard]] constexpr sentinel
+    end() const
+    {
+        return { };
+    }
+};
+
 template <typename T>
 struct interval_value_iterator
 {
@@ -291,6 +406,108 @@ public:
 };
 
 
+    // Arguments of functions wrapped with `scalar_fast_path()`: intervals with coinciding bounds and sets with a single
+    // element are degenerate and are passed as scalars; all other arguments are passed unchanged.
+template <typename T>
+constexpr bool
+is_degenerate_arg(T const& arg)
+{
+    if constexpr (any_interval<T>)
+    {
+        return detail::degenerate(arg);
+    }
+    else if constexpr (makeshift::is_instantiation_of_v<T, set>)
+    {
+        int count = 0;
+        for (std::uint64_t word : arg.to_words())
+        {
+            count += std::popcount(word);
+        }
+        return count == 1;
+    }
+    else
+    {
+        return true;
+    }
+}
+template <typename T>
+constexpr decltype(auto)
+as_scalar_arg(T&& arg)
+{
+    using U = std::remove_cvref_t<T>;
+    if constexpr (any_interval<U>)
+    {
+        return detail::lower(arg);
+    }
+    else if constexpr (makeshift::is_instantiation_of_v<U, set>)
+    {
+        return arg.value();
+    }
+    else
+    {
+        return std::forward<T>(arg);
+    }
+}
+template <typename T>
+using scalar_arg_t = decltype(detail::as_scalar_arg(std::declval<T>()));
+
+    // Intervals are passed as scalars only if their bounds are rounded to nearest and not padded; for other rounding policies,
+    // the scalar call would lose the outward rounding which makes the result an enclosure.
+template <typename T>
+constexpr bool
+admits_scalar_arg()
+{
+    using U = std::remove_cvref_t<T>;
+    if constexpr (any_interval<U>)
+    {
+        using Policy = interval_arg_policy_t<U>;
+        return std::derived_from<Policy, no_rounding> && !requires { typename Policy::ulp_bounds; };
+    }
+    else
+    {
+        return true;
+    }
+}
+
+template <typename F>
+class scalar_fast_path_fn
+{
+private:
+    F f_;
+
+public:
+    explicit constexpr scalar_fast_path_fn(F f)
+        : f_(std::move(f))
+    {
+    }
+
+    template <typename... ArgsT>
+    requires std::invocable<F const&, ArgsT...>
+    constexpr std::invoke_result_t<F const&, ArgsT...>
+    operator ()(ArgsT&&... args) const
+    {
+        using Result = std::invoke_result_t<F const&, ArgsT...>;
+
+        if constexpr ((detail::admits_scalar_arg<ArgsT>() && ...) && std::invocable<F const&, scalar_arg_t<ArgsT>...>)
+        {
+            if ((detail::is_degenerate_arg(args) && ...))
+            {
+                if constexpr (std::is_void_v<Result>)
+                {
+                    std::invoke(f_, detail::as_scalar_arg(std::forward<ArgsT>(args))...);
+                    return;
+                }
+                else
+                {
+                    return Result(std::invoke(f_, detail::as_scalar_arg(std::forward<ArgsT>(args))...));
+                }
+            }
+        }
+        return std::invoke(f_, std::forward<ArgsT>(args)...);
+    }
+};
+
+
 } // namespace detail
 
 } // namespace intervals
@@ -0,0 +1,254 @@
+
+#ifndef INCLUDED_INTERVALS_DETAIL_BOOL_SET_ARRAY_HPP_
+#define INCLUDED_INTERVALS_DETAIL_BOOL_SET_ARRAY_HPP_
+
+
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint64_t
+#include <concepts>     // for same_as<>
+
+#include <gsl-lite/gsl-lite.hpp>  // for dim, narrow_cast<>(), gsl_Expects()
+
+#include <intervals/set.hpp>
+
+#include <intervals/detail/interval_array.hpp>  // for aligned_allocator<>, interval_array_alignment
+
+
+namespace intervals {
+
+namespace gsl = gsl_lite;
+
+
+class bool_set_array;
+
+
+namespace detail {
+
+
+    // `bool_set_array` stores the 4-valued Kleene logic states of its elements (cf. detail/set.hpp) in two bit planes: the  i -th
+    // bit of the "false" plane is set if the  i -th element may be `false`, and the  i -th bit of the "true" plane is set if it may
+    // be `true`. The planes are stored as arrays of 64-bit words. Bits beyond the size of the array are always zero, i.e. they
+    // represent unassigned elements.
+constexpr std::size_t bool_set_word_bits = 64;
+
+constexpr std::size_t
+bool_set_word_count(std::size_t n) noexcept
+{
+    return (n + bool_set_word_bits - 1)/bool_set_word_bits;
+}
+
+    // Mask of the bits of the last word which represent elements of an array of size  n .
+constexpr std::uint64_t
+bool_set_tail_mask(std::size_t n) noexcept
+{
+    std::size_t r = n % bool_set_word_bits;
+    return r == 0 ? ~std::uint64_t(0) : (std::uint64_t(1) << r) - 1;
+}
+
+
+    // Pair of bit plane words as returned by the word-wise kernels.
+struct bool_set_words
+{
+    std::uint64_t false_bits;
+    std::uint64_t true_bits;
+};
+
+template <typename X>
+concept bool_set_array_operand =
+    std::same_as<X, bool_set_array>
+    || std::same_as<X, set<bool>>
+    || std::same_as<X, bool>;
+template <typename X, typename Y>
+concept bool_set_array_operands =
+    (std::same_as<X, bool_set_array> || std::same_as<Y, bool_set_array>)
+    && bool_set_array_operand<X> && bool_set_array_operand<Y>;
+
+
+    // Operand adapters for the word-wise kernels. Array operands are accessed by index, `set<bool>` and `bool` operands are
+    // broadcast to all bits.
+struct bool_set_array_words
+{
+    std::uint64_t const* f;
+    std::uint64_t const* t;
+
+    constexpr std::uint64_t false_bits(std::size_t i) const { return f[i]; }
+    constexpr std::uint64_t true_bits(std::size_t i) const { return t[i]; }
+};
+struct bool_set_broadcast_words
+{
+    std::uint64_t f;
+    std::uint64_t t;
+
+    constexpr std::uint64_t false_bits(std::size_t) const { return f; }
+    constexpr std::uint64_t true_bits(std::size_t) const { return t; }
+};
+
+
+    // The following kernels compute 64 elements of the result of a logical operation at once. They implement the truth tables
+    // in detail/set.hpp: a result may be `true` (or `false`) if there is a pair of possible operand values for which the
+    // operation yields `true` (or `false`), and it is unassigned if either operand is unassigned.
+
+constexpr inline struct _and_bool_sets_t
+{
+    constexpr inline bool_set_words
+    operator ()(std::uint64_t xf, std::uint64_t xt, std::uint64_t yf, std::uint64_t yt) const noexcept
+    {
+        return { (xf & (yf | yt)) | (yf & (xf | xt)), xt & yt };
+    }
+} and_bool_sets;
+constexpr inline struct _or_bool_sets_t
+{
+    constexpr inline bool_set_words
+    operator ()(std::uint64_t xf, std::uint64_t xt, std::uint64_t yf, std::uint64_t yt) const noexcept
+    {
+        return { xf & yf, (xt & (yf | yt)) | (yt & (xf | xt)) };
+    }
+} or_bool_sets;
+constexpr inline struct _xor_bool_sets_t
+{
+    constexpr inline bool_set_words
+    operator ()(std::uint64_t xf, std::uint64_t xt, std::uint64_t yf, std::uint64_t yt) const noexcept
+    {
+        return { (xf & yf) | (xt & yt), (xf & yt) | (xt & yf) };
+    }
+} xor_bool_sets;
+constexpr inline struct _not_bool_sets_t
+{
+    constexpr inline bool_set_words
+    operator ()(std::uint64_t xf, std::uint64_t xt) const noexcept
+    {
+        return { xt, xf };
+    }
+} not_bool_sets;
+
+    // The predicate kernels yield definite truth values. Bits beyond the size of the array are cleared afterwards.
+constexpr inline struct _possibly_bool_sets_t
+{
+    constexpr inline bool_set_words
+    operator ()(std::uint64_t, std::uint64_t xt) const noexcept
+    {
+        return { ~xt, xt };
+    }
+} possibly_bool_sets;
+constexpr inline struct _possibly_not_bool_sets_t
+{
+    constexpr inline bool_set_words
+    operator ()(std::uint64_t xf, std::uint64_t) const noexcept
+    {
+        return { ~xf, xf };
+    }
+} possibly_not_bool_sets;
+constexpr inline struct _always_bool_sets_t
+{
+    constexpr inline bool_set_words
+    operator ()(std::uint64_t xf, std::uint64_t) const noexcept
+    {
+        return { xf, ~xf };
+    }
+} always_bool_sets;
+constexpr inline struct _never_bool_sets_t
+{
+    constexpr inline bool_set_words
+    operator ()(std::uint64_t, std::uint64_t xt) const noexcept
+    {
+        return { xt, ~xt };
+    }
+} never_bool_sets;
+constexpr inline struct _contingent_bool_sets_t
+{
+    constexpr inline bool_set_words
+    operator ()(std::uint64_t xf, std::uint64_t xt) const noexcept
+    {
+        return { ~(xf & xt), xf & xt };
+    }
+} contingent_bool_sets;
+constexpr inline struct _vacuous_bool_sets_t
+{
+    constexpr inline bool_set_words
+    operator ()(std::uint64_t xf, std::uint64_t xt) const noexcept
+    {
+        return { xf | xt, ~(xf | xt) };
+    }
+} vacuous_bool_sets;
+
+
+    // Apply the word-wise kernel  f  to the operands and store the resulting words in  rf  and  rt .
+template <typename F, typename X>
+inline void
+_transform_words(std::size_t n, std::uint64_t* rf, std::uint64_t* rt, F f, X x)
+{
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        bool_set_words r = f(x.false_bits(i), x.true_bits(i));
+        rf[i] = r.false_bits;
+        rt[i] = r.true_bits;
+    }
+}
+template <typename F, typename X, typename Y>
+inline void
+_transform_words(std::size_t n, std::uint64_t* rf, std::uint64_t* rt, F f, X x, Y y)
+{
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        bool_set_words r = f(x.false_bits(i), x.true_bits(i), y.false_bits(i), y.true_bits(i));
+        rf[i] = r.false_bits;
+        rt[i] = r.true_bits;
+    }
+}
+
+
+struct bool_set_array_access
+{
+    [[nodiscard]] static bool_set_array_words
+    operand(bool_set_array const& x) noexcept;
+    [[nodiscard]] static constexpr bool_set_broadcast_words
+    operand(set<bool> x) noexcept
+    {
+        auto bits = x.to_bits();
+        return { (bits & 1) != 0 ? ~std::uint64_t(0) : 0, (bits & 2) != 0 ? ~std::uint64_t(0) : 0 };
+    }
+    [[nodiscard]] static constexpr bool_set_broadcast_words
+    operand(bool x) noexcept
+    {
+        return operand(set<bool>(x));
+    }
+
+    [[nodiscard]] static gsl::dim
+    size(bool_set_array const& x) noexcept;
+    template <typename X>
+    requires (!std::same_as<X, bool_set_array>)
+    [[nodiscard]] static constexpr gsl::dim
+    size(X const&) noexcept
+    {
+        return -1;
+    }
+
+    static void
+    clear_tail(bool_set_array& x) noexcept;
+
+        // Construct an array of  n  elements whose bit planes are filled by  g(false_bits, true_bits) .
+    template <typename G>
+    [[nodiscard]] static bool_set_array
+    generate(gsl::dim n, G g);
+
+    template <typename F>
+    [[nodiscard]] static bool_set_array
+    apply(F f, bool_set_array const& x);
+    template <typename F, typename X, typename Y>
+    [[nodiscard]] static bool_set_array
+    apply(F f, X const& x, Y const& y);
+
+        // Kleene disjunction and conjunction of all elements.
+    [[nodiscard]] static set<bool>
+    any_of(bool_set_array const& x) noexcept;
+    [[nodiscard]] static set<bool>
+    all_of(bool_set_array const& x) noexcept;
+};
+
+
+} // namespace detail
+
+} // namespace intervals
+
+
+#endif // INCLUDED_INTERVALS_DETAIL_BOOL_SET_ARRAY_HPP_
@@ -8,6 +8,8 @@
 #include <intervals/concepts.hpp>
 #include <intervals/type_traits.hpp>
 
+#include <intervals/detail/rounding.hpp>  // for assumes_finite<>
+
 
 namespace intervals {
 
@@ -43,6 +45,11 @@ template <typename... Ts>
 concept floating_point_operands =
     (interval_arg<Ts> && ...) && floating_point_interval_value<common_interval_value_t<Ts...>>;
 
+    // Floating-point operands which may have infinite bounds (cf. `finite_only_policy<>`).
+template <typename... Ts>
+concept special_value_operands =
+    floating_point_operands<Ts...> && !assumes_finite<common_interval_policy_t<Ts...>>;
+
 
 }  // namespace detail
 
@@ -12,7 +12,8 @@
 namespace intervals {
 
 
-template <typename T> class interval;
+struct no_rounding;
+template <typename T, typename PolicyT = no_rounding> class interval;
 template <typename T, typename ReflectorT> class set;
 
 
@@ -0,0 +1,384 @@
+
+#ifndef INCLUDED_INTERVALS_DETAIL_EXPRESSION_HPP_
+#define INCLUDED_INTERVALS_DETAIL_EXPRESSION_HPP_
+
+
+#include <limits>
+#include <concepts>     // for derived_from<>
+#include <type_traits>  // for remove_cvref<>
+
+#include <intervals/math.hpp>  // for min(), max()
+#include <intervals/concepts.hpp>
+#include <intervals/type_traits.hpp>
+
+#include <intervals/detail/interval.hpp>  // for lower(), upper(), assigned(), divide_classified<>()
+
+
+namespace intervals {
+
+namespace detail {
+
+
+    //
+    // Nodes of a lazily evaluated interval expression (cf. `lazy()`). Every node has the member functions
+    //
+    //     _assigned()       returns whether all operands are assigned;
+    //     _bounds(check)    computes the bounds with the arithmetic of the rounding policy but without any handling of special
+    //                       values, and accumulates the widths of the operands and of all intermediate results in `check`;
+    //     _evaluate()       computes the value with the interval operators.
+    //
+    // If all bounds are finite and no divisor contains 0, the special-value checks of the interval operators never apply,
+    // and hence `_bounds()` and `_evaluate()` produce the same result. The kernels below therefore mirror the respective
+    // interval operators, including their special cases for scalar operands.
+    //
+    // A non-finite bound makes the accumulated width infinite or NaN, as does a divisor which contains 0. Checking the
+    // finiteness of `check` once after evaluation is much cheaper than testing every intermediate result. (The sum may also
+    // overflow for huge finite widths, in which case the expression is needlessly but correctly re-evaluated.)
+    //
+
+
+template <typename T>
+struct lazy_bounds
+{
+    T lower;
+    T upper;
+};
+
+template <typename T>
+constexpr void
+accumulate_width(T& check, lazy_bounds<T> const& x) noexcept
+{
+    check += x.upper - x.lower;
+}
+
+
+class lazy_functions;
+
+template <typename X>
+concept lazy_node = std::derived_from<std::remove_cvref_t<X>, lazy_functions>;
+
+template <typename X>
+concept lazy_operand = lazy_node<X> || floating_point_interval<X> || arithmetic_interval_value<X>;
+
+
+template <typename X>
+class lazy_terminal;
+template <typename OpT, typename X>
+class lazy_unary;
+template <typename OpT, typename L, typename R>
+class lazy_binary;
+
+template <typename X> struct lazy_node_of_ { using type = lazy_terminal<X>; };
+template <lazy_node X> struct lazy_node_of_<X> { using type = X; };
+template <floating_point_interval X> struct lazy_node_of_<X> { using type = lazy_terminal<interval_t<X>>; };
+template <typename X> using lazy_node_of_t = typename lazy_node_of_<std::remove_cvref_t<X>>::type;
+
+
+struct lazy_negate
+{
+    template <typename PolicyT, typename T>
+    static constexpr lazy_bounds<T>
+    bounds(lazy_bounds<T> x, T&) noexcept
+    {
+        return { -x.upper, -x.lower };
+    }
+    template <typename X>
+    static constexpr auto
+    apply(X const& x)
+    {
+        return -x;
+    }
+};
+struct lazy_add
+{
+    template <typename PolicyT, bool XScalar, bool YScalar, typename T>
+    static constexpr lazy_bounds<T>
+    bounds(lazy_bounds<T> x, lazy_bounds<T> y, T&)
+    {
+        return { PolicyT::add_down(x.lower, y.lower), PolicyT::add_up(x.upper, y.upper) };
+    }
+    template <typename X, typename Y>
+    static constexpr auto
+    apply(X const& x, Y const& y)
+    {
+        return x + y;
+    }
+};
+struct lazy_subtract
+{
+    template <typename PolicyT, bool XScalar, bool YScalar, typename T>
+    static constexpr lazy_bounds<T>
+    bounds(lazy_bounds<T> x, lazy_bounds<T> y, T&)
+    {
+        return { PolicyT::sub_down(x.lower, y.upper), PolicyT::sub_up(x.upper, y.lower) };
+    }
+    template <typename X, typename Y>
+    static constexpr auto
+    apply(X const& x, Y const& y)
+    {
+        return x - y;
+    }
+};
+struct lazy_multiply
+{
+    template <typename PolicyT, bool XScalar, bool YScalar, typename T>
+    static constexpr lazy_bounds<T>
+    bounds(lazy_bounds<T> x, lazy_bounds<T> y, T&)
+    {
+        T a = x.lower;
+        T b = x.upper;
+        T c = y.lower;
+        T d = y.upper;
+        if constexpr (XScalar)
+        {
+            return {
+                intervals::min(PolicyT::mul_down(a, c), PolicyT::mul_down(a, d)),
+                intervals::max(PolicyT::mul_up(a, c), PolicyT::mul_up(a, d))
+            };
+        }
+        else if constexpr (YScalar)
+        {
+            return {
+                intervals::min(PolicyT::mul_down(a, c), PolicyT::mul_down(b, c)),
+                intervals::max(PolicyT::mul_up(a, c), PolicyT::mul_up(b, c))
+            };
+        }
+        else
+        {
+            return {
+                intervals::min(intervals::min(PolicyT::mul_down(a, c), PolicyT::mul_down(a, d)), intervals::min(PolicyT::mul_down(b, c), PolicyT::mul_down(b, d))),
+                intervals::max(intervals::max(PolicyT::mul_up(a, c), PolicyT::mul_up(a, d)), intervals::max(PolicyT::mul_up(b, c), PolicyT::mul_up(b, d)))
+            };
+        }
+    }
+    template <typename X, typename Y>
+    static constexpr auto
+    apply(X const& x, Y const& y)
+    {
+        return x*y;
+    }
+};
+struct lazy_divide
+{
+    template <typename PolicyT, bool XScalar, bool YScalar, typename T>
+    static constexpr lazy_bounds<T>
+    bounds(lazy_bounds<T> x, lazy_bounds<T> y, T& check)
+    {
+        T a = x.lower;
+        T b = x.upper;
+        T c = y.lower;
+        T d = y.upper;
+
+            // Division by an interval which contains 0 is left to the interval operator.
+        if (!((c > 0) | (d < 0)))
+        {
+            check = std::numeric_limits<T>::quiet_NaN();
+        }
+
+        if constexpr (XScalar)
+        {
+            return {
+                intervals::min(PolicyT::div_down(a, c), PolicyT::div_down(a, d)),
+                intervals::max(PolicyT::div_up(a, c), PolicyT::div_up(a, d))
+            };
+        }
+        else if constexpr (YScalar)
+        {
+            return {
+                intervals::min(PolicyT::div_down(a, c), PolicyT::div_down(b, c)),
+                intervals::max(PolicyT::div_up(a, c), PolicyT::div_up(b, c))
+            };
+        }
+        else
+        {
+            bool xP = 0 <= a;
+            bool xN = !xP & (b <= 0);
+            return divide_classified<lazy_bounds<T>, PolicyT>(a, b, c, d, xP, xN);
+        }
+    }
+    template <typename X, typename Y>
+    static constexpr auto
+    apply(X const& x, Y const& y)
+    {
+        return x/y;
+    }
+};
+
+
+class lazy_functions
+{
+private:
+    template <typename X>
+    static constexpr lazy_node_of_t<X>
+    _node(X const& x)
+    {
+        return lazy_node_of_t<X>(x);
+    }
+
+public:
+    template <lazy_node X>
+    [[nodiscard]] friend constexpr auto
+    operator +(X const& x)
+    {
+        return x;
+    }
+    template <lazy_node X>
+    [[nodiscard]] friend constexpr auto
+    operator -(X const& x)
+    {
+        return lazy_unary<lazy_negate, std::remove_cvref_t<X>>(x);
+    }
+
+    template <typename X, typename Y>
+    requires (lazy_node<X> || lazy_node<Y>) && lazy_operand<X> && lazy_operand<Y>
+    [[nodiscard]] friend constexpr auto
+    operator +(X const& x, Y const& y)
+    {
+        return lazy_binary<lazy_add, lazy_node_of_t<X>, lazy_node_of_t<Y>>(_node(x), _node(y));
+    }
+    template <typename X, typename Y>
+    requires (lazy_node<X> || lazy_node<Y>) && lazy_operand<X> && lazy_operand<Y>
+    [[nodiscard]] friend constexpr auto
+    operator -(X const& x, Y const& y)
+    {
+        return lazy_binary<lazy_subtract, lazy_node_of_t<X>, lazy_node_of_t<Y>>(_node(x), _node(y));
+    }
+    template <typename X, typename Y>
+    requires (lazy_node<X> || lazy_node<Y>) && lazy_operand<X> && lazy_operand<Y>
+    [[nodiscard]] friend constexpr auto
+    operator *(X const& x, Y const& y)
+    {
+        return lazy_binary<lazy_multiply, lazy_node_of_t<X>, lazy_node_of_t<Y>>(_node(x), _node(y));
+    }
+    template <typename X, typename Y>
+    requires (lazy_node<X> || lazy_node<Y>) && lazy_operand<X> && lazy_operand<Y>
+    [[nodiscard]] friend constexpr auto
+    operator /(X const& x, Y const& y)
+    {
+        return lazy_binary<lazy_divide, lazy_node_of_t<X>, lazy_node_of_t<Y>>(_node(x), _node(y));
+    }
+};
+
+
+    // Leaf node holding an interval or a scalar value by copy.
+template <typename X>
+class lazy_terminal : public lazy_functions
+{
+private:
+    X value_;
+
+public:
+    using arg_type = X;
+    using interval_type = common_interval_t<X>;
+    static constexpr bool scalar = interval_value<X>;
+
+    explicit constexpr lazy_terminal(X const& _value)
+        : value_(_value)
+    {
+    }
+
+    [[nodiscard]] constexpr bool
+    _assigned() const noexcept
+    {
+        return detail::assigned(value_);
+    }
+    template <typename PolicyT, typename T>
+    [[nodiscard]] constexpr lazy_bounds<T>
+    _bounds(T& check) const noexcept
+    {
+        auto result = lazy_bounds<T>{ T(detail::lower(value_)), T(detail::upper(value_)) };
+        if constexpr (!scalar)
+        {
+            detail::accumulate_width(check, result);
+        }
+        else
+        {
+            check += result.lower - result.lower;
+        }
+        return result;
+    }
+    [[nodiscard]] constexpr X const&
+    _evaluate() const noexcept
+    {
+        return value_;
+    }
+};
+
+template <typename OpT, typename X>
+class lazy_unary : public lazy_functions
+{
+private:
+    X arg_;
+
+public:
+    using arg_type = typename X::interval_type;
+    using interval_type = arg_type;
+    static constexpr bool scalar = false;
+
+    explicit constexpr lazy_unary(X const& _arg)
+        : arg_(_arg)
+    {
+    }
+
+    [[nodiscard]] constexpr bool
+    _assigned() const noexcept
+    {
+        return arg_._assigned();
+    }
+    template <typename PolicyT, typename T>
+    [[nodiscard]] constexpr lazy_bounds<T>
+    _bounds(T& check) const
+    {
+        return OpT::template bounds<PolicyT>(arg_.template _bounds<PolicyT, T>(check), check);
+    }
+    [[nodiscard]] constexpr interval_type
+    _evaluate() const
+    {
+        return interval_type(OpT::apply(arg_._evaluate()));
+    }
+};
+
+template <typename OpT, typename L, typename R>
+class lazy_binary : public lazy_functions
+{
+private:
+    L lhs_;
+    R rhs_;
+
+public:
+    using arg_type = common_interval_t<typename L::arg_type, typename R::arg_type>;
+    using interval_type = arg_type;
+    static constexpr bool scalar = false;
+
+    explicit constexpr lazy_binary(L const& _lhs, R const& _rhs)
+        : lhs_(_lhs), rhs_(_rhs)
+    {
+    }
+
+    [[nodiscard]] constexpr bool
+    _assigned() const noexcept
+    {
+        return lhs_._assigned() & rhs_._assigned();
+    }
+    template <typename PolicyT, typename T>
+    [[nodiscard]] constexpr lazy_bounds<T>
+    _bounds(T& check) const
+    {
+        auto result = OpT::template bounds<PolicyT, L::scalar, R::scalar>(lhs_.template _bounds<PolicyT, T>(check), rhs_.template _bounds<PolicyT, T>(check), check);
+        detail::accumulate_width(check, result);
+        return result;
+    }
+    [[nodiscard]] constexpr interval_type
+    _evaluate() const
+    {
+        return interval_type(OpT::apply(lhs_._evaluate(), rhs_._evaluate()));
+    }
+};
+
+
+} // namespace detail
+
+} // namespace intervals
+
+
+#endif // INCLUDED_INTERVALS_DETAIL_EXPRESSION_HPP_
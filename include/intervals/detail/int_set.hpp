@@ -0,0 +1,90 @@
+
+#ifndef INCLUDED_INTERVALS_DETAIL_INT_SET_HPP_
+#define INCLUDED_INTERVALS_DETAIL_INT_SET_HPP_
+
+
+#include <bit>          // for countl_zero(), countr_zero()
+#include <cstddef>      // for size_t, ptrdiff_t
+#include <cstdint>      // for uint64_t
+
+#include <intervals/detail/set.hpp>  // for set_words<>, set_word_count()
+
+
+namespace intervals {
+
+namespace detail {
+
+
+    // `int_set<Min, Max>` stores its elements in a `set_words<N>` bit mask with  N = Max - Min + 1 ; bit  i  stands for the
+    // value  Min + i . The following functions operate on the words of such bit masks.
+
+    // Index of the highest bit which is set, or  -1  if there is none.
+template <std::size_t N>
+[[nodiscard]] constexpr std::ptrdiff_t
+int_set_last_index(set_words<N> const& s) noexcept
+{
+    for (std::size_t w = s.words.size(); w-- != 0; )
+    {
+        if (s.words[w] != 0)
+        {
+            return std::ptrdiff_t(64*w + 63) - std::countl_zero(s.words[w]);
+        }
+    }
+    return -1;
+}
+
+    // Move every bit  i  to bit  i + k ; bits moved outside of the mask are discarded.
+template <std::size_t N, std::size_t M>
+[[nodiscard]] constexpr set_words<N>
+int_set_shift(set_words<M> const& s, std::ptrdiff_t k) noexcept
+{
+    constexpr auto numWords = std::ptrdiff_t(set_word_count(N));
+    constexpr auto numSourceWords = std::ptrdiff_t(set_word_count(M));
+
+    auto result = set_words<N>{ };
+    std::ptrdiff_t wordShift = k >= 0 ? k/64 : -((-k + 63)/64);
+    int bitShift = int(k - 64*wordShift);  // in [0, 64)
+    for (std::ptrdiff_t w = 0; w != numWords; ++w)
+    {
+        std::ptrdiff_t src = w - wordShift;
+        std::uint64_t lo = src >= 0 && src < numSourceWords ? s.words[src] : 0;
+        std::uint64_t hi = src - 1 >= 0 && src - 1 < numSourceWords ? s.words[src - 1] : 0;
+        result.words[w] = bitShift == 0 ? lo : (lo << bitShift) | (hi >> (64 - bitShift));
+    }
+    if constexpr (N % 64 != 0)
+    {
+        result.words.back() &= (std::uint64_t(1) << (N % 64)) - 1;
+    }
+    return result;
+}
+
+    // Mask of the bits with indices in  [first, last] , clipped to  [0, N) .
+template <std::size_t N>
+[[nodiscard]] constexpr set_words<N>
+int_set_range_mask(std::ptrdiff_t first, std::ptrdiff_t last) noexcept
+{
+    auto result = set_words<N>{ };
+    first = first < 0 ? 0 : first;
+    last = last >= std::ptrdiff_t(N) ? std::ptrdiff_t(N) - 1 : last;
+    for (std::ptrdiff_t w = 0; w != std::ptrdiff_t(result.words.size()); ++w)
+    {
+        std::ptrdiff_t lo = first - 64*w;
+        std::ptrdiff_t hi = last - 64*w;
+        if (hi < 0 || lo > 63 || first > last)
+        {
+            continue;
+        }
+        std::uint64_t loMask = lo <= 0 ? ~std::uint64_t(0) : ~std::uint64_t(0) << lo;
+        std::uint64_t hiMask = hi >= 63 ? ~std::uint64_t(0) : (std::uint64_t(1) << (hi + 1)) - 1;
+        result.words[w] = loMask & hiMask;
+    }
+    return result;
+}
+
+
+} // namespace detail
+
+} // namespace intervals
+
+
+#endif // INCLUDED_INTERVALS_DETAIL_INT_SET_HPP_
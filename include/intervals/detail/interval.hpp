@@ -4,10 +4,15 @@
 
 
 #include <cmath>
-#include <memory>     // for addressof()
-#include <concepts>   // for derived_from<>
-#include <iterator>   // for random_access_iterator<>
-#include <algorithm>  // for min(), max()
+#include <limits>
+#include <memory>       // for addressof()
+#include <utility>      // for pair<>
+#include <cstdint>      // for uint32_t
+#include <numbers>      // for pi_v<>
+#include <concepts>     // for derived_from<>
+#include <iterator>     // for random_access_iterator<>
+#include <algorithm>    // for min(), max()
+#include <type_traits>  // for conditional_t<>
 
 #include <gsl-lite/gsl-lite.hpp>  // for gsl_Assert(), gsl_AssertDebug()
 
@@ -15,13 +20,15 @@
 #include <intervals/logic.hpp>
 #include <intervals/concepts.hpp>
 
+#include <intervals/detail/math.hpp>      // for reduce_pio2(), sin_quadrant(), tan_quadrant()
+#include <intervals/detail/rounding.hpp>  // for libm_padding<>, pad_down(), pad_up()
 #include <intervals/detail/concepts-internal.hpp>
 
 
 namespace intervals {
 
 
-template <typename T> class interval;
+template <typename T, typename PolicyT> class interval;
 
 
 namespace detail {
@@ -207,6 +214,23 @@ constexpr inline struct _assigned_t
     }
 } assigned;
 
+    // Whether the argument is a scalar or an interval with coinciding bounds.
+constexpr inline struct _degenerate_t
+{
+    template <any_interval IntervalT>
+    constexpr inline bool
+    operator ()(IntervalT const& arg) const noexcept
+    {
+        return arg.lower_unchecked() == arg.upper_unchecked();  // also false for unassigned intervals and NaN bounds
+    }
+    template <interval_value T>
+    constexpr inline bool
+    operator ()(T const&) const noexcept
+    {
+        return true;
+    }
+} degenerate;
+
 constexpr inline struct _as_interval_t
 {
     template <any_interval IntervalArgT>
@@ -291,7 +315,7 @@ constexpr inline struct _matches_identity_t
 
 template <interval_arg L, interval_arg R = L>
 constexpr inline common_interval_t<L, R>
-nan_interval() noexcept
+nan_interval()
 {
     using T = common_interval_value_t<L, R>;
     if constexpr (detail::floating_point_operands<L, R>)
@@ -304,7 +328,7 @@ nan_interval() noexcept
 
 template <interval_arg L, interval_arg R = L>
 constexpr inline common_interval_t<L, R>
-inf_interval() noexcept
+inf_interval()
 {
     using T = common_interval_value_t<L, R>;
     if constexpr (detail::floating_point_operands<L, R>)
@@ -316,6 +340,234 @@ inf_interval() noexcept
 }
 
 
+    // Classification of an interval  [a,b]  by the signs of its bounds as per Hickey et al. (2001):
+    //
+    //     P : 0 ≤ a ≤ b
+    //     N : a < 0 ∧ b ≤ 0
+    //     M : a < 0 < b
+    //
+    // The classes  Z ,  P0 ,  P1  and  N0 ,  N1  of the original classification are merged into  P  and  N , respectively,
+    // because the quotients attaining the bounds of  [a,b]/[c,d]  for  0 ∉ [c,d]  only depend on the signs of  a  and  b .
+    //
+    // Table of the quotients attaining the bounds of  [a,b]/[c,d]  for  0 ∉ [c,d] . The lower bound of the result is attained
+    // by a quotient with numerator  a  if  c > 0  and  b  if  d < 0 , and the upper bound is attained by a quotient with
+    // numerator  b  if  c > 0  and  a  if  d < 0 . For a dividend of class  cx ∈ {P,N,M}  and a divisor of class  cy ∈ {P,N} ,
+    // the 2-bit entry at index  3⋅cy + cx  indicates the denominators (0: c, 1: d) of these quotients:
+    //
+    //     bit 0 : denominator of the quotient attaining the lower bound
+    //     bit 1 : denominator of the quotient attaining the upper bound
+    //
+    // For example,  [a,b]/[c,d] = [a/d, b/c]  for  (cx,cy) = (P,P) , and  [a,b]/[c,d] = [b/d, a/d]  for  (cx,cy) = (M,N) .
+    //
+    //                                   (cy,cx): |NM|NN|NP|PM|PN|PP|
+constexpr std::uint32_t lut_hickey_divide = 0b11'10'01'00'10'01u;
+
+    // Branch-free evaluation of `lut_hickey_divide`. Bit look-ups with variable shifts impede auto-vectorization, so the table
+    // is represented by an equivalent set of Boolean functions which compilers can map to SIMD mask operations.
+struct hickey_divide_selectors
+{
+    bool lo_d;  // bit 0
+    bool hi_d;  // bit 1
+
+    static constexpr hickey_divide_selectors
+    from_classes(bool xP, bool xN, bool yP) noexcept
+    {
+        return {
+            .lo_d = bool((yP & xP) | (!yP & !xN)),
+            .hi_d = bool((yP & xN) | (!yP & !xP))
+        };
+    }
+};
+constexpr bool
+_check_hickey_divide_selectors() noexcept
+{
+    for (unsigned cy = 0; cy != 2; ++cy)
+    {
+        for (unsigned cx = 0; cx != 3; ++cx)
+        {
+            auto s = hickey_divide_selectors::from_classes(cx == 0, cx == 1, cy == 0);
+            unsigned e = (lut_hickey_divide >> (2*(3*cy + cx))) & 0x3u;
+            if (e != (unsigned(s.lo_d) | unsigned(s.hi_d) << 1))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+static_assert(_check_hickey_divide_selectors());
+
+    // Compute the bounds of  [a,b]/[c,d]  for  0 ∉ [c,d]  with only two divisions. The dividend is classified by the Boolean
+    // arguments  xP  and  xN ; a NaN dividend must be passed as class  M , which yields NaN bounds. Special values must have
+    // been handled by the caller. The operands of the divisions are selected before dividing because some compilers would
+    // otherwise emit all four divisions under masks when vectorizing.
+template <typename ResultT, typename PolicyT, typename T>
+constexpr ResultT
+divide_classified(T a, T b, T c, T d, bool xP, bool xN) noexcept
+{
+    bool yP = c > T{ };
+    auto s = hickey_divide_selectors::from_classes(xP, xN, yP);
+    T lon = yP ? a : b;
+    T lod = s.lo_d ? d : c;
+    T hin = yP ? b : a;
+    T hid = s.hi_d ? d : c;
+    return ResultT{ PolicyT::div_down(lon, lod), PolicyT::div_up(hin, hid) };
+}
+
+    // Compute a lower (`Up = false`) or upper (`Up = true`) bound of  xⁿ  for  x ≥ 0  and  n > 0  by binary exponentiation.
+    // The multiplication by 1 is avoided because rounding policies may widen even exact products.
+template <bool Up, typename PolicyT, typename T>
+constexpr T
+pown_nonnegative(T x, unsigned n)
+{
+    auto mul = [](T a, T b)
+    {
+        if constexpr (Up) return PolicyT::mul_up(a, b);
+        else return PolicyT::mul_down(a, b);
+    };
+
+    while ((n & 1) == 0)
+    {
+        x = mul(x, x);
+        n >>= 1;
+    }
+    T result = x;
+    while ((n >>= 1) != 0)
+    {
+        x = mul(x, x);
+        if ((n & 1) != 0)
+        {
+            result = mul(result, x);
+        }
+    }
+    return result;
+}
+
+
+    // Reduction of an interval  [a,b]  for the trigonometric functions. The bounds are reduced to  a = k⋅π/2 + ra  and
+    // b = (k + span)⋅π/2 + rb  with  |ra|, |rb| ≲ π/4 , retaining only  quadrant = k mod 4 . Since  b - a < 2π , the
+    // difference  span  is determined by the quadrants of  a  and  b  up to a multiple of 4, which is resolved by comparing
+    // b - a  to  π . Intervals which span a full period or have non-finite bounds are marked by  span = -1 . Degenerate
+    // intervals  a = b  are reduced only once.
+template <std::floating_point T>
+struct reduced_angle_interval
+{
+    int quadrant;
+    int span;
+    constexpr_double_word<T> ra;
+    constexpr_double_word<T> rb;
+    bool degenerate;
+};
+template <std::floating_point T>
+constexpr reduced_angle_interval<T>
+reduce_angle_interval(T a, T b)
+{
+    constexpr T max = T(std::numeric_limits<double>::max());  // range of `reduce_pio2()`
+
+    auto result = reduced_angle_interval<T>{ 0, -1, { }, { }, false };
+    if (b - a < 2*std::numbers::pi_v<T> && constexpr_abs(a) <= max && constexpr_abs(b) <= max)
+    {
+        result.quadrant = detail::reduce_pio2(a, result.ra);
+        if (a == b)
+        {
+            result.span = 0;
+            result.rb = result.ra;
+            result.degenerate = true;
+            return result;
+        }
+        int qb = detail::reduce_pio2(b, result.rb);
+        result.span = (qb - result.quadrant) & 3;
+        if (result.span == 0 && b - a > std::numbers::pi_v<T>)
+        {
+            result.span = 4;
+        }
+    }
+    return result;
+}
+
+    // Classify the multiples  j⋅π/2  in the interval by their residue modulo 4: bit  t  of the result is set if the interval
+    // contains a multiple with  j ≡ t (mod 4) .
+template <std::floating_point T>
+constexpr unsigned
+pio2_multiples(reduced_angle_interval<T> const& x)
+{
+    int jlo = x.ra.hi > 0 ? 1 : 0;  // first and last multiple in  [a,b] , relative to  k
+    int jhi = x.span - (x.rb.hi < 0 ? 1 : 0);
+    int n = jhi - jlo + 1;
+    unsigned run = n <= 0 ? 0u : n >= 4 ? 0xFu : (1u << n) - 1;
+    int first = (x.quadrant + jlo) & 3;
+    return ((run << first) | (run >> (4 - first))) & 0xFu;
+}
+
+    // Compute the bounds of  sin(x + Shift⋅π/2)  for  x ∈ [a,b] , i.e. of  sin x  for  Shift = 0  and of  cos x  for
+    // Shift = 1 . The maxima and minima are at the multiples  j⋅π/2  with  j ≡ 1 - Shift  and  j ≡ 3 - Shift (mod 4) ,
+    // respectively; elsewhere, the bounds are attained at  a  or  b .
+template <typename ResultT, int Shift, std::floating_point T, std::floating_point U>
+constexpr ResultT
+sin_shifted_bounds(reduced_angle_interval<U> const& x, unsigned multiples)
+{
+    if (x.span < 0)
+    {
+        return ResultT{ T(-1), T(1) };
+    }
+    using Pad = libm_padding<typename ResultT::policy_type>;
+    constexpr ulp_bound bound = Shift == 0 ? Pad::sin : Pad::cos;
+
+        // For `float`, the bounds are padded after rounding to `T`, which costs at most another half ulp.
+    T va = T(detail::sin_quadrant(x.quadrant + Shift, x.ra));
+    T vb = x.degenerate ? va : T(detail::sin_quadrant(x.quadrant + x.span + Shift, x.rb));
+    return ResultT{
+        ((multiples >> ((3 - Shift) & 3)) & 1) != 0 ? T(-1) : detail::pad_down(va < vb ? va : vb, bound, T(-1)),
+        ((multiples >> ((1 - Shift) & 3)) & 1) != 0 ? T(1) : detail::pad_up(va < vb ? vb : va, bound, T(1))
+    };
+}
+template <typename ResultT, int Shift, std::floating_point T>
+constexpr ResultT
+sin_shifted(T a, T b)
+{
+    using U = std::conditional_t<constexpr_math_via_double<T>, double, T>;
+
+    auto x = detail::reduce_angle_interval(U(a), U(b));
+    return detail::sin_shifted_bounds<ResultT, Shift, T>(x, detail::pio2_multiples(x));
+}
+
+    // Compute the bounds of  sin x  and  cos x  for  x ∈ [a,b]  with a single reduction and classification.
+template <typename ResultT, std::floating_point T>
+constexpr std::pair<ResultT, ResultT>
+sincos_interval(T a, T b)
+{
+    using U = std::conditional_t<constexpr_math_via_double<T>, double, T>;
+
+    auto x = detail::reduce_angle_interval(U(a), U(b));
+    unsigned multiples = detail::pio2_multiples(x);
+    return {
+        detail::sin_shifted_bounds<ResultT, 0, T>(x, multiples),
+        detail::sin_shifted_bounds<ResultT, 1, T>(x, multiples)
+    };
+}
+
+    // Compute the bounds of  tan x  for  x ∈ [a,b] , which are unbounded if  [a,b]  contains an odd multiple of  π/2 .
+template <typename ResultT, std::floating_point T>
+constexpr ResultT
+tan_interval(T a, T b)
+{
+    using U = std::conditional_t<constexpr_math_via_double<T>, double, T>;
+    constexpr T inf = std::numeric_limits<T>::infinity();
+
+    auto x = detail::reduce_angle_interval(U(a), U(b));
+    if (x.span < 0 || (detail::pio2_multiples(x) & 0b1010u) != 0)  // odd multiples
+    {
+        return ResultT{ -inf, inf };
+    }
+    using Pad = libm_padding<typename ResultT::policy_type>;
+    T va = T(detail::tan_quadrant(x.quadrant, x.ra));
+    T vb = x.degenerate ? va : T(detail::tan_quadrant(x.quadrant + x.span, x.rb));
+
+        // Allow for slight numerical non-monotonicity of the `tan()` implementation, as might occur with an iterative implementation.
+    return ResultT::from_unordered_bounds(detail::pad_down(va, Pad::tan), detail::pad_up(vb, Pad::tan));
+}
+
+
 struct condition : set<bool>
 {
 };
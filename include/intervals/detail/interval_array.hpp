@@ -0,0 +1,753 @@
+
+#ifndef INCLUDED_INTERVALS_DETAIL_INTERVAL_ARRAY_HPP_
+#define INCLUDED_INTERVALS_DETAIL_INTERVAL_ARRAY_HPP_
+
+
+#include <new>          // for align_val_t
+#include <cmath>
+#include <limits>
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint64_t
+#include <utility>      // for forward<>()
+#include <concepts>     // for floating_point<>, derived_from<>, convertible_to<>, same_as<>
+#include <type_traits>  // for is_nothrow_default_constructible<>
+
+#include <gsl-lite/gsl-lite.hpp>  // for dim, narrow_cast<>(), gsl_Expects(), gsl_ExpectsDebug(), gsl_ExpectsAudit()
+
+#include <intervals/math.hpp>      // for min(), max()
+#include <intervals/concepts.hpp>  // for arithmetic<>
+#include <intervals/rounding.hpp>  // for no_rounding
+#include <intervals/interval.hpp>
+
+#include <intervals/detail/rounding.hpp>     // for next_down(), next_up()
+#include <intervals/detail/vector_math.hpp>
+
+
+namespace intervals {
+
+namespace gsl = gsl_lite;
+
+
+template <std::floating_point T> class interval_array;
+class bool_set_array;
+
+
+namespace detail {
+
+
+    // Alignment of the bound arrays of `interval_array<>`. 64 bytes is the size of a cache line on most current architectures
+    // and also suffices for the widest SIMD registers (AVX-512).
+constexpr std::size_t interval_array_alignment = 64;
+
+template <typename T, std::size_t Alignment>
+class aligned_allocator
+{
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = aligned_allocator<U, Alignment>;
+    };
+
+    aligned_allocator() = default;
+    template <typename U>
+    constexpr aligned_allocator(aligned_allocator<U, Alignment> const&) noexcept
+    {
+    }
+
+        // Value-initialization is replaced with default-initialization so that arrays of arithmetic types can be allocated
+        // without touching the memory.
+    template <typename U>
+    void
+    construct(U* p) noexcept(std::is_nothrow_default_constructible_v<U>)
+    {
+        ::new(static_cast<void*>(p)) U;
+    }
+    template <typename U, typename... ArgsT>
+    void
+    construct(U* p, ArgsT&&... args)
+    {
+        ::new(static_cast<void*>(p)) U(std::forward<ArgsT>(args)...);
+    }
+
+    [[nodiscard]] T*
+    allocate(std::size_t n)
+    {
+        return static_cast<T*>(::operator new(n*sizeof(T), std::align_val_t(Alignment)));
+    }
+    void
+    deallocate(T* p, std::size_t n) noexcept
+    {
+        ::operator delete(p, n*sizeof(T), std::align_val_t(Alignment));
+    }
+
+    template <typename U>
+    [[nodiscard]] constexpr bool
+    operator ==(aligned_allocator<U, Alignment> const&) const noexcept
+    {
+        return true;
+    }
+};
+
+
+    // Pair of interval bounds as returned by the element-wise kernels.
+template <typename T>
+struct bounds
+{
+    T lower;
+    T upper;
+};
+
+template <typename X, typename T>
+concept interval_array_operand =
+    std::same_as<X, interval_array<T>>
+    || std::derived_from<X, interval_base<T>>
+    || (arithmetic<X> && std::convertible_to<X, T>);
+template <typename X, typename Y, typename T>
+concept interval_array_operands =
+    (std::same_as<X, interval_array<T>> || std::same_as<Y, interval_array<T>>)
+    && interval_array_operand<X, T> && interval_array_operand<Y, T>;
+
+
+    // Operand adapters for the element-wise kernels. Array operands are accessed by index, scalar and interval operands are
+    // broadcast.
+template <typename T>
+struct array_operand
+{
+    T const* lo;
+    T const* hi;
+
+    constexpr T lower(std::size_t i) const { return lo[i]; }
+    constexpr T upper(std::size_t i) const { return hi[i]; }
+};
+template <typename T>
+struct broadcast_operand
+{
+    T lo;
+    T hi;
+
+    constexpr T lower(std::size_t) const { return lo; }
+    constexpr T upper(std::size_t) const { return hi; }
+};
+
+
+    // The following kernels compute the bounds of the result of an arithmetic operation from the bounds of its operands. They
+    // reproduce the results of the corresponding operations on `interval<>` exactly, including the propagation of NaN and
+    // infinite values, but avoid branches so that the loops in `_transform()` can be vectorized. A scalar operand  x  is
+    // passed as the degenerate interval  [x,x] ; the predicates below have been chosen such that they coincide with the
+    // special-value checks of the mixed scalar–interval operators in this case. (The only exception is the division of a NaN
+    // scalar by an interval containing 0 in its interior, for which  [NaN,NaN]  rather than  [-∞,∞]  is returned.)
+
+template <std::floating_point T>
+constexpr bounds<T>
+_select(bool c, bounds<T> x, bounds<T> y) noexcept
+{
+    return bounds<T>{ c ? x.lower : y.lower, c ? x.upper : y.upper };
+}
+
+constexpr inline struct _add_bounds_t
+{
+    template <std::floating_point T>
+    constexpr inline bounds<T>
+    operator ()(T a, T b, T c, T d) const noexcept
+    {
+        constexpr T inf = std::numeric_limits<T>::infinity();
+        constexpr T nan = std::numeric_limits<T>::quiet_NaN();
+
+        bool indefinite = ((a == -inf) & (d == inf)) | ((c == -inf) & (b == inf));  // -∞ + ∞
+        return _select(indefinite, bounds<T>{ nan, nan }, bounds<T>{ a + c, b + d });
+    }
+} add_bounds;
+constexpr inline struct _subtract_bounds_t
+{
+    template <std::floating_point T>
+    constexpr inline bounds<T>
+    operator ()(T a, T b, T c, T d) const noexcept
+    {
+        constexpr T inf = std::numeric_limits<T>::infinity();
+        constexpr T nan = std::numeric_limits<T>::quiet_NaN();
+
+        bool indefinite = ((a == -inf) & (c == -inf)) | ((d == inf) & (b == inf));  // -∞ - (-∞), ∞ - ∞
+        return _select(indefinite, bounds<T>{ nan, nan }, bounds<T>{ a - d, b - c });
+    }
+} subtract_bounds;
+constexpr inline struct _multiply_bounds_t
+{
+    template <std::floating_point T>
+    constexpr inline bounds<T>
+    operator ()(T a, T b, T c, T d) const noexcept
+    {
+        constexpr T inf = std::numeric_limits<T>::infinity();
+        constexpr T nan = std::numeric_limits<T>::quiet_NaN();
+
+        bool indefinite = (((a == -inf) | (b == inf)) & ((c <= 0) & (0 <= d)))  // ∞⋅0
+            | (((a <= 0) & (0 <= b)) & ((c == -inf) | (d == inf)));
+        T v1 = a*c;
+        T v2 = a*d;
+        T v3 = b*c;
+        T v4 = b*d;
+        return _select(indefinite,
+            bounds<T>{ nan, nan },
+            bounds<T>{ intervals::min(intervals::min(v1, v2), intervals::min(v3, v4)), intervals::max(intervals::max(v1, v2), intervals::max(v3, v4)) });
+    }
+} multiply_bounds;
+    // Division uses the sign classes of the operands (cf. `hickey_divide_selectors`) to compute the result with only two
+    // divisions. This is possible only if  0 ∉ [c,d] ; elements for which `fallback_required()` holds are recomputed with
+    // `fallback()` in a second pass (cf. `_transform()`).
+constexpr inline struct _divide_bounds_t
+{
+    template <std::floating_point T>
+    static constexpr bool
+    indefinite(T a, T b, T c, T d) noexcept
+    {
+        constexpr T inf = std::numeric_limits<T>::infinity();
+
+        return (((a == -inf) | (b == inf)) & ((c == -inf) | (d == inf)))  // ∞/∞
+            | (((a <= 0) & (0 <= b)) & ((c <= 0) & (0 <= d)));  // 0/0
+    }
+    template <std::floating_point T>
+    static constexpr bool
+    unbounded(T a, T b, T c, T d) noexcept
+    {
+        return ((0 < a) | (b < 0)) & ((c < 0) & (0 < d));  // [a,b]/0
+    }
+    template <std::floating_point T>
+    static constexpr bool
+    fallback_required(T a, T b, T c, T d) noexcept
+    {
+        return !((0 < c) | (d < 0)) & !indefinite(a, b, c, d) & !unbounded(a, b, c, d);
+    }
+
+    template <std::floating_point T>
+    static constexpr bounds<T>
+    fallback(T a, T b, T c, T d) noexcept
+    {
+        T v1 = a/c;
+        T v2 = a/d;
+        T v3 = b/c;
+        T v4 = b/d;
+        return bounds<T>{ intervals::min(intervals::min(v1, v2), intervals::min(v3, v4)), intervals::max(intervals::max(v1, v2), intervals::max(v3, v4)) };
+    }
+
+    template <std::floating_point T>
+    constexpr inline bounds<T>
+    operator ()(T a, T b, T c, T d) const noexcept
+    {
+        constexpr T inf = std::numeric_limits<T>::infinity();
+        constexpr T nan = std::numeric_limits<T>::quiet_NaN();
+
+            // A NaN dividend is treated as class  M , which yields NaN bounds.
+        bool xP = 0 <= a;
+        bool xN = !xP & (b <= 0);
+        return _select(indefinite(a, b, c, d),
+            bounds<T>{ nan, nan },
+            _select(unbounded(a, b, c, d),
+                bounds<T>{ -inf, inf },
+                detail::divide_classified<bounds<T>, no_rounding>(a, b, c, d, xP, xN)));
+    }
+} divide_bounds;
+constexpr inline struct _min_bounds_t
+{
+    template <std::floating_point T>
+    constexpr inline bounds<T>
+    operator ()(T a, T b, T c, T d) const noexcept
+    {
+        return bounds<T>{ intervals::min(a, c), intervals::min(b, d) };
+    }
+} min_bounds;
+constexpr inline struct _max_bounds_t
+{
+    template <std::floating_point T>
+    constexpr inline bounds<T>
+    operator ()(T a, T b, T c, T d) const noexcept
+    {
+        return bounds<T>{ intervals::max(a, c), intervals::max(b, d) };
+    }
+} max_bounds;
+constexpr inline struct _negate_bounds_t
+{
+    template <std::floating_point T>
+    constexpr inline bounds<T>
+    operator ()(T a, T b) const noexcept
+    {
+        return bounds<T>{ -b, -a };
+    }
+} negate_bounds;
+constexpr inline struct _square_bounds_t
+{
+    template <std::floating_point T>
+    constexpr inline bounds<T>
+    operator ()(T a, T b) const noexcept
+    {
+        T a2 = a*a;
+        T b2 = b*b;
+        return bounds<T>{ (a <= 0) & (b >= 0) ? T(0) : intervals::min(a2, b2), intervals::max(a2, b2) };
+    }
+} square_bounds;
+constexpr inline struct _abs_bounds_t
+{
+    template <std::floating_point T>
+    constexpr inline bounds<T>
+    operator ()(T a, T b) const noexcept
+    {
+        return _select((a <= 0) & (b >= 0),
+            bounds<T>{ 0, intervals::max(-a, b) },
+            _select(a < 0,
+                bounds<T>{ -b, -a },
+                bounds<T>{ a, b }));
+    }
+} abs_bounds;
+constexpr inline struct _sqrt_bounds_t
+{
+    template <std::floating_point T>
+    inline bounds<T>
+    operator ()(T a, T b) const noexcept
+    {
+        T sa = std::sqrt(a);
+        T sb = std::sqrt(b);
+        return bounds<T>{ intervals::min(sa, sb), intervals::max(sa, sb) };
+    }
+} sqrt_bounds;
+
+
+
+    //
+    // Kernels for the elementary functions. The bounds are computed with the polynomial kernels in detail/vector_math.hpp and
+    // widened by their error bound, so the results enclose the exact range of the function. (Unlike the results of the
+    // arithmetic kernels above, they are therefore not identical to those of the corresponding functions of `interval<>`.)
+    // `float` bounds are computed in `double` and rounded outward.
+    //
+
+    // Widen a kernel result  v  outward by the kernel error bound. Infinite results are exact.
+inline double
+_widen_down(double v) noexcept
+{
+    constexpr double inf = std::numeric_limits<double>::infinity();
+
+    double w = v - (v < 0 ? -v : v)*vector_math_error_bound;
+    return v == inf || v == -inf ? v : w;
+}
+inline double
+_widen_up(double v) noexcept
+{
+    constexpr double inf = std::numeric_limits<double>::infinity();
+
+    double w = v + (v < 0 ? -v : v)*vector_math_error_bound;
+    return v == inf || v == -inf ? v : w;
+}
+template <std::floating_point T>
+inline T
+_round_down(double x) noexcept
+{
+    if constexpr (std::same_as<T, double>)
+    {
+        return x;
+    }
+    else
+    {
+        T r = T(x);
+        return double(r) > x ? detail::next_down(r) : r;
+    }
+}
+template <std::floating_point T>
+inline T
+_round_up(double x) noexcept
+{
+    if constexpr (std::same_as<T, double>)
+    {
+        return x;
+    }
+    else
+    {
+        T r = T(x);
+        return double(r) < x ? detail::next_up(r) : r;
+    }
+}
+
+constexpr inline struct _exp_bounds_t
+{
+    template <std::floating_point T>
+    inline bounds<T>
+    operator ()(T a, T b) const noexcept
+    {
+            // Results near the subnormal range are replaced by  0  and  2⋅2⁻¹⁰²²  rather than widened by the absolute error
+            // of the kernel, which would require slow arithmetic on subnormal operands.
+        constexpr double tiny = 2*std::numeric_limits<double>::min();
+
+        double va = detail::vector_exp(double(a));
+        double vb = detail::vector_exp(double(b));
+        double lo = va < tiny ? 0. : detail::_widen_down(va);
+        double hi = vb < tiny ? (b == -std::numeric_limits<T>::infinity() ? 0. : tiny) : detail::_widen_up(vb);
+        return bounds<T>{ detail::_round_down<T>(lo), detail::_round_up<T>(hi) };
+    }
+} exp_bounds;
+constexpr inline struct _log_bounds_t
+{
+    template <std::floating_point T>
+    inline bounds<T>
+    operator ()(T a, T b) const noexcept
+    {
+        double lo = detail::_widen_down(detail::vector_log(double(a)));
+        double hi = detail::_widen_up(detail::vector_log(double(b)));
+        return bounds<T>{ detail::_round_down<T>(lo), detail::_round_up<T>(hi) };
+    }
+} log_bounds;
+constexpr inline struct _atan_bounds_t
+{
+    template <std::floating_point T>
+    inline bounds<T>
+    operator ()(T a, T b) const noexcept
+    {
+        double lo = detail::_widen_down(detail::vector_atan(double(a)));
+        double hi = detail::_widen_up(detail::vector_atan(double(b)));
+        return bounds<T>{ detail::_round_down<T>(lo), detail::_round_up<T>(hi) };
+    }
+} atan_bounds;
+
+    // Bounds of  sin(x + Shift⋅π/2) . With  x = k⋅π/2 + r , the maxima and minima are at the multiples  j⋅π/2  with
+    // j ≡ 1 - Shift  and  j ≡ 3 - Shift (mod 4) , respectively. The multiples contained in  [a,b]  are determined exactly from
+    // the signs of the reduced arguments of  a  and  b . Elements whose bounds exceed the range of the argument reduction,
+    // or are not finite, are computed with `interval<>` in a second pass.
+template <int Shift>
+struct _trig_bounds_t
+{
+    template <std::floating_point T>
+    static constexpr bool
+    fallback_required(T a, T b) noexcept
+    {
+        constexpr T max = T(vector_trig_max_argument);
+
+        return !((-max <= a) & (b <= max));
+    }
+    template <std::floating_point T>
+    static bounds<T>
+    fallback(T a, T b)
+    {
+        auto x = interval<T>{ a, b };
+        auto r = Shift == 0 ? intervals::sin(x) : intervals::cos(x);
+        return bounds<T>{ r.lower_unchecked(), r.upper_unchecked() };
+    }
+
+        // Whether the  j⋅π/2  with  j ≡ t (mod 4)  are among the multiples  jlo⋅π/2, …, jhi⋅π/2 .
+    static inline bool
+    _contains(double t, double jlo, double jhi) noexcept
+    {
+        double u = t - jlo;
+        double d = u - 4*detail::vector_round(u*0.25 - 0.375);  // u mod 4
+        return jhi - jlo >= d;
+    }
+
+    template <std::floating_point T>
+    inline bounds<T>
+    operator ()(T a, T b) const noexcept
+    {
+        auto ra = detail::vector_reduce_pio2(double(a));
+        auto rb = detail::vector_reduce_pio2(double(b));
+        double va = detail::vector_sincos<Shift>(ra);
+        double vb = detail::vector_sincos<Shift>(rb);
+        double jlo = ra.r_hi > 0 ? ra.k + 1 : ra.k;
+        double jhi = rb.r_hi < 0 ? rb.k - 1 : rb.k;
+        double lo = _contains(3 - Shift, jlo, jhi) ? -1. : detail::_widen_down(intervals::min(va, vb));
+        double hi = _contains(1 - Shift, jlo, jhi) ? 1. : detail::_widen_up(intervals::max(va, vb));
+        return bounds<T>{ detail::_round_down<T>(lo < -1 ? -1. : lo), detail::_round_up<T>(hi > 1 ? 1. : hi) };
+    }
+};
+constexpr inline _trig_bounds_t<0> sin_bounds;
+constexpr inline _trig_bounds_t<1> cos_bounds;
+
+
+    // Possible truth values of a relational predicate as returned by the comparison kernels.
+struct truth_values
+{
+    bool may_be_false;
+    bool may_be_true;
+};
+
+    // The following kernels determine the possible truth values of a comparison from the bounds of its operands. They
+    // reproduce the predicates of `interval_functions::compare_*()`.
+constexpr inline struct _less_truth_values_t
+{
+    template <std::floating_point T>
+    constexpr inline truth_values
+    operator ()(T a, T b, T c, T d) const noexcept
+    {
+        return { b >= c, a < d };
+    }
+} less_truth_values;
+constexpr inline struct _less_equal_truth_values_t
+{
+    template <std::floating_point T>
+    constexpr inline truth_values
+    operator ()(T a, T b, T c, T d) const noexcept
+    {
+        return { b > c, a <= d };
+    }
+} less_equal_truth_values;
+constexpr inline struct _equal_truth_values_t
+{
+    template <std::floating_point T>
+    constexpr inline truth_values
+    operator ()(T a, T b, T c, T d) const noexcept
+    {
+        return { bool((a != d) | (b != c)), bool((d >= a) & (c <= b)) };
+    }
+} equal_truth_values;
+constexpr inline struct _not_equal_truth_values_t
+{
+    template <std::floating_point T>
+    constexpr inline truth_values
+    operator ()(T a, T b, T c, T d) const noexcept
+    {
+        return { bool((d >= a) & (c <= b)), bool((a != d) | (b != c)) };
+    }
+} not_equal_truth_values;
+
+
+    // Apply the element-wise kernel  f  to the operands and store the resulting bounds in  lo  and  hi .
+template <std::floating_point T, typename F, typename X>
+inline void
+_transform(std::size_t n, T* lo, T* hi, F f, X x)
+{
+    if constexpr (requires { F::fallback_required(T{ }, T{ }); })
+    {
+        unsigned anyFallback = 0;
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            T a = x.lower(i), b = x.upper(i);
+            bounds<T> r = f(a, b);
+            lo[i] = r.lower;
+            hi[i] = r.upper;
+            anyFallback |= unsigned(F::fallback_required(a, b));
+        }
+        if (anyFallback != 0)
+        {
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                T a = x.lower(i), b = x.upper(i);
+                if (F::fallback_required(a, b))
+                {
+                    bounds<T> r = F::fallback(a, b);
+                    lo[i] = r.lower;
+                    hi[i] = r.upper;
+                }
+            }
+        }
+    }
+    else
+    {
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            bounds<T> r = f(x.lower(i), x.upper(i));
+            lo[i] = r.lower;
+            hi[i] = r.upper;
+        }
+    }
+}
+template <std::floating_point T, typename F, typename X, typename Y>
+inline void
+_transform(std::size_t n, T* lo, T* hi, F f, X x, Y y)
+{
+    if constexpr (requires { F::fallback_required(T{ }, T{ }, T{ }, T{ }); })
+    {
+            // The kernel does not handle all cases. The first pass determines whether any element requires the fallback; the
+            // flag is accumulated as an integer so as not to impede vectorization.
+        unsigned anyFallback = 0;
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            T a = x.lower(i), b = x.upper(i), c = y.lower(i), d = y.upper(i);
+            bounds<T> r = f(a, b, c, d);
+            lo[i] = r.lower;
+            hi[i] = r.upper;
+            anyFallback |= unsigned(F::fallback_required(a, b, c, d));
+        }
+        if (anyFallback != 0)
+        {
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                T a = x.lower(i), b = x.upper(i), c = y.lower(i), d = y.upper(i);
+                if (F::fallback_required(a, b, c, d))
+                {
+                    bounds<T> r = F::fallback(a, b, c, d);
+                    lo[i] = r.lower;
+                    hi[i] = r.upper;
+                }
+            }
+        }
+    }
+    else
+    {
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            bounds<T> r = f(x.lower(i), x.upper(i), y.lower(i), y.upper(i));
+            lo[i] = r.lower;
+            hi[i] = r.upper;
+        }
+    }
+}
+
+
+    // Apply the comparison kernel  f  to the elements  first, …, first + count - 1  of the operands and return the resulting
+    // truth values as bit masks.
+template <std::floating_point T, typename F, typename X, typename Y>
+inline void
+_compare_word(std::size_t first, std::size_t count, std::uint64_t& rf, std::uint64_t& rt, F f, X x, Y y)
+{
+    std::uint64_t mf = 0;
+    std::uint64_t mt = 0;
+    for (std::size_t j = 0; j != count; ++j)
+    {
+        truth_values r = f(x.lower(first + j), x.upper(first + j), y.lower(first + j), y.upper(first + j));
+        mf |= std::uint64_t(r.may_be_false) << j;
+        mt |= std::uint64_t(r.may_be_true) << j;
+    }
+    rf = mf;
+    rt = mt;
+}
+    // Apply the comparison kernel  f  to  n  elements and store the truth values in the bit planes  rf  and  rt  of a
+    // `bool_set_array`.
+template <std::floating_point T, typename F, typename X, typename Y>
+inline void
+_compare_transform(std::size_t n, std::uint64_t* rf, std::uint64_t* rt, F f, X x, Y y)
+{
+    constexpr std::size_t wordBits = 64;
+
+    std::size_t nw = n/wordBits;
+    for (std::size_t w = 0; w != nw; ++w)
+    {
+        detail::_compare_word<T>(w*wordBits, wordBits, rf[w], rt[w], f, x, y);
+    }
+    if (n % wordBits != 0)
+    {
+        detail::_compare_word<T>(nw*wordBits, n % wordBits, rf[nw], rt[nw], f, x, y);
+    }
+}
+
+    // Compute the hull of the elements of  x  for which the condition given by the bit planes  cf  and  ct  may be `true`
+    // and of the elements of  y  for which it may be `false`. This reproduces the partial assignments in `if_else()` for
+    // `interval<>`; elements with an unassigned condition are unassigned.
+template <std::floating_point T, typename X, typename Y>
+inline void
+_blend_word(std::size_t first, std::size_t count, T* lo, T* hi, std::uint64_t cf, std::uint64_t ct, X x, Y y)
+{
+    constexpr T inf = std::numeric_limits<T>::infinity();
+
+    for (std::size_t j = 0; j != count; ++j)
+    {
+        std::size_t i = first + j;
+        T a = x.lower(i), b = x.upper(i), c = y.lower(i), d = y.upper(i);
+        bool t = ((ct >> j) & 1) != 0;
+        bool f = ((cf >> j) & 1) != 0;
+        lo[i] = intervals::min(intervals::min(inf, t ? a : inf), f ? c : inf);
+        hi[i] = intervals::max(intervals::max(-inf, t ? b : -inf), f ? d : -inf);
+    }
+}
+template <std::floating_point T, typename X, typename Y>
+inline void
+_blend(std::size_t n, T* lo, T* hi, std::uint64_t const* cf, std::uint64_t const* ct, X x, Y y)
+{
+    constexpr std::size_t wordBits = 64;
+
+    std::size_t nw = n/wordBits;
+    for (std::size_t w = 0; w != nw; ++w)
+    {
+        detail::_blend_word<T>(w*wordBits, wordBits, lo, hi, cf[w], ct[w], x, y);
+    }
+    if (n % wordBits != 0)
+    {
+        detail::_blend_word<T>(nw*wordBits, n % wordBits, lo, hi, cf[nw], ct[nw], x, y);
+    }
+}
+
+struct interval_array_access
+{
+    template <typename T>
+    [[nodiscard]] static bool
+    all_assigned(interval_array<T> const& x) noexcept
+    {
+        for (std::size_t i = 0, n = x.lower_.size(); i != n; ++i)
+        {
+            if (x.lower_[i] > x.upper_[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename T>
+    [[nodiscard]] static array_operand<T>
+    operand(interval_array<T> const& x)
+    {
+        gsl_ExpectsAudit(all_assigned(x));
+
+        return { x.lower_.data(), x.upper_.data() };
+    }
+    template <typename T>
+    [[nodiscard]] static broadcast_operand<T>
+    operand(interval_base<T> const& x)
+    {
+        gsl_ExpectsDebug(x.assigned());
+
+        return { x.lower_unchecked(), x.upper_unchecked() };
+    }
+    template <typename T, arithmetic X>
+    [[nodiscard]] static constexpr broadcast_operand<T>
+    operand(X const& x) noexcept
+    {
+        return { T(x), T(x) };
+    }
+
+    template <typename T>
+    [[nodiscard]] static constexpr gsl::dim
+    size(interval_array<T> const& x) noexcept
+    {
+        return x.size();
+    }
+    template <typename T, typename X>
+    requires (!std::same_as<X, interval_array<T>>)
+    [[nodiscard]] static constexpr gsl::dim
+    size(X const&) noexcept
+    {
+        return -1;
+    }
+
+    template <typename T, typename F>
+    [[nodiscard]] static interval_array<T>
+    apply(F f, interval_array<T> const& x)
+    {
+        auto result = interval_array<T>(x.size(), typename interval_array<T>::uninitialized_tag{ });
+        detail::_transform(x.lower_.size(), result.lower_.data(), result.upper_.data(), f, operand(x));
+        return result;
+    }
+    template <typename T, typename F, typename X, typename Y>
+    [[nodiscard]] static interval_array<T>
+    apply(F f, X const& x, Y const& y)
+    {
+        gsl::dim nx = size<T>(x);
+        gsl::dim ny = size<T>(y);
+        gsl_Expects(nx < 0 || ny < 0 || nx == ny);
+
+        gsl::dim n = nx >= 0 ? nx : ny;
+        auto result = interval_array<T>(n, typename interval_array<T>::uninitialized_tag{ });
+        detail::_transform(gsl::narrow_cast<std::size_t>(n), result.lower_.data(), result.upper_.data(), f, operand<T>(x), operand<T>(y));
+        return result;
+    }
+
+        // Defined in intervals/interval_array.hpp, where `bool_set_array` is complete.
+    template <typename T, typename F, typename X, typename Y>
+    [[nodiscard]] static bool_set_array
+    compare(F f, X const& x, Y const& y);
+    template <typename T, typename X, typename Y>
+    [[nodiscard]] static interval_array<T>
+    if_else(bool_set_array const& c, X const& x, Y const& y);
+};
+
+
+} // namespace detail
+
+} // namespace intervals
+
+
+#endif // INCLUDED_INTERVALS_DETAIL_INTERVAL_ARRAY_HPP_
@@ -0,0 +1,1017 @@
+
+#ifndef INCLUDED_INTERVALS_DETAIL_MATH_HPP_
+#define INCLUDED_INTERVALS_DETAIL_MATH_HPP_
+
+
+#include <cmath>        // for frexp()
+#include <limits>
+#include <cstdint>      // for uint32_t, uint64_t
+#include <concepts>     // for floating_point<>
+#include <type_traits>  // for is_constant_evaluated()
+
+#include <gsl-lite/gsl-lite.hpp>  // for gsl_Expects()
+
+
+namespace intervals {
+
+namespace gsl = gsl_lite;
+
+namespace detail {
+
+
+    //
+    // `constexpr` implementations of the elementary functions, used by the functions in <intervals/math.hpp> during
+    // constant evaluation.
+    //
+    // The kernels follow the classic fdlibm approach: the argument is reduced to a small range with a multi-part
+    // representation of the reduction constant (ln 2, π/2), or with the Payne–Hanek algorithm for trigonometric functions of
+    // large arguments; the reduced argument is evaluated with a Taylor series truncated where the remainder term is below
+    // ε/4 , and the result is reconstructed such that the last operation adds a small correction to an exactly known term.
+    // The errors for `double` arguments are bounded by
+    //
+    //     sqrt(), cbrt()                      1 ulp
+    //     exp(), log(), atan()                2 ulp
+    //     sin(), cos()                        2 ulp
+    //     tan()                               3 ulp
+    //     asin(), acos(), atan2()             3 ulp
+    //     pow(x,y)                            (2 + |y⋅log x|) ulp
+    //     floor(), ceil(), round(), fmod()    exact
+    //
+    // where "ulp" refers to the unit in the last place of the exact result. Results in the subnormal range may lose one
+    // additional ulp of the subnormal spacing.
+    //
+    // `float` arguments are evaluated in `double` and rounded once. Long double arguments are supported, but the error
+    // bounds above then apply only relative to `double` precision since the reduction constants have about 100 bits.
+    //
+    // Operations which overflow or produce a NaN from non-NaN operands are not constant expressions; the kernels therefore
+    // handle special values and overflow explicitly before evaluating any arithmetic which could raise them.
+    //
+
+
+    // Error bounds of the kernels as listed above, in the format of `libm_ulp_bounds` (cf. <intervals/rounding.hpp>).
+struct constexpr_ulp_bounds
+{
+    static constexpr int exp = 2;
+    static constexpr int log = 2;
+    static constexpr int cbrt = 1;
+    static constexpr int sin = 2;
+    static constexpr int cos = 2;
+    static constexpr int tan = 3;
+    static constexpr int asin = 3;
+    static constexpr int acos = 3;
+    static constexpr int atan = 2;
+    static constexpr int atan2 = 3;
+};
+
+
+template <std::floating_point T>
+constexpr bool
+constexpr_isnan(T x) noexcept
+{
+    return x != x;
+}
+template <std::floating_point T>
+constexpr bool
+constexpr_isinf(T x) noexcept
+{
+    return x == std::numeric_limits<T>::infinity() || x == -std::numeric_limits<T>::infinity();
+}
+template <std::floating_point T>
+constexpr bool
+constexpr_isfinite(T x) noexcept
+{
+    return !detail::constexpr_isnan(x) && !detail::constexpr_isinf(x);
+}
+template <std::floating_point T>
+constexpr T
+constexpr_abs(T x) noexcept
+{
+    return x == 0 ? T(0) : x < 0 ? -x : x;
+}
+
+    // Whether the kernel for type  T  is computed in `double` and rounded.
+template <std::floating_point T>
+constexpr bool constexpr_math_via_double = std::numeric_limits<T>::digits < std::numeric_limits<double>::digits;
+
+
+    // Compute  x⋅2ⁿ  for finite  x . The result saturates to ±∞ instead of overflowing.
+template <std::floating_point T>
+constexpr T
+constexpr_ldexp(T x, int n) noexcept
+{
+    constexpr T max = std::numeric_limits<T>::max();
+
+    while (n > 0)
+    {
+        int k = n < 32 ? n : 32;
+        T f = T(1ull << k);
+        if (constexpr_abs(x) > max/f)
+        {
+            return x > 0 ? std::numeric_limits<T>::infinity() : -std::numeric_limits<T>::infinity();
+        }
+        x *= f;
+        n -= k;
+    }
+    while (n < 0)
+    {
+        int k = n > -32 ? -n : 32;
+        x /= T(1ull << k);
+        n += k;
+    }
+    return x;
+}
+
+    // Decompose finite positive  x  as  m⋅2ᵉ  with  1 ≤ m < 2 . All operations are exact.
+template <std::floating_point T>
+constexpr T
+constexpr_normalize(T x, int& e) noexcept
+{
+    constexpr T two32 = T(4294967296.);
+
+    e = 0;
+    while (x >= two32)
+    {
+        x /= two32;
+        e += 32;
+    }
+    while (x < 1/two32)
+    {
+        x *= two32;
+        e -= 32;
+    }
+    while (x >= 2)
+    {
+        x /= 2;
+        ++e;
+    }
+    while (x < 1)
+    {
+        x *= 2;
+        --e;
+    }
+    return x;
+}
+
+    // Compute the rounding error  e  of the product  p = a⋅b  such that  a⋅b = p + e  holds exactly (Dekker's algorithm).
+    // The arguments must be of moderate magnitude so that no intermediate result overflows or underflows.
+template <std::floating_point T>
+constexpr T
+constexpr_two_product_error(T a, T b, T p) noexcept
+{
+    constexpr T splitter = T((1ull << ((std::numeric_limits<T>::digits + 1)/2)) + 1);
+
+    T ca = splitter*a;
+    T ahi = ca - (ca - a);
+    T alo = a - ahi;
+    T cb = splitter*b;
+    T bhi = cb - (cb - b);
+    T blo = b - bhi;
+    return ((ahi*bhi - p) + ahi*blo + alo*bhi) + alo*blo;
+}
+
+    // Round to an integer towards zero. Arguments of magnitude  2ᵈ⁻¹  or larger, where  d  is the number of mantissa digits,
+    // are integers already.
+template <std::floating_point T>
+constexpr T
+constexpr_trunc(T x) noexcept
+{
+    constexpr T intThreshold = T(1ull << (std::numeric_limits<T>::digits - 1 < 63 ? std::numeric_limits<T>::digits - 1 : 63));
+
+    if (x == 0 || !(constexpr_abs(x) < intThreshold))  // also returns  ±0 , NaN, and ±∞  unchanged
+    {
+        return x;
+    }
+    T result = T(static_cast<long long>(x));
+    return result == 0 && x < 0 ? -T(0) : result;
+}
+template <std::floating_point T>
+constexpr T
+constexpr_floor(T x) noexcept
+{
+    T t = detail::constexpr_trunc(x);
+    return t > x ? t - 1 : t;
+}
+template <std::floating_point T>
+constexpr T
+constexpr_ceil(T x) noexcept
+{
+    T t = detail::constexpr_trunc(x);
+    return t < x ? t + 1 : t;
+}
+    // Round to the nearest integer, rounding halfway cases away from zero.
+template <std::floating_point T>
+constexpr T
+constexpr_round(T x) noexcept
+{
+    T t = detail::constexpr_trunc(x);
+    T d = x - t;  // exact
+    return d >= T(0.5) ? t + 1
+         : d <= T(-0.5) ? t - 1
+         : t;
+}
+
+    // Compute the remainder of  x/y  with the sign of  x . The result is exact.
+template <std::floating_point T>
+constexpr T
+constexpr_fmod(T x, T y) noexcept
+{
+    if (constexpr_isnan(x) || constexpr_isnan(y) || constexpr_isinf(x) || y == 0)
+    {
+        return std::numeric_limits<T>::quiet_NaN();
+    }
+    T ax = constexpr_abs(x);
+    T ay = constexpr_abs(y);
+    if (ax < ay)
+    {
+        return x;
+    }
+
+        // Long division: subtract the largest  y⋅2ᵏ ≤ |x|  for decreasing  k . Every subtraction is exact by Sterbenz' lemma.
+    T d = ay;
+    while (d <= std::numeric_limits<T>::max()/2 && 2*d <= ax)
+    {
+        d *= 2;
+    }
+    while (d >= ay)
+    {
+        if (ax >= d)
+        {
+            ax -= d;
+        }
+        d /= 2;
+    }
+    return x < 0 ? -ax : ax;
+}
+
+
+template <std::floating_point T>
+constexpr T
+constexpr_sqrt(T x) noexcept
+{
+    if constexpr (constexpr_math_via_double<T>)
+    {
+        return T(detail::constexpr_sqrt(double(x)));
+    }
+    else
+    {
+        if (constexpr_isnan(x) || x == 0 || x == std::numeric_limits<T>::infinity())
+        {
+            return x;
+        }
+        if (x < 0)
+        {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+
+        int e = 0;
+        T m = detail::constexpr_normalize(x, e);
+        if (e % 2 != 0)
+        {
+            m *= 2;
+            --e;
+        }
+
+            // Newton's iteration for  m ∈ [1,4)  converges quadratically and monotonically from above.
+        T r = (1 + m)/2;
+        for (int i = 0; i != 8; ++i)
+        {
+            r = (r + m/r)/2;
+        }
+
+            // Correct the final iterate with the exactly computed residual  m - r² .
+        T r2 = r*r;
+        T residual = (m - r2) - detail::constexpr_two_product_error(r, r, r2);
+        r += residual/(2*r);
+        return detail::constexpr_ldexp(r, e/2);
+    }
+}
+
+template <std::floating_point T>
+constexpr T
+constexpr_cbrt(T x) noexcept
+{
+    if constexpr (constexpr_math_via_double<T>)
+    {
+        return T(detail::constexpr_cbrt(double(x)));
+    }
+    else
+    {
+        if (constexpr_isnan(x) || x == 0 || constexpr_isinf(x))
+        {
+            return x;
+        }
+        if (x < 0)
+        {
+            return -detail::constexpr_cbrt(-x);
+        }
+
+        int e = 0;
+        T m = detail::constexpr_normalize(x, e);
+        while (e % 3 != 0)
+        {
+            m *= 2;
+            --e;
+        }
+
+            // Newton's iteration for  m ∈ [1,8) , followed by a correction with the exactly computed residual  m - r³ .
+        T r = (m + 2)/3;
+        for (int i = 0; i != 10; ++i)
+        {
+            r = (2*r + m/(r*r))/3;
+        }
+        T r2 = r*r;
+        T r2e = detail::constexpr_two_product_error(r, r, r2);
+        T r3 = r2*r;
+        T r3e = detail::constexpr_two_product_error(r2, r, r3) + r2e*r;
+        T residual = (m - r3) - r3e;
+        r += residual/(3*r2);
+        return detail::constexpr_ldexp(r, e/3);
+    }
+}
+
+    // ln 2  split such that  k⋅ln2_hi  is exact for  |k| < 2¹¹ .
+constexpr double constexpr_ln2_hi = 6.93147180369123816490e-01;
+constexpr double constexpr_ln2_lo = 1.90821492927058770002e-10;
+
+template <std::floating_point T>
+constexpr T
+constexpr_exp(T x) noexcept
+{
+    if constexpr (constexpr_math_via_double<T>)
+    {
+        return T(detail::constexpr_exp(double(x)));
+    }
+    else
+    {
+        constexpr T eps = std::numeric_limits<T>::epsilon();
+        constexpr T ln2_hi = T(constexpr_ln2_hi);
+        constexpr T ln2_lo = T(constexpr_ln2_lo);
+        constexpr T overflowThreshold = (std::numeric_limits<T>::max_exponent + 1)*T(0.6931471805599453);
+        constexpr T underflowThreshold = (std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits - 2)*T(0.6931471805599453);
+
+        if (constexpr_isnan(x))
+        {
+            return x;
+        }
+        if (x > overflowThreshold)
+        {
+            return std::numeric_limits<T>::infinity();
+        }
+        if (x < underflowThreshold)
+        {
+            return T(0);
+        }
+
+            // Reduce to  x = k⋅ln 2 + r  with  |r| ≤ ln(2)/2 .
+        T kf = x*T(1.4426950408889634);
+        int k = static_cast<int>(kf < 0 ? kf - T(0.5) : kf + T(0.5));
+        T hi = x - k*ln2_hi;  // exact
+        T lo = k*ln2_lo;
+        T r = hi - lo;
+
+            // Evaluate  eʳ - 1 = r⋅(1 + r/2⋅(1 + r/3⋅(1 + …)))  with Horner's scheme, then reconstruct  eʳ  with a single addition.
+        int n = 2;
+        for (T term = T(0.35*0.35/2); term > eps/4; )
+        {
+            ++n;
+            term *= T(0.35)/n;
+        }
+        T p = 1;
+        for (; n >= 2; --n)
+        {
+            p = 1 + r*p/n;
+        }
+        T result = 1 + (hi - (lo - r*(p - 1)));
+        return detail::constexpr_ldexp(result, k);
+    }
+}
+
+template <std::floating_point T>
+constexpr T
+constexpr_log(T x) noexcept
+{
+    if constexpr (constexpr_math_via_double<T>)
+    {
+        return T(detail::constexpr_log(double(x)));
+    }
+    else
+    {
+        constexpr T eps = std::numeric_limits<T>::epsilon();
+        constexpr T ln2_hi = T(constexpr_ln2_hi);
+        constexpr T ln2_lo = T(constexpr_ln2_lo);
+
+        if (constexpr_isnan(x) || x == std::numeric_limits<T>::infinity())
+        {
+            return x;
+        }
+        if (x < 0)
+        {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        if (x == 0)
+        {
+            return -std::numeric_limits<T>::infinity();
+        }
+
+            // Reduce to  x = 2ᵏ⋅(1 + f)  with  √½ ≤ 1 + f < √2 .
+        int k = 0;
+        T m = detail::constexpr_normalize(x, k);
+        if (m > T(1.4142135623730951))
+        {
+            m /= 2;
+            ++k;
+        }
+        T f = m - 1;  // exact
+
+            // log(1 + f) = 2⋅atanh(s) = f - (f²/2 - s⋅(f²/2 + R))  with  s = f/(2 + f) ,  R = 2⋅(s²/3 + s⁴/5 + …) .
+        T s = f/(2 + f);
+        T z = s*s;
+        int n = 1;
+        for (T term = T(0.0295); term > eps/4; )
+        {
+            ++n;
+            term *= T(0.0295);
+        }
+        T q = 0;
+        for (; n >= 1; --n)
+        {
+            q = z*(T(2)/(2*n + 1) + q);
+        }
+        T hfsq = f*f/2;
+        T kf = T(k);
+        return kf*ln2_hi - ((hfsq - (s*(hfsq + q) + kf*ln2_lo)) - f);
+    }
+}
+
+    // π/2  split into four parts such that  k⋅pio2_1 ,  k⋅pio2_2 ,  k⋅pio2_3  are exact for  |k| < 2²⁰ .
+constexpr double constexpr_pio2_1 = 1.57079632673412561417e+00;
+constexpr double constexpr_pio2_2 = 6.07710050630396597660e-11;
+constexpr double constexpr_pio2_3 = 2.02226624871116645580e-21;
+constexpr double constexpr_pio2_3t = 8.47842766036889956997e-32;
+
+    // Exact sum  s + e = a + b  (Knuth's TwoSum algorithm).
+template <std::floating_point T>
+struct constexpr_double_word
+{
+    T hi;
+    T lo;
+};
+template <std::floating_point T>
+constexpr constexpr_double_word<T>
+constexpr_two_sum(T a, T b) noexcept
+{
+    T s = a + b;
+    T bb = s - a;
+    return { s, (a - (s - bb)) + (b - bb) };
+}
+
+    // Largest argument for which the Cody–Waite reduction in `reduce_pio2_medium()` is accurate.
+constexpr double reduce_pio2_medium_max = 1647099.3291652855;  // 2²⁰⋅π/2
+
+    // Reduce  x  to  x = k⋅π/2 + (r.hi + r.lo)  with  |r| ≲ π/4 , and return  k mod 4 . This is the Cody–Waite reduction:
+    // π/2  is subtracted in four parts, the first three of which have trailing zeros so that their products with  k  are exact.
+    // Requires  |x| ≤ 2²⁰⋅π/2 .
+template <std::floating_point T>
+constexpr int
+reduce_pio2_medium(T x, constexpr_double_word<T>& r)
+{
+    gsl_ExpectsDebug(constexpr_abs(x) <= T(reduce_pio2_medium_max));
+
+    T kf = x*T(0.63661977236758134);
+    int k = static_cast<int>(kf < 0 ? kf - T(0.5) : kf + T(0.5));
+    T kk = T(k);
+    T a = x - kk*T(constexpr_pio2_1);  // exact by Sterbenz' lemma
+    auto b = detail::constexpr_two_sum(a, -kk*T(constexpr_pio2_2));
+    auto c = detail::constexpr_two_sum(b.hi, -kk*T(constexpr_pio2_3));
+    T lo = (b.lo + c.lo) - kk*T(constexpr_pio2_3t);
+    r = detail::constexpr_two_sum(c.hi, lo);
+    return k & 3;
+}
+
+    // Bits of  2/π  in groups of 32, i.e.  2/π = Σᵢ two_over_pi_bits[i]⋅2⁻³²⁽ⁱ⁺¹⁾ . The table covers the arguments  |x| < 2¹⁰²⁴ .
+constexpr std::uint32_t two_over_pi_bits[] = {
+    0xA2F9836E, 0x4E441529, 0xFC2757D1, 0xF534DDC0, 0xDB629599, 0x3C439041, 0xFE5163AB, 0xDEBBC561,
+    0xB7246E3A, 0x424DD2E0, 0x06492EEA, 0x09D1921C, 0xFE1DEB1C, 0xB129A73E, 0xE88235F5, 0x2EBB4484,
+    0xE99C7026, 0xB45F7E41, 0x3991D639, 0x835339F4, 0x9C845F8B, 0xBDF9283B, 0x1FF897FF, 0xDE05980F,
+    0xEF2F118B, 0x5A0A6D1F, 0x6D367ECF, 0x27CB09B7, 0x4F463F66, 0x9E5FEA2D, 0x7527BAC7, 0xEBE5F17B,
+    0x3D0739F7, 0x8A5292EA, 0x6BFB5FB1, 0x1F8D5D08, 0x56033046, 0xFC7B6BAB, 0xF0CFBC20, 0x9AF4361D
+};
+
+    // π/2  as a sum of two `double` values.
+constexpr double pio2_hi = 1.57079632679489655800e+00;
+constexpr double pio2_lo = 6.12323399573676603587e-17;
+
+    // Reduce  x  as in `reduce_pio2_medium()` with the Payne–Hanek algorithm. The significand  m  of  x = m⋅2^q  is multiplied
+    // with the window of  2/π  which contributes to the fractional part and to the last two integral bits of  x⋅2/π ; the
+    // leading bits of  2/π  are skipped because they contribute multiples of 4. The product is computed exactly with 32-bit
+    // limbs, and its fraction is converted to a double-word value which is then multiplied by  π/2 . Requires
+    // 2²⁰ ≤ |x| < 2¹⁰²⁴ ; `T` must have between 53 and 64 significand bits.
+template <std::floating_point T>
+constexpr int
+reduce_pio2_large(T x, constexpr_double_word<T>& r)
+{
+    static_assert(std::numeric_limits<T>::digits >= 53 && std::numeric_limits<T>::digits <= 64);
+    constexpr int W = 8;  // number of limbs of the window of  2/π
+
+    T ax = constexpr_abs(x);
+    gsl_ExpectsDebug(ax >= T(1048576.) && ax <= T(std::numeric_limits<double>::max()));
+
+        // Decompose  |x| = m⋅2^q  with a 64-bit integer  m .
+    int e = 0;
+    T f = 0;
+    if (std::is_constant_evaluated())
+    {
+        f = detail::constexpr_normalize(ax, e);  // 1 ≤ f < 2
+    }
+    else
+    {
+        f = 2*std::frexp(ax, &e);
+        --e;
+    }
+    std::uint64_t m = static_cast<std::uint64_t>(f*T(9223372036854775808.));  // 2⁶³; exact
+    int q = e - 63;
+
+        // The limb  i  of  2/π  contributes  m⋅two_over_pi_bits[i]⋅2^(q - 32⋅(i + 1)) , which is a multiple of 4 if
+        // 32⋅(i + 1) ≤ q - 2 . The window therefore starts at  i0 = ⌊(q - 2)/32⌋ , and the product is scaled by  2ˢ  with
+        // 2 ≤ s ≤ 33  for  i0 > 0 .
+    int i0 = q >= 34 ? (q - 2)/32 : 0;
+    int s = q - 32*i0;
+    std::uint32_t p[W + 2] = { };  // little-endian
+    std::uint64_t const mw[2] = { m & 0xFFFF'FFFFu, m >> 32 };
+    for (int j = 0; j != W; ++j)
+    {
+        std::uint64_t w = two_over_pi_bits[i0 + W - 1 - j];
+        std::uint64_t carry = 0;
+        int l = j;
+        for (; l != j + 2; ++l)
+        {
+            std::uint64_t t = w*mw[l - j] + p[l] + carry;
+            p[l] = static_cast<std::uint32_t>(t);
+            carry = t >> 32;
+        }
+        for (; carry != 0 && l != W + 2; ++l)
+        {
+            std::uint64_t t = p[l] + carry;
+            p[l] = static_cast<std::uint32_t>(t);
+            carry = t >> 32;
+        }
+    }
+
+        // Extract the 64 bits starting at bit  pos  of the product.
+    auto bits = [&p](int pos)
+    {
+        auto limb = [&p](int i) -> std::uint64_t { return i < W + 2 ? p[i] : 0; };
+        int i = pos/32;
+        int sh = pos%32;
+        std::uint64_t v = limb(i) | (limb(i + 1) << 32);
+        return sh == 0 ? v : (v >> sh) | (limb(i + 2) << (64 - sh));
+    };
+
+        // The unit of  x⋅2/π  is at bit  32⋅W - s  of the product. Round to the nearest integer  k  and negate the fraction
+        // if it was rounded up.
+    int pos0 = 32*W - s;
+    int k = static_cast<int>(bits(pos0) & 3);
+    std::uint64_t f1 = bits(pos0 - 64);
+    std::uint64_t f0 = bits(pos0 - 128);
+    bool negative = (f1 >> 63) != 0;
+    if (negative)
+    {
+        ++k;
+        f0 = ~f0 + 1;
+        f1 = ~f1 + (f0 == 0 ? 1 : 0);
+    }
+
+        // Convert the fraction  f1⋅2⁻⁶⁴ + f0⋅2⁻¹²⁸  to a double-word value, splitting it into parts with at most 53 bits.
+    T c1 = T(f1 >> 11)*T(1.1102230246251565e-16);  // 2⁻⁵³
+    T c2 = T(((f1 & 0x7FF) << 42) | (f0 >> 22))*T(1.2325951644078310e-32);  // 2⁻¹⁰⁶
+    T c3 = T(f0 & 0x3F'FFFF)*T(2.9387358770557188e-39);  // 2⁻¹²⁸
+    auto t = detail::constexpr_two_sum(c1, c2);
+    auto fw = detail::constexpr_two_sum(t.hi, t.lo + c3);
+
+        // Multiply by  π/2 .
+    T hi = fw.hi*T(pio2_hi);
+    T lo = detail::constexpr_two_product_error(fw.hi, T(pio2_hi), hi) + (fw.hi*T(pio2_lo) + fw.lo*T(pio2_hi));
+    r = detail::constexpr_two_sum(hi, lo);
+
+    if (negative != (x < 0))
+    {
+        r = { -r.hi, -r.lo };
+    }
+    return (x < 0 ? -k : k) & 3;
+}
+
+    // Reduce  x  to  x = k⋅π/2 + (r.hi + r.lo)  with  |r| ≲ π/4 , and return  k mod 4 . Moderate arguments are reduced with the
+    // Cody–Waite algorithm, larger ones with the Payne–Hanek algorithm. Requires  |x| < 2¹⁰²⁴ ; `T` must not be `float`.
+template <std::floating_point T>
+constexpr int
+reduce_pio2(T x, constexpr_double_word<T>& r)
+{
+    if (constexpr_abs(x) <= T(reduce_pio2_medium_max))
+    {
+        return detail::reduce_pio2_medium(x, r);
+    }
+    return detail::reduce_pio2_large(x, r);
+}
+
+    // sin(r.hi + r.lo)  for  |r| ≲ π/4 .
+template <std::floating_point T>
+constexpr T
+constexpr_sin_kernel(constexpr_double_word<T> r) noexcept
+{
+    constexpr T eps = std::numeric_limits<T>::epsilon();
+
+    T z = r.hi*r.hi;
+    int n = 1;
+    for (T term = T(0.62)/6; term > eps/4; )
+    {
+        ++n;
+        term *= T(0.62)/((2*n)*(2*n + 1));
+    }
+
+        // sin(r) = r + r⋅z⋅(-1/3! + z/5! - …)
+    T p = 0;
+    for (; n >= 1; --n)
+    {
+        T c = 1;
+        for (int i = 2; i <= 2*n + 1; ++i)
+        {
+            c *= i;
+        }
+        p = (n % 2 != 0 ? -1/c : 1/c) + z*p;
+    }
+    return r.hi + (r.hi*z*p + r.lo*(1 - z/2));
+}
+    // cos(r.hi + r.lo)  for  |r| ≲ π/4 .
+template <std::floating_point T>
+constexpr T
+constexpr_cos_kernel(constexpr_double_word<T> r) noexcept
+{
+    constexpr T eps = std::numeric_limits<T>::epsilon();
+
+    T z = r.hi*r.hi;
+    int n = 2;
+    for (T term = T(0.62*0.62)/24; term > eps/4; )
+    {
+        ++n;
+        term *= T(0.62)/((2*n - 1)*(2*n));
+    }
+
+        // cos(r) = 1 - z/2 + z²⋅(1/4! - z/6! + …)
+    T p = 0;
+    for (; n >= 2; --n)
+    {
+        T c = 1;
+        for (int i = 2; i <= 2*n; ++i)
+        {
+            c *= i;
+        }
+        p = (n % 2 == 0 ? 1/c : -1/c) + z*p;
+    }
+    T hz = z/2;
+    T w = 1 - hz;
+    return w + (((1 - w) - hz) + (z*z*p - r.hi*r.lo));
+}
+
+template <std::floating_point T>
+constexpr T
+constexpr_sin(T x)
+{
+    if constexpr (constexpr_math_via_double<T>)
+    {
+        return T(detail::constexpr_sin(double(x)));
+    }
+    else
+    {
+        if (constexpr_isnan(x) || x == 0)
+        {
+            return x;
+        }
+        if (constexpr_isinf(x))
+        {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        auto r = constexpr_double_word<T>{ };
+        switch (detail::reduce_pio2(x, r))
+        {
+        case 0: return detail::constexpr_sin_kernel(r);
+        case 1: return detail::constexpr_cos_kernel(r);
+        case 2: return -detail::constexpr_sin_kernel(r);
+        default: return -detail::constexpr_cos_kernel(r);
+        }
+    }
+}
+template <std::floating_point T>
+constexpr T
+constexpr_cos(T x)
+{
+    if constexpr (constexpr_math_via_double<T>)
+    {
+        return T(detail::constexpr_cos(double(x)));
+    }
+    else
+    {
+        if (constexpr_isnan(x))
+        {
+            return x;
+        }
+        if (constexpr_isinf(x))
+        {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        auto r = constexpr_double_word<T>{ };
+        switch (detail::reduce_pio2(x, r))
+        {
+        case 0: return detail::constexpr_cos_kernel(r);
+        case 1: return -detail::constexpr_sin_kernel(r);
+        case 2: return -detail::constexpr_cos_kernel(r);
+        default: return detail::constexpr_sin_kernel(r);
+        }
+    }
+}
+template <std::floating_point T>
+constexpr T
+constexpr_tan(T x)
+{
+    if constexpr (constexpr_math_via_double<T>)
+    {
+        return T(detail::constexpr_tan(double(x)));
+    }
+    else
+    {
+        if (constexpr_isnan(x) || x == 0)
+        {
+            return x;
+        }
+        if (constexpr_isinf(x))
+        {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        auto r = constexpr_double_word<T>{ };
+        int q = detail::reduce_pio2(x, r);
+        T s = detail::constexpr_sin_kernel(r);
+        T c = detail::constexpr_cos_kernel(r);
+        return q % 2 == 0 ? s/c : -c/s;
+    }
+}
+
+    // Compute  sin(q⋅π/2 + r)  and  tan(q⋅π/2 + r)  for a reduced argument  r = r.hi + r.lo  with  |r| ≲ π/4 . During constant
+    // evaluation, the kernels above are used. At runtime, the functions of the standard library are evaluated for  r.hi , which
+    // is in the range where they need no argument reduction, and the first-order term in  r.lo  is added.
+template <std::floating_point T>
+constexpr T
+sin_quadrant(int q, constexpr_double_word<T> r)
+{
+    bool odd = (q & 1) != 0;
+    T v = 0;
+    if (std::is_constant_evaluated())
+    {
+        v = odd ? detail::constexpr_cos_kernel(r) : detail::constexpr_sin_kernel(r);
+    }
+    else
+    {
+        v = odd ? std::cos(r.hi) - r.hi*r.lo : std::sin(r.hi) + r.lo;
+    }
+    return (q & 2) != 0 ? -v : v;
+}
+template <std::floating_point T>
+constexpr T
+tan_quadrant(int q, constexpr_double_word<T> r)
+{
+    bool odd = (q & 1) != 0;
+    if (std::is_constant_evaluated())
+    {
+        T s = detail::constexpr_sin_kernel(r);
+        T c = detail::constexpr_cos_kernel(r);
+        return odd ? -c/s : s/c;
+    }
+    T t = std::tan(r.hi);
+    t += r.lo*(1 + t*t);
+    return odd ? -1/t : t;
+}
+
+    // atan(t)  for  |t| ≤ 7/16 .
+template <std::floating_point T>
+constexpr T
+constexpr_atan_kernel(T t) noexcept
+{
+    constexpr T eps = std::numeric_limits<T>::epsilon();
+
+    T z = t*t;
+    int n = 1;
+    for (T term = T(0.1914)/3; term > eps/4; )
+    {
+        ++n;
+        term *= T(0.1914);
+    }
+
+        // atan(t) = t + t⋅z⋅(-1/3 + z/5 - …)
+    T p = 0;
+    for (; n >= 1; --n)
+    {
+        p = (n % 2 != 0 ? T(-1) : T(1))/(2*n + 1) + z*p;
+    }
+    return t + t*z*p;
+}
+
+    // atan(x)  at the breakpoints  1/2 ,  1 ,  3/2 ,  ∞ , each split into a leading and a trailing part.
+constexpr double constexpr_atan_hi[] = { 4.63647609000806093515e-01, 7.85398163397448278999e-01, 9.82793723247329054082e-01, 1.57079632679489655800e+00 };
+constexpr double constexpr_atan_lo[] = { 2.26987774529616870924e-17, 3.06161699786838301793e-17, 1.39033110312309984516e-17, 6.12323399573676603587e-17 };
+
+template <std::floating_point T>
+constexpr T
+constexpr_atan(T x) noexcept
+{
+    if constexpr (constexpr_math_via_double<T>)
+    {
+        return T(detail::constexpr_atan(double(x)));
+    }
+    else
+    {
+        if (constexpr_isnan(x) || x == 0)
+        {
+            return x;
+        }
+        if (x < 0)
+        {
+            return -detail::constexpr_atan(-x);
+        }
+        if (x == std::numeric_limits<T>::infinity())
+        {
+            return T(constexpr_atan_hi[3]) + T(constexpr_atan_lo[3]);
+        }
+        if (x < T(0.4375))
+        {
+            return detail::constexpr_atan_kernel(x);
+        }
+
+            // Reduce with the identity  atan(x) = atan(c) + atan((x - c)/(1 + x⋅c))  for a nearby breakpoint  c .
+        int id = 0;
+        T t = 0;
+        if (x < T(0.6875))
+        {
+            id = 0;
+            t = (2*x - 1)/(2 + x);
+        }
+        else if (x < T(1.1875))
+        {
+            id = 1;
+            t = (x - 1)/(x + 1);
+        }
+        else if (x < T(2.4375))
+        {
+            id = 2;
+            t = (x - T(1.5))/(1 + T(1.5)*x);
+        }
+        else
+        {
+            id = 3;
+            t = -1/x;
+        }
+        return T(constexpr_atan_hi[id]) + (T(constexpr_atan_lo[id]) + detail::constexpr_atan_kernel(t));
+    }
+}
+
+template <std::floating_point T>
+constexpr T
+constexpr_atan2(T y, T x) noexcept
+{
+    if constexpr (constexpr_math_via_double<T>)
+    {
+        return T(detail::constexpr_atan2(double(y), double(x)));
+    }
+    else
+    {
+        constexpr T pio2_hi = T(constexpr_atan_hi[3]);
+        constexpr T pio2_lo = T(constexpr_atan_lo[3]);
+        constexpr T pi_hi = 2*pio2_hi;
+        constexpr T pi_lo = 2*pio2_lo;
+
+        if (constexpr_isnan(x) || constexpr_isnan(y))
+        {
+            return x + y;
+        }
+        if (y == 0)
+        {
+                // The sign of zero cannot be inspected portably in constant expressions, so  atan2(±0, x < 0) = π .
+            return x < 0 ? pi_hi + pi_lo : y;
+        }
+
+        T ay = constexpr_abs(y);
+        T ax = constexpr_abs(x);
+        T z = 0;
+        if (constexpr_isinf(ay))
+        {
+            z = constexpr_isinf(ax) ? (x > 0 ? pio2_hi/2 + pio2_lo/2 : T(1.5)*pio2_hi + T(1.5)*pio2_lo) : pio2_hi + pio2_lo;
+            return y < 0 ? -z : z;
+        }
+        if (constexpr_isinf(ax))
+        {
+            z = x > 0 ? T(0) : pi_hi + pi_lo;
+            return y < 0 ? -z : z;
+        }
+        if (ay/T(1152921504606846976.) > ax)  // |y/x| > 2⁶⁰
+        {
+            z = pio2_hi + pio2_lo;
+        }
+        else
+        {
+            z = detail::constexpr_atan(ay/ax);
+            if (x < 0)
+            {
+                z = pi_hi - (z - pi_lo);
+            }
+        }
+        return y < 0 ? -z : z;
+    }
+}
+
+template <std::floating_point T>
+constexpr T
+constexpr_asin(T x) noexcept
+{
+    if (constexpr_isnan(x) || x == 0)
+    {
+        return x;
+    }
+    if (constexpr_abs(x) > 1)
+    {
+        return std::numeric_limits<T>::quiet_NaN();
+    }
+    return detail::constexpr_atan2(x, detail::constexpr_sqrt((1 - x)*(1 + x)));
+}
+template <std::floating_point T>
+constexpr T
+constexpr_acos(T x) noexcept
+{
+    if (constexpr_isnan(x))
+    {
+        return x;
+    }
+    if (constexpr_abs(x) > 1)
+    {
+        return std::numeric_limits<T>::quiet_NaN();
+    }
+    return detail::constexpr_atan2(detail::constexpr_sqrt((1 - x)*(1 + x)), x);
+}
+
+    // Compute  xʸ  as  exp(y⋅log x) . The relative error grows with  |y⋅log x|  because the error of  log x  is amplified.
+template <std::floating_point T>
+constexpr T
+constexpr_pow(T x, T y) noexcept
+{
+    constexpr T inf = std::numeric_limits<T>::infinity();
+
+    if (y == 0 || x == 1)
+    {
+        return T(1);
+    }
+    if (constexpr_isnan(x) || constexpr_isnan(y))
+    {
+        return std::numeric_limits<T>::quiet_NaN();
+    }
+    if (x < 0)
+    {
+        if (constexpr_isinf(y) || detail::constexpr_trunc(y) != y)
+        {
+            return constexpr_isinf(y) ? detail::constexpr_pow(-x, y) : std::numeric_limits<T>::quiet_NaN();
+        }
+        T result = detail::constexpr_pow(-x, y);
+        bool odd = constexpr_abs(y) < 2/std::numeric_limits<T>::epsilon() && detail::constexpr_fmod(y, T(2)) != 0;
+        return odd ? -result : result;
+    }
+    if (x == 0)
+    {
+        return y > 0 ? T(0) : inf;
+    }
+    if (x == inf)
+    {
+        return y > 0 ? inf : T(0);
+    }
+    if (constexpr_isinf(y))
+    {
+        return (x > 1) == (y > 0) ? inf : T(0);
+    }
+    T logx = detail::constexpr_log(x);
+    if (constexpr_abs(logx) > 1 && constexpr_abs(y) > std::numeric_limits<T>::max()/constexpr_abs(logx))
+    {
+        return (logx > 0) == (y > 0) ? inf : T(0);
+    }
+    T p = y*logx;
+    if (!(constexpr_abs(p) < 1000))
+    {
+        return detail::constexpr_exp(p);
+    }
+
+        // Account for the rounding error of the product:  exp(p + e) ≈ exp(p)⋅(1 + e) .
+    T e = detail::constexpr_two_product_error(y, logx, p);
+    T result = detail::constexpr_exp(p);
+    return result < std::numeric_limits<T>::max()/2 ? result + result*e : result;
+}
+
+
+} // namespace detail
+
+} // namespace intervals
+
+
+#endif // INCLUDED_INTERVALS_DETAIL_MATH_HPP_
@@ -0,0 +1,123 @@
+
+#ifndef INCLUDED_INTERVALS_DETAIL_PACKED_INTERVAL_HPP_
+#define INCLUDED_INTERVALS_DETAIL_PACKED_INTERVAL_HPP_
+
+
+#include <limits>
+
+
+    // `packed_interval<>` uses SSE2 intrinsics if they are available. Define `INTERVALS_PACKED_INTERVAL_SSE2` as 0 to enforce the
+    // portable implementation.
+#ifndef INTERVALS_PACKED_INTERVAL_SSE2
+# if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define INTERVALS_PACKED_INTERVAL_SSE2 1
+# else
+#  define INTERVALS_PACKED_INTERVAL_SSE2 0
+# endif
+#endif
+
+#if INTERVALS_PACKED_INTERVAL_SSE2
+# include <emmintrin.h>
+#endif
+
+
+namespace intervals {
+
+namespace detail {
+
+
+#if INTERVALS_PACKED_INTERVAL_SSE2
+
+    //
+    // Kernels operating on packed bounds  { -a, b }  which represent the interval  [a,b] . Negating the lower bound lets all
+    // bounds be rounded in the same direction: in upward rounding mode, rounding  -a  upward amounts to rounding  a  downward.
+    //
+
+inline __m128d
+packed_swap(__m128d x) noexcept
+{
+    return _mm_shuffle_pd(x, x, 1);
+}
+
+inline __m128d
+packed_select(__m128d mask, __m128d x, __m128d y) noexcept
+{
+    return _mm_or_pd(_mm_and_pd(mask, x), _mm_andnot_pd(mask, y));
+}
+
+    // Returns whether all bounds of  x  and  y  are finite, and thus whether the special-value handling of `interval<>` can be
+    // bypassed.
+inline bool
+packed_all_finite(__m128d x, __m128d y) noexcept
+{
+    __m128d inf = _mm_set1_pd(std::numeric_limits<double>::infinity());
+    __m128d abs_mask = _mm_castsi128_pd(_mm_set1_epi64x(0x7FFF'FFFF'FFFF'FFFF));
+    __m128d finite = _mm_and_pd(
+        _mm_cmplt_pd(_mm_and_pd(x, abs_mask), inf),
+        _mm_cmplt_pd(_mm_and_pd(y, abs_mask), inf));
+    return _mm_movemask_pd(finite) == 0b11;
+}
+
+    // [a,b] + [c,d] = [a + c, b + d]
+inline __m128d
+packed_add(__m128d x, __m128d y) noexcept
+{
+        // As for `interval<>`, the sum is NaN if  a = -∞ ∧ d = ∞  or  c = -∞ ∧ b = ∞ . The resulting all-ones bit pattern is a
+        // NaN.
+    __m128d inf = _mm_set1_pd(std::numeric_limits<double>::infinity());
+    __m128d nan = _mm_and_pd(_mm_cmpeq_pd(x, inf), _mm_cmpeq_pd(packed_swap(y), inf));
+    nan = _mm_or_pd(nan, packed_swap(nan));
+    return _mm_or_pd(_mm_add_pd(x, y), nan);
+}
+
+    // [a,b]⋅[c,d] = [min(ac, ad, bc, bd), max(ac, ad, bc, bd)]
+    //
+    // All bounds of  x  and  y  must be finite.
+inline __m128d
+packed_multiply(__m128d x, __m128d y) noexcept
+{
+    __m128d na = _mm_unpacklo_pd(x, x);  // { -a, -a }
+    __m128d b = _mm_unpackhi_pd(x, x);  // { b, b }
+    __m128d ny = _mm_xor_pd(y, _mm_set1_pd(-0.));  // { c, -d }
+    __m128d v1 = _mm_mul_pd(na, packed_swap(y));  // { -ad, ac }
+    __m128d v2 = _mm_mul_pd(na, ny);  // { -ac, ad }
+    __m128d v3 = _mm_mul_pd(b, _mm_unpacklo_pd(y, ny));  // { -bc, bc }
+    __m128d v4 = _mm_mul_pd(b, _mm_unpackhi_pd(ny, y));  // { -bd, bd }
+    return _mm_max_pd(_mm_max_pd(v1, v2), _mm_max_pd(v3, v4));
+}
+
+    // Returns whether  0 ∉ [c,d] .
+inline bool
+packed_excludes_zero(__m128d y) noexcept
+{
+    return _mm_movemask_pd(_mm_cmplt_pd(y, _mm_setzero_pd())) != 0;  // -c < 0 ∨ d < 0
+}
+
+    // [a,b]/[c,d]
+    //
+    // All bounds of  x  and  y  must be finite, and  0 ∉ [c,d] .
+inline __m128d
+packed_divide(__m128d x, __m128d y) noexcept
+{
+        // For a negative divisor, use  x/y = (-x)/(-y) . Negation swaps the packed bounds.
+    __m128d yn = _mm_cmplt_pd(_mm_unpackhi_pd(y, y), _mm_setzero_pd());  // d < 0
+    x = packed_select(yn, packed_swap(x), x);
+    y = packed_select(yn, packed_swap(y), y);
+
+        // Now  0 < c ≤ d . The lower bound is  a/c  if  a < 0  and  a/d  otherwise, the upper bound is  b/c  if  b ≥ 0  and
+        // b/d  otherwise (cf. `hickey_divide_selectors`). If the numerator is 0, the choice of the denominator is irrelevant.
+    __m128d c = _mm_xor_pd(_mm_unpacklo_pd(y, y), _mm_set1_pd(-0.));  // { c, c }
+    __m128d d = _mm_unpackhi_pd(y, y);  // { d, d }
+    __m128d den = packed_select(_mm_cmpge_pd(x, _mm_setzero_pd()), c, d);
+    return _mm_div_pd(x, den);
+}
+
+#endif // INTERVALS_PACKED_INTERVAL_SSE2
+
+
+} // namespace detail
+
+} // namespace intervals
+
+
+#endif // INCLUDED_INTERVALS_DETAIL_PACKED_INTERVAL_HPP_
@@ -0,0 +1,170 @@
+
+#ifndef INCLUDED_INTERVALS_DETAIL_ROUNDING_HPP_
+#define INCLUDED_INTERVALS_DETAIL_ROUNDING_HPP_
+
+
+#include <bit>          // for bit_cast<>()
+#include <cmath>
+#include <limits>
+#include <cstdint>      // for uint32_t, uint64_t
+#include <numbers>      // for pi_v<>
+#include <concepts>     // for floating_point<>, same_as<>
+#include <type_traits>  // for conditional<>, is_constant_evaluated()
+
+#include <intervals/detail/math.hpp>  // for constexpr_ulp_bounds
+
+
+namespace intervals {
+
+namespace detail {
+
+
+    // Return the smallest floating-point number greater than  x . This coincides with `std::nextafter(x, ∞)` but is
+    // `constexpr` and does not depend on the floating-point environment.
+template <std::floating_point T>
+constexpr T
+next_up(T x) noexcept
+{
+    constexpr T inf = std::numeric_limits<T>::infinity();
+
+    if constexpr (std::same_as<T, double> || std::same_as<T, float>)
+    {
+        using U = std::conditional_t<std::same_as<T, double>, std::uint64_t, std::uint32_t>;
+
+        if (x != x || x == inf)
+        {
+            return x;
+        }
+        if (x == 0)  // either  +0  or  -0
+        {
+            return std::numeric_limits<T>::denorm_min();
+        }
+        U bits = std::bit_cast<U>(x);
+        return std::bit_cast<T>(x > 0 ? bits + 1 : bits - 1);
+    }
+    else
+    {
+        return std::nextafter(x, inf);
+    }
+}
+
+    // Return the largest floating-point number less than  x .
+template <std::floating_point T>
+constexpr T
+next_down(T x) noexcept
+{
+    return -detail::next_up(-x);
+}
+
+    // Magnitude of a product, a dividend, or a radicand above which the rounding error of the operation can be computed
+    // exactly with an FMA operation. Below this (conservative) threshold, the error term may underflow; results are then
+    // widened unconditionally.
+template <std::floating_point T>
+constexpr T error_free_threshold = std::numeric_limits<T>::min()/(std::numeric_limits<T>::epsilon()*std::numeric_limits<T>::epsilon());
+
+    // Whether the given policy declares that all bounds are finite (cf. `finite_only_policy<>`).
+template <typename PolicyT>
+constexpr bool assumes_finite = requires { requires PolicyT::finite_only; };
+
+    // Error bound of an elementary function in units of the last place, at runtime and during constant evaluation, where the
+    // `constexpr` kernels in <intervals/detail/math.hpp> are used instead of the standard library.
+struct ulp_bound
+{
+    int runtime;
+    int constant;
+};
+
+    // Error bounds by which the results of the elementary functions are padded for the policy  PolicyT  (cf.
+    // `libm_error_padding<>`). The bounds of `sin()`, `cos()`, and `tan()` include one additional ulp because these functions
+    // are evaluated for a reduced argument whose low-order part is added as a first-order correction.
+template <typename PolicyT>
+struct libm_padding
+{
+    static constexpr ulp_bound exp = { 0, 0 };
+    static constexpr ulp_bound log = { 0, 0 };
+    static constexpr ulp_bound pow = { 0, 0 };
+    static constexpr ulp_bound cbrt = { 0, 0 };
+    static constexpr ulp_bound sin = { 0, 0 };
+    static constexpr ulp_bound cos = { 0, 0 };
+    static constexpr ulp_bound tan = { 0, 0 };
+    static constexpr ulp_bound asin = { 0, 0 };
+    static constexpr ulp_bound acos = { 0, 0 };
+    static constexpr ulp_bound atan = { 0, 0 };
+    static constexpr ulp_bound atan2 = { 0, 0 };
+};
+template <typename PolicyT>
+requires requires { typename PolicyT::ulp_bounds; }
+struct libm_padding<PolicyT>
+{
+    using B = typename PolicyT::ulp_bounds;
+    using C = constexpr_ulp_bounds;
+
+    static constexpr ulp_bound exp = { B::exp, C::exp };
+    static constexpr ulp_bound log = { B::log, C::log };
+    static constexpr ulp_bound pow = { B::pow, 0 };  // not used during constant evaluation
+    static constexpr ulp_bound cbrt = { B::cbrt, C::cbrt };
+    static constexpr ulp_bound sin = { B::sin + 1, C::sin };
+    static constexpr ulp_bound cos = { B::cos + 1, C::cos };
+    static constexpr ulp_bound tan = { B::tan + 1, C::tan };
+    static constexpr ulp_bound asin = { B::asin, C::asin };
+    static constexpr ulp_bound acos = { B::acos, C::acos };
+    static constexpr ulp_bound atan = { B::atan, C::atan };
+    static constexpr ulp_bound atan2 = { B::atan2, C::atan2 };
+};
+
+    // Upper bound of  π  for clamping the results of the inverse trigonometric functions. `std::numbers::pi_v<T>` is rounded
+    // to nearest and may be smaller than  π ; the factor  1 + ε  raises it by at least one ulp. Halving is exact, so
+    // pi_up<T>/2  is an upper bound of  π/2 .
+template <std::floating_point T>
+constexpr T pi_up = std::numbers::pi_v<T>*(1 + std::numeric_limits<T>::epsilon());
+
+    // Widen a result  y  of an elementary function outward such that it bounds every  f  with  |y - f| ≤ n⋅ulp(f) , where
+    // n  is the error bound  b , and clamp it to the range  [min,max]  of the function. Because  ulp(f) ≤ ε⋅|f| , it
+    // suffices to widen  y  by  (n + 1)⋅ε⋅|y| , or by  n + 1  times the smallest subnormal number if that is larger: the
+    // additional term absorbs the rounding error of the subtraction, which therefore need not be rounded outward. An
+    // infinite  y  may bound a finite  f , and it is thus replaced by the largest finite number if it points inward.
+template <std::floating_point T>
+constexpr T
+pad_down(T y, ulp_bound b, T min = -std::numeric_limits<T>::infinity()) noexcept
+{
+    constexpr T eps = std::numeric_limits<T>::epsilon();
+    constexpr T inf = std::numeric_limits<T>::infinity();
+
+    int n = std::is_constant_evaluated() && b.constant > b.runtime ? b.constant : b.runtime;
+    if (n == 0 || y == -inf || y != y)
+    {
+        return y;
+    }
+    if (y == inf)
+    {
+        return std::numeric_limits<T>::max();
+    }
+    T d = (y < 0 ? -y : y)*((n + 1)*eps);
+    T dmin = (n + 1)*std::numeric_limits<T>::denorm_min();
+    T r = y - (d > dmin ? d : dmin);
+    return r < min ? min : r;
+}
+template <std::floating_point T>
+constexpr T
+pad_up(T y, ulp_bound b, T max = std::numeric_limits<T>::infinity()) noexcept
+{
+    return -detail::pad_down(-y, b, -max);
+}
+
+    // Compute the rounding error  e  of the floating-point sum  s = a + b  such that  a + b = s + e  holds exactly (Knuth's
+    // TwoSum algorithm). If  s  overflows,  e  is NaN.
+template <std::floating_point T>
+constexpr T
+two_sum_error(T a, T b, T s) noexcept
+{
+    T bb = s - a;
+    return (a - (s - bb)) + (b - bb);
+}
+
+
+} // namespace detail
+
+} // namespace intervals
+
+
+#endif // INCLUDED_INTERVALS_DETAIL_ROUNDING_HPP_
@@ -3,9 +3,15 @@
 #define INCLUDED_INTERVALS_DETAIL_SET_HPP_
 
 
+#include <bit>          // for popcount(), countr_zero()
 #include <array>
+#include <utility>      // for pair<>
+#include <cstddef>      // for size_t
 #include <cstdint>
-#include <type_traits>  // for is_same<>
+#include <iterator>     // for size()
+#include <concepts>     // for unsigned_integral<>
+#include <algorithm>    // for min(), max(), ranges::sort(), ranges::lower_bound()
+#include <type_traits>  // for is_same<>, conditional<>, is_enum<>, underlying_type<>
 
 
 namespace intervals {
@@ -57,6 +63,501 @@ constexpr std::uint32_t lut_4vK_gt  = 0b11'11'01'00'01'01'01'00'11'10'01'00'00'0
 constexpr std::uint8_t  lut_4vK_not = 0b11'01'10'00u;
 
 
+    // Sets of more than 64 values are stored in an array of 64-bit words. Bits beyond the number of values are always zero.
+constexpr std::size_t
+set_word_count(std::size_t n) noexcept
+{
+    return (n + 63)/64;
+}
+template <std::size_t N>
+struct set_words
+{
+    std::array<std::uint64_t, set_word_count(N)> words = { };
+
+    [[nodiscard]] friend constexpr set_words
+    operator &(set_words const& lhs, set_words const& rhs) noexcept
+    {
+        auto result = set_words{ };
+        for (std::size_t i = 0; i != lhs.words.size(); ++i)
+        {
+            result.words[i] = lhs.words[i] & rhs.words[i];
+        }
+        return result;
+    }
+    [[nodiscard]] friend constexpr set_words
+    operator |(set_words const& lhs, set_words const& rhs) noexcept
+    {
+        auto result = set_words{ };
+        for (std::size_t i = 0; i != lhs.words.size(); ++i)
+        {
+            result.words[i] = lhs.words[i] | rhs.words[i];
+        }
+        return result;
+    }
+    constexpr set_words&
+    operator |=(set_words const& rhs) noexcept
+    {
+        for (std::size_t i = 0; i != words.size(); ++i)
+        {
+            words[i] |= rhs.words[i];
+        }
+        return *this;
+    }
+    [[nodiscard]] friend constexpr bool
+    operator ==(set_words const& lhs, set_words const& rhs) noexcept = default;
+};
+
+    // Storage of the state of a `set<>` of  N  values: the smallest unsigned integer type which has at least  N  bits, or
+    // `set_words<N>` if there is no such type.
+template <std::size_t N>
+using set_storage_t =
+    std::conditional_t<N <= 8, std::uint8_t,
+    std::conditional_t<N <= 16, std::uint16_t,
+    std::conditional_t<N <= 32, std::uint32_t,
+    std::conditional_t<N <= 64, std::uint64_t,
+    set_words<N>>>>>;
+
+    // Bit operations on set storage.
+template <std::unsigned_integral W>
+[[nodiscard]] constexpr bool
+set_any(W s) noexcept
+{
+    return s != 0;
+}
+template <std::size_t N>
+[[nodiscard]] constexpr bool
+set_any(set_words<N> const& s) noexcept
+{
+    std::uint64_t any = 0;
+    for (std::uint64_t w : s.words)
+    {
+        any |= w;
+    }
+    return any != 0;
+}
+template <std::unsigned_integral W>
+[[nodiscard]] constexpr int
+set_count(W s) noexcept
+{
+    return std::popcount(s);
+}
+template <std::size_t N>
+[[nodiscard]] constexpr int
+set_count(set_words<N> const& s) noexcept
+{
+    int count = 0;
+    for (std::uint64_t w : s.words)
+    {
+        count += std::popcount(w);
+    }
+    return count;
+}
+template <std::unsigned_integral W>
+[[nodiscard]] constexpr bool
+set_test(W s, std::size_t i) noexcept
+{
+    return ((s >> i) & 1u) != 0;
+}
+template <std::size_t N>
+[[nodiscard]] constexpr bool
+set_test(set_words<N> const& s, std::size_t i) noexcept
+{
+    return ((s.words[i/64] >> (i % 64)) & 1u) != 0;
+}
+template <std::unsigned_integral W>
+constexpr void
+set_insert(W& s, std::size_t i) noexcept
+{
+    s |= W(W(1) << i);
+}
+template <std::size_t N>
+constexpr void
+set_insert(set_words<N>& s, std::size_t i) noexcept
+{
+    s.words[i/64] |= std::uint64_t(1) << (i % 64);
+}
+    // Index of the first bit  ≥ i  which is set, or  N  if there is none.
+template <std::size_t N, std::unsigned_integral W>
+[[nodiscard]] constexpr std::size_t
+set_next_index(W s, std::size_t i) noexcept
+{
+    W rest = i < N ? W(s >> i) : W(0);
+    return rest != 0 ? i + std::size_t(std::countr_zero(rest)) : N;
+}
+template <std::size_t N>
+[[nodiscard]] constexpr std::size_t
+set_next_index(set_words<N> const& s, std::size_t i) noexcept
+{
+    if (i >= N)
+    {
+        return N;
+    }
+    std::size_t w = i/64;
+    std::uint64_t rest = s.words[w] >> (i % 64);
+    if (rest != 0)
+    {
+        return i + std::size_t(std::countr_zero(rest));
+    }
+    while (++w != s.words.size())
+    {
+        if (s.words[w] != 0)
+        {
+            return 64*w + std::size_t(std::countr_zero(s.words[w]));
+        }
+    }
+    return N;
+}
+    // Conversion from and to an array of 64-bit words; bits beyond the number of values are discarded.
+template <std::size_t N, std::unsigned_integral W>
+[[nodiscard]] constexpr W
+set_from_words(std::array<std::uint64_t, 1> const& words) noexcept
+{
+    constexpr W mask = N < 64 ? W((1ull << N) - 1) : W(~0ull);
+
+    return W(words[0]) & mask;
+}
+template <std::size_t N, typename WordsT>
+requires std::is_same_v<WordsT, set_words<N>>
+[[nodiscard]] constexpr WordsT
+set_from_words(std::array<std::uint64_t, set_word_count(N)> const& words) noexcept
+{
+    auto result = WordsT{ words };
+    if constexpr (N % 64 != 0)
+    {
+        result.words.back() &= (std::uint64_t(1) << (N % 64)) - 1;
+    }
+    return result;
+}
+template <std::unsigned_integral W>
+[[nodiscard]] constexpr std::array<std::uint64_t, 1>
+set_to_words(W s) noexcept
+{
+    return { s };
+}
+template <std::size_t N>
+[[nodiscard]] constexpr std::array<std::uint64_t, set_word_count(N)>
+set_to_words(set_words<N> const& s) noexcept
+{
+    return s.words;
+}
+
+
+    // Values of integral and enumeration types have an integer key which can be used to look up their index in a table.
+template <typename T>
+concept set_keyed = std::is_integral_v<T> || std::is_enum_v<T>;
+
+template <set_keyed T>
+[[nodiscard]] constexpr long long
+set_value_key(T value) noexcept
+{
+    if constexpr (std::is_enum_v<T>)
+    {
+        return static_cast<long long>(static_cast<std::underlying_type_t<T>>(value));
+    }
+    else
+    {
+        return static_cast<long long>(value);
+    }
+}
+
+    // Maps a value to its index in the array of reflected values  Values , or to  `size(Values)`  if it is not a reflected value.
+    // If the keys of the values span a small range, the index is read from a direct-index table, or it is computed directly if
+    // the values are contiguous and ordered by their keys. Otherwise the index is looked up in a sorted table of keys. Values of
+    // other types are searched linearly.
+template <auto const& Values>
+struct set_value_index
+{
+    using value_type = typename std::remove_cvref_t<decltype(Values)>::value_type;
+
+    static constexpr std::size_t n = std::size(Values);
+
+    static_assert(n < 65535, "too many values");
+    using index_type = std::conditional_t<(n < 255), std::uint8_t, std::uint16_t>;
+
+    static consteval std::pair<long long, unsigned long long>
+    key_range()
+    {
+        if constexpr (set_keyed<value_type>)
+        {
+            if (n == 0)
+            {
+                return { 0, 0 };
+            }
+            long long lo = set_value_key(Values[0]);
+            long long hi = lo;
+            for (value_type value : Values)
+            {
+                lo = std::min(lo, set_value_key(value));
+                hi = std::max(hi, set_value_key(value));
+            }
+            return { lo, static_cast<unsigned long long>(hi) - static_cast<unsigned long long>(lo) + 1 };
+        }
+        else
+        {
+            return { 0, 0 };
+        }
+    }
+
+    static constexpr long long min_key = key_range().first;
+    static constexpr unsigned long long num_keys = key_range().second;
+
+        // Use a direct-index table if it has no more than 256 entries or 4 entries per value.
+    static constexpr bool direct = num_keys != 0 && num_keys <= std::max(std::size_t(256), 4*n);
+
+    static consteval bool
+    is_contiguous()
+    {
+        if constexpr (set_keyed<value_type>)
+        {
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                if (set_value_key(Values[i]) != min_key + static_cast<long long>(i))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    static constexpr bool contiguous = is_contiguous();
+
+    static consteval auto
+    make_direct_table()
+    {
+        auto result = std::array<index_type, direct && !contiguous ? num_keys : 0>{ };
+        if constexpr (direct && !contiguous)
+        {
+            result.fill(index_type(n));
+
+                // Iterate backwards so that the first occurrence of a value wins.
+            for (std::size_t i = n; i-- != 0; )
+            {
+                result[static_cast<std::size_t>(set_value_key(Values[i]) - min_key)] = index_type(i);
+            }
+        }
+        return result;
+    }
+    static constexpr auto direct_table = make_direct_table();
+
+    static consteval auto
+    make_sorted_table()
+    {
+        auto result = std::array<std::pair<long long, index_type>, set_keyed<value_type> && !direct ? n : 0>{ };
+        if constexpr (set_keyed<value_type> && !direct)
+        {
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                result[i] = { set_value_key(Values[i]), index_type(i) };
+            }
+            std::ranges::sort(result);
+        }
+        return result;
+    }
+    static constexpr auto sorted_table = make_sorted_table();
+
+    [[nodiscard]] static constexpr std::size_t
+    find(value_type value) noexcept
+    {
+        if constexpr (contiguous)
+        {
+            auto offset = static_cast<unsigned long long>(set_value_key(value)) - static_cast<unsigned long long>(min_key);
+            return offset < n ? static_cast<std::size_t>(offset) : n;
+        }
+        else if constexpr (direct)
+        {
+            auto offset = static_cast<unsigned long long>(set_value_key(value)) - static_cast<unsigned long long>(min_key);
+            return offset < num_keys ? direct_table[static_cast<std::size_t>(offset)] : n;
+        }
+        else if constexpr (set_keyed<value_type>)
+        {
+            long long key = set_value_key(value);
+            auto pos = std::ranges::lower_bound(sorted_table, key, { }, &std::pair<long long, index_type>::first);
+            return pos != sorted_table.end() && pos->first == key ? pos->second : n;
+        }
+        else
+        {
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                if (Values[i] == value)
+                {
+                    return i;
+                }
+            }
+            return n;
+        }
+    }
+};
+
+
+    // Image tables for `lift()`. The image of every value (or pair of values) under  F  is tabulated as a bit mask over  ValuesR .
+    // If the arguments have at most `set_lift_table_bits` values altogether, the image of every possible argument set is
+    // tabulated as well, and the image of a set is then a single table look-up; otherwise the images of the values in the
+    // argument sets are combined.
+constexpr std::size_t set_lift_table_bits = 10;
+
+void set_lift_result_not_reflected();  // not defined; called to make the table initialization ill-formed
+
+template <auto const& ValuesR, typename R>
+consteval std::array<std::uint64_t, set_word_count(std::size(ValuesR))>
+set_lift_image(R value)
+{
+    constexpr std::size_t n = std::size(ValuesR);
+
+    auto result = std::array<std::uint64_t, set_word_count(n)>{ };
+    std::size_t k = set_value_index<ValuesR>::find(value);
+    if (k == n)
+    {
+        set_lift_result_not_reflected();
+    }
+    result[k/64] |= std::uint64_t(1) << (k % 64);
+    return result;
+}
+
+template <std::size_t K>
+constexpr void
+set_lift_merge(std::array<std::uint64_t, K>& lhs, std::array<std::uint64_t, K> const& rhs) noexcept
+{
+    for (std::size_t i = 0; i != K; ++i)
+    {
+        lhs[i] |= rhs[i];
+    }
+}
+
+    // Call  f(i)  for the index  i  of every bit which is set.
+template <std::size_t K, typename F>
+constexpr void
+set_for_each_index(std::array<std::uint64_t, K> const& words, F&& f)
+{
+    for (std::size_t w = 0; w != K; ++w)
+    {
+        for (std::uint64_t bits = words[w]; bits != 0; bits &= bits - 1)
+        {
+            f(64*w + std::size_t(std::countr_zero(bits)));
+        }
+    }
+}
+
+template <typename F, auto const& ValuesR, auto const& ValuesX>
+struct set_lift_table_1
+{
+    static constexpr std::size_t nx = std::size(ValuesX);
+    using words = std::array<std::uint64_t, set_word_count(std::size(ValuesR))>;
+    using x_words = std::array<std::uint64_t, set_word_count(nx)>;
+
+    static constexpr bool full = nx <= set_lift_table_bits;
+
+    static consteval auto
+    make_value_table()
+    {
+        auto result = std::array<words, nx>{ };
+        for (std::size_t i = 0; i != nx; ++i)
+        {
+            result[i] = set_lift_image<ValuesR>(F{ }(ValuesX[i]));
+        }
+        return result;
+    }
+    static constexpr auto value_table = make_value_table();
+
+    static consteval auto
+    make_full_table()
+    {
+        auto result = std::array<words, full ? std::size_t(1) << nx : 0>{ };
+        for (std::size_t m = 0; m != result.size(); ++m)
+        {
+            set_for_each_index(x_words{ m }, [&](std::size_t i) { set_lift_merge(result[m], value_table[i]); });
+        }
+        return result;
+    }
+    static constexpr auto full_table = make_full_table();
+
+    [[nodiscard]] static constexpr words
+    apply(x_words const& x) noexcept
+    {
+        if constexpr (full)
+        {
+            return full_table[x[0]];
+        }
+        else
+        {
+            auto result = words{ };
+            set_for_each_index(x, [&](std::size_t i) { set_lift_merge(result, value_table[i]); });
+            return result;
+        }
+    }
+};
+
+template <typename F, auto const& ValuesR, auto const& ValuesX, auto const& ValuesY>
+struct set_lift_table_2
+{
+    static constexpr std::size_t nx = std::size(ValuesX);
+    static constexpr std::size_t ny = std::size(ValuesY);
+    using words = std::array<std::uint64_t, set_word_count(std::size(ValuesR))>;
+    using x_words = std::array<std::uint64_t, set_word_count(nx)>;
+    using y_words = std::array<std::uint64_t, set_word_count(ny)>;
+
+    static constexpr bool full = nx + ny <= set_lift_table_bits;
+
+    static consteval auto
+    make_value_table()
+    {
+        auto result = std::array<words, nx*ny>{ };
+        for (std::size_t i = 0; i != nx; ++i)
+        {
+            for (std::size_t j = 0; j != ny; ++j)
+            {
+                result[i*ny + j] = set_lift_image<ValuesR>(F{ }(ValuesX[i], ValuesY[j]));
+            }
+        }
+        return result;
+    }
+    static constexpr auto value_table = make_value_table();
+
+    static constexpr void
+    merge_images(words& result, x_words const& x, y_words const& y) noexcept
+    {
+        set_for_each_index(x, [&](std::size_t i)
+        {
+            set_for_each_index(y, [&](std::size_t j) { set_lift_merge(result, value_table[i*ny + j]); });
+        });
+    }
+
+        // The full table is indexed by  x | y << nx .
+    static consteval auto
+    make_full_table()
+    {
+        auto result = std::array<words, full ? std::size_t(1) << (nx + ny) : 0>{ };
+        for (std::size_t m = 0; m != result.size(); ++m)
+        {
+            merge_images(result[m], x_words{ m & ((std::size_t(1) << nx) - 1) }, y_words{ m >> nx });
+        }
+        return result;
+    }
+    static constexpr auto full_table = make_full_table();
+
+    [[nodiscard]] static constexpr words
+    apply(x_words const& x, y_words const& y) noexcept
+    {
+        if constexpr (full)
+        {
+            return full_table[x[0] | (y[0] << nx)];
+        }
+        else
+        {
+            auto result = words{ };
+            merge_images(result, x, y);
+            return result;
+        }
+    }
+};
+
+
+template <typename T> struct set_value_iterator;
+
+
 template <typename T0, typename... Ts>
 struct enforce_same
 {
@@ -0,0 +1,402 @@
+
+#ifndef INCLUDED_INTERVALS_DETAIL_SIMD_HPP_
+#define INCLUDED_INTERVALS_DETAIL_SIMD_HPP_
+
+
+#include <bit>          // for bit_ceil()
+#include <array>
+#include <limits>
+#include <cstddef>      // for size_t
+#include <concepts>     // for floating_point<>, derived_from<>, convertible_to<>, same_as<>
+#include <algorithm>    // for min()
+#include <type_traits>  // for remove_cvref<>, is_lvalue_reference<>
+
+#include <intervals/concepts.hpp>  // for arithmetic<>
+#include <intervals/rounding.hpp>  // for no_rounding
+#include <intervals/interval.hpp>
+
+#include <intervals/detail/interval_array.hpp>  // for bounds<>, array_operand<>, broadcast_operand<>
+
+
+namespace intervals {
+
+
+template <std::floating_point T, int N> class simd;
+template <int N> class simd_mask;
+template <int N> class simd_bool_set;
+
+
+namespace detail {
+
+
+    // Alignment of the lanes of `simd<>`: the size of the lane array rounded up to the next power of 2, such that the lanes
+    // can be loaded into a vector register with a single aligned load, but at most the size of a cache line.
+template <typename T, int N>
+constexpr std::size_t simd_alignment = std::min(std::bit_ceil(sizeof(T)*N), std::size_t(64));
+
+
+    // Operands of lane-wise operations on `interval<simd<T, N>, PolicyT>`. Scalar intervals are broadcast to all lanes; like
+    // other intervals, they must have the same rounding policy.
+template <typename X, typename T, int N, typename PolicyT>
+concept simd_interval_operand =
+    std::same_as<X, interval<simd<T, N>, PolicyT>>
+    || std::same_as<X, simd<T, N>>
+    || std::same_as<X, interval<T, PolicyT>>
+    || (arithmetic<X> && std::convertible_to<X, T>);
+template <typename X, typename Y, typename T, int N, typename PolicyT>
+concept simd_interval_operands =
+    (std::same_as<X, interval<simd<T, N>, PolicyT>> || std::same_as<Y, interval<simd<T, N>, PolicyT>>)
+    && simd_interval_operand<X, T, N, PolicyT> && simd_interval_operand<Y, T, N, PolicyT>;
+
+
+    // Bounds of an operand of a lane-wise comparison, and the address of the interval they were taken from if the operand was
+    // an lvalue interval (cf. `constrained_interval<>`).
+template <typename T, int N>
+struct simd_operand
+{
+    simd<T, N> lower_;
+    simd<T, N> upper_;
+    void const* id_;
+};
+
+template <int N>
+struct simd_condition : simd_bool_set<N>
+{
+};
+template <typename T, int N>
+struct simd_less_equal_constraint : simd_condition<N>  // lhs ≤ rhs
+{
+    simd_operand<T, N> lhs_;
+    simd_operand<T, N> rhs_;
+};
+template <typename T, int N>
+struct simd_less_constraint : simd_condition<N>  // lhs < rhs
+{
+    simd_operand<T, N> lhs_;
+    simd_operand<T, N> rhs_;
+};
+template <typename T, int N>
+struct simd_equal_constraint : simd_condition<N>  // lhs = rhs
+{
+    simd_operand<T, N> lhs_;
+    simd_operand<T, N> rhs_;
+};
+template <typename T, int N>
+struct simd_not_equal_constraint : simd_condition<N>  // lhs ≠ rhs
+{
+    simd_operand<T, N> lhs_;
+    simd_operand<T, N> rhs_;
+};
+
+template <typename T, int N>
+[[nodiscard]] constexpr simd_less_equal_constraint<T, N>
+operator !(simd_less_constraint<T, N> const& c)
+{
+    return { { !static_cast<simd_bool_set<N> const&>(c) }, c.rhs_, c.lhs_ };
+}
+template <typename T, int N>
+[[nodiscard]] constexpr simd_less_constraint<T, N>
+operator !(simd_less_equal_constraint<T, N> const& c)
+{
+    return { { !static_cast<simd_bool_set<N> const&>(c) }, c.rhs_, c.lhs_ };
+}
+template <typename T, int N>
+[[nodiscard]] constexpr simd_not_equal_constraint<T, N>
+operator !(simd_equal_constraint<T, N> const& c)
+{
+    return { { !static_cast<simd_bool_set<N> const&>(c) }, c.lhs_, c.rhs_ };
+}
+template <typename T, int N>
+[[nodiscard]] constexpr simd_equal_constraint<T, N>
+operator !(simd_not_equal_constraint<T, N> const& c)
+{
+    return { { !static_cast<simd_bool_set<N> const&>(c) }, c.lhs_, c.rhs_ };
+}
+
+
+struct simd_access
+{
+    template <int N>
+    [[nodiscard]] static constexpr std::array<bool, N>&
+    lanes(simd_mask<N>& x) noexcept
+    {
+        return x.v_;
+    }
+        // Operand adapters for the element-wise kernels of `interval_array<>`.
+    template <typename T, int N, typename PolicyT>
+    [[nodiscard]] static array_operand<T>
+    operand(interval<simd<T, N>, PolicyT> const& x) noexcept
+    {
+        return { x.lower_.v_.data(), x.upper_.v_.data() };
+    }
+    template <typename T, int N>
+    [[nodiscard]] static array_operand<T>
+    operand(simd<T, N> const& x) noexcept
+    {
+        return { x.v_.data(), x.v_.data() };
+    }
+    template <typename T>
+    [[nodiscard]] static constexpr broadcast_operand<T>
+    operand(interval_base<T> const& x) noexcept
+    {
+        return { x.lower_unchecked(), x.upper_unchecked() };
+    }
+    template <typename T, arithmetic X>
+    [[nodiscard]] static constexpr broadcast_operand<T>
+    operand(X const& x) noexcept
+    {
+        return { T(x), T(x) };
+    }
+
+        // Bounds of a comparison operand; the address is recorded only for lvalue intervals.
+    template <typename T, int N, typename X>
+    [[nodiscard]] static simd_operand<T, N>
+    comparison_operand(X&& x) noexcept
+    {
+        using X0 = std::remove_cvref_t<X>;
+
+        if constexpr (requires { typename X0::lane_type; })
+        {
+            return { x.lower_, x.upper_, std::is_lvalue_reference_v<X> ? &x : nullptr };
+        }
+        else if constexpr (std::same_as<X0, simd<T, N>>)
+        {
+            return { x, x, nullptr };
+        }
+        else if constexpr (std::derived_from<X0, interval_base<T>>)
+        {
+            return { simd<T, N>(x.lower_unchecked()), simd<T, N>(x.upper_unchecked()), nullptr };
+        }
+        else
+        {
+            return { simd<T, N>(T(x)), simd<T, N>(T(x)), nullptr };
+        }
+    }
+
+        // Mark the lanes of  x  which are not selected by the mask as unassigned.
+    template <typename T, int N, typename PolicyT>
+    [[nodiscard]] static interval<simd<T, N>, PolicyT>
+    masked(interval<simd<T, N>, PolicyT> const& x, simd_mask<N> const& mask) noexcept
+    {
+        constexpr T inf = std::numeric_limits<T>::infinity();
+
+        auto result = interval<simd<T, N>, PolicyT>{ };
+        for (std::size_t i = 0; i != std::size_t(N); ++i)
+        {
+            result.lower_.v_[i] = mask.v_[i] ? x.lower_.v_[i] : inf;
+            result.upper_.v_[i] = mask.v_[i] ? x.upper_.v_[i] : -inf;
+        }
+        return result;
+    }
+
+        // Apply the element-wise kernel  f  to all lanes (cf. `_transform()`). Lanes in which an operand is unassigned are
+        // unassigned in the result; without this, the kernels would turn the bounds  [∞,-∞]  of unassigned lanes into
+        // arbitrary values. Lanes which require the fallback of the kernel are recomputed in a second pass.
+    template <typename T, int N, typename PolicyT, typename F>
+    [[nodiscard]] static interval<simd<T, N>, PolicyT>
+    apply(F f, interval<simd<T, N>, PolicyT> const& x)
+    {
+        constexpr T inf = std::numeric_limits<T>::infinity();
+
+        auto result = interval<simd<T, N>, PolicyT>{ };
+        unsigned anyFallback = 0;
+        for (std::size_t i = 0; i != std::size_t(N); ++i)
+        {
+            T a = x.lower_.v_[i], b = x.upper_.v_[i];
+            bounds<T> r = f(a, b);
+            bool unassigned = a > b;
+            result.lower_.v_[i] = unassigned ? inf : r.lower;
+            result.upper_.v_[i] = unassigned ? -inf : r.upper;
+            if constexpr (requires { F::fallback_required(T{ }, T{ }); })
+            {
+                anyFallback |= unsigned(F::fallback_required(a, b) & !unassigned);
+            }
+        }
+        if constexpr (requires { F::fallback_required(T{ }, T{ }); })
+        {
+            if (anyFallback != 0)
+            {
+                for (std::size_t i = 0; i != std::size_t(N); ++i)
+                {
+                    T a = x.lower_.v_[i], b = x.upper_.v_[i];
+                    if (F::fallback_required(a, b) && !(a > b))
+                    {
+                        bounds<T> r = F::fallback(a, b);
+                        result.lower_.v_[i] = r.lower;
+                        result.upper_.v_[i] = r.upper;
+                    }
+                }
+            }
+        }
+        return result;
+    }
+    template <typename T, int N, typename PolicyT, typename F, typename X, typename Y>
+    [[nodiscard]] static interval<simd<T, N>, PolicyT>
+    apply(F f, X const& x, Y const& y)
+    {
+        constexpr T inf = std::numeric_limits<T>::infinity();
+
+        auto xo = operand<T>(x);
+        auto yo = operand<T>(y);
+        auto result = interval<simd<T, N>, PolicyT>{ };
+        unsigned anyFallback = 0;
+        for (std::size_t i = 0; i != std::size_t(N); ++i)
+        {
+            T a = xo.lower(i), b = xo.upper(i), c = yo.lower(i), d = yo.upper(i);
+            bounds<T> r = f(a, b, c, d);
+            bool unassigned = (a > b) | (c > d);
+            result.lower_.v_[i] = unassigned ? inf : r.lower;
+            result.upper_.v_[i] = unassigned ? -inf : r.upper;
+            if constexpr (requires { F::fallback_required(T{ }, T{ }, T{ }, T{ }); })
+            {
+                anyFallback |= unsigned(F::fallback_required(a, b, c, d) & !unassigned);
+            }
+        }
+        if constexpr (requires { F::fallback_required(T{ }, T{ }, T{ }, T{ }); })
+        {
+            if (anyFallback != 0)
+            {
+                for (std::size_t i = 0; i != std::size_t(N); ++i)
+                {
+                    T a = xo.lower(i), b = xo.upper(i), c = yo.lower(i), d = yo.upper(i);
+                    if (F::fallback_required(a, b, c, d) && !(a > b) && !(c > d))
+                    {
+                        bounds<T> r = F::fallback(a, b, c, d);
+                        result.lower_.v_[i] = r.lower;
+                        result.upper_.v_[i] = r.upper;
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+        // Lane-wise counterparts of `interval_functions::compare_*()`. Lanes in which either operand is unassigned yield the
+        // empty set.
+    template <typename T, int N, typename F>
+    [[nodiscard]] static simd_bool_set<N>
+    _compare(simd_operand<T, N> const& lhs, simd_operand<T, N> const& rhs, F f) noexcept
+    {
+        auto t = simd_mask<N>{ };
+        auto fl = simd_mask<N>{ };
+        for (std::size_t i = 0; i != std::size_t(N); ++i)
+        {
+            T llo = lhs.lower_.v_[i], lhi = lhs.upper_.v_[i];
+            T rlo = rhs.lower_.v_[i], rhi = rhs.upper_.v_[i];
+            bool active = !(llo > lhi) & !(rlo > rhi);
+            auto [pt, pf] = f(llo, lhi, rlo, rhi);
+            t.v_[i] = active & pt;
+            fl.v_[i] = active & pf;
+        }
+        return simd_bool_set<N>(t, fl);
+    }
+    template <typename T, int N>
+    [[nodiscard]] static simd_bool_set<N>
+    compare_eq(simd_operand<T, N> const& lhs, simd_operand<T, N> const& rhs) noexcept
+    {
+        return _compare(lhs, rhs, [](T llo, T lhi, T rlo, T rhi)
+        {
+            return std::array<bool, 2>{ bool((rhi >= llo) & (rlo <= lhi)), bool((llo != rhi) | (lhi != rlo)) };
+        });
+    }
+    template <typename T, int N>
+    [[nodiscard]] static simd_bool_set<N>
+    compare_neq(simd_operand<T, N> const& lhs, simd_operand<T, N> const& rhs) noexcept
+    {
+        return _compare(lhs, rhs, [](T llo, T lhi, T rlo, T rhi)
+        {
+            return std::array<bool, 2>{ bool((llo != rhi) | (lhi != rlo)), bool((rhi >= llo) & (rlo <= lhi)) };
+        });
+    }
+    template <typename T, int N>
+    [[nodiscard]] static simd_bool_set<N>
+    compare_lt(simd_operand<T, N> const& lhs, simd_operand<T, N> const& rhs) noexcept
+    {
+        return _compare(lhs, rhs, [](T llo, T lhi, T rlo, T rhi)
+        {
+            return std::array<bool, 2>{ llo < rhi, lhi >= rlo };
+        });
+    }
+    template <typename T, int N>
+    [[nodiscard]] static simd_bool_set<N>
+    compare_leq(simd_operand<T, N> const& lhs, simd_operand<T, N> const& rhs) noexcept
+    {
+        return _compare(lhs, rhs, [](T llo, T lhi, T rlo, T rhi)
+        {
+            return std::array<bool, 2>{ llo <= rhi, lhi > rlo };
+        });
+    }
+
+        // Narrow the lanes of  x  in which the condition  c  may hold, and mark all other lanes as unassigned. For
+        // floating-point intervals,  x < y  and  x ≤ y  impose the same constraint, and  x ≠ y  imposes none.
+    template <typename T, int N, typename PolicyT, typename F>
+    [[nodiscard]] static interval<simd<T, N>, PolicyT>
+    _constrain(interval<simd<T, N>, PolicyT> const& x, simd_bool_set<N> const& c, F f) noexcept
+    {
+        constexpr T inf = std::numeric_limits<T>::infinity();
+
+        auto result = interval<simd<T, N>, PolicyT>{ };
+        auto active = c.contains(true);
+        for (std::size_t i = 0; i != std::size_t(N); ++i)
+        {
+            bounds<T> r = f(i, x.lower_.v_[i], x.upper_.v_[i]);
+            result.lower_.v_[i] = active.v_[i] ? r.lower : inf;
+            result.upper_.v_[i] = active.v_[i] ? r.upper : -inf;
+        }
+        return result;
+    }
+    template <typename T, int N, typename PolicyT, typename C>
+    [[nodiscard]] static interval<simd<T, N>, PolicyT>
+    _constrain_less(interval<simd<T, N>, PolicyT> const& x, C const& c, bool isLhs, bool isRhs) noexcept
+    {
+        return _constrain(x, c, [&](std::size_t i, T xlo, T xhi)
+        {
+                // Apply constraints  x ≤ rhs⁺  and  lhs⁻ ≤ x .
+            T lo = isRhs ? intervals::max(c.lhs_.lower_.v_[i], xlo) : xlo;
+            T hi = isLhs ? intervals::min(xhi, c.rhs_.upper_.v_[i]) : xhi;
+            return bounds<T>{ lo, hi };
+        });
+    }
+    template <typename T, int N, typename PolicyT>
+    [[nodiscard]] static interval<simd<T, N>, PolicyT>
+    constrain(interval<simd<T, N>, PolicyT> const& x, simd_less_equal_constraint<T, N> const& c, bool isLhs, bool isRhs) noexcept
+    {
+        return _constrain_less(x, c, isLhs, isRhs);
+    }
+    template <typename T, int N, typename PolicyT>
+    [[nodiscard]] static interval<simd<T, N>, PolicyT>
+    constrain(interval<simd<T, N>, PolicyT> const& x, simd_less_constraint<T, N> const& c, bool isLhs, bool isRhs) noexcept
+    {
+        return _constrain_less(x, c, isLhs, isRhs);
+    }
+    template <typename T, int N, typename PolicyT>
+    [[nodiscard]] static interval<simd<T, N>, PolicyT>
+    constrain(interval<simd<T, N>, PolicyT> const& x, simd_equal_constraint<T, N> const& c, bool, bool) noexcept
+    {
+        return _constrain(x, c, [&](std::size_t i, T, T)
+        {
+                // Apply constraint  lhs = rhs .
+            return bounds<T>{
+                intervals::max(c.lhs_.lower_.v_[i], c.rhs_.lower_.v_[i]),
+                intervals::min(c.lhs_.upper_.v_[i], c.rhs_.upper_.v_[i])
+            };
+        });
+    }
+    template <typename T, int N, typename PolicyT>
+    [[nodiscard]] static interval<simd<T, N>, PolicyT>
+    constrain(interval<simd<T, N>, PolicyT> const& x, simd_not_equal_constraint<T, N> const& c, bool, bool) noexcept
+    {
+        return _constrain(x, c, [](std::size_t, T xlo, T xhi)
+        {
+            return bounds<T>{ xlo, xhi };
+        });
+    }
+};
+
+
+} // namespace detail
+
+} // namespace intervals
+
+
+#endif // INCLUDED_INTERVALS_DETAIL_SIMD_HPP_
@@ -15,6 +15,23 @@ template <interval_arg T> struct interval_arg_value_0_;
 template <interval_value T> struct interval_arg_value_0_<T> { using type = T; };
 template <any_interval IntervalT> struct interval_arg_value_0_<IntervalT> { using type = typename IntervalT::value_type; };
 
+    // Scalar arguments do not have a policy; they adopt the policy of the interval arguments they are combined with.
+template <interval_arg T> struct interval_arg_policy_0_ { using type = void; };
+template <any_interval IntervalT> requires requires { typename IntervalT::policy_type; } struct interval_arg_policy_0_<IntervalT> { using type = typename IntervalT::policy_type; };
+
+template <typename P1, typename P2> struct common_interval_policy_1_ { };  // intervals with different policies cannot be combined
+template <typename P> struct common_interval_policy_1_<P, P> { using type = P; };
+template <typename P> struct common_interval_policy_1_<void, P> { using type = P; };
+template <typename P> struct common_interval_policy_1_<P, void> { using type = P; };
+template <> struct common_interval_policy_1_<void, void> { using type = void; };
+
+template <typename... Ps> struct common_interval_policy_0_;
+template <typename P> struct common_interval_policy_0_<P> { using type = P; };
+template <typename P1, typename P2, typename... Ps> struct common_interval_policy_0_<P1, P2, Ps...> : common_interval_policy_0_<typename common_interval_policy_1_<P1, P2>::type, Ps...> { };
+
+template <typename P> struct default_interval_policy_ { using type = P; };
+template <> struct default_interval_policy_<void> { using type = no_rounding; };
+
 
 }  // namespace detail
 
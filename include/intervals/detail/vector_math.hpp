@@ -0,0 +1,255 @@
+
+#ifndef INCLUDED_INTERVALS_DETAIL_VECTOR_MATH_HPP_
+#define INCLUDED_INTERVALS_DETAIL_VECTOR_MATH_HPP_
+
+
+#include <bit>      // for bit_cast<>()
+#include <limits>
+#include <cstdint>  // for int64_t, uint64_t
+
+
+namespace intervals {
+
+namespace detail {
+
+
+    //
+    // Branch-free polynomial kernels for the elementary functions, used by the element-wise functions of `interval_array<>`.
+    //
+    // Unlike the functions of the standard library, the kernels below are inlined and contain neither branches nor calls,
+    // nor conversions between floating-point and integer types which lack SIMD instructions on common targets; compilers
+    // can therefore vectorize loops which call them. Integers are represented as integral `double` values and converted to
+    // their two's complement bit pattern by adding the constant  1.5⋅2⁵² .
+    //
+    // The kernels follow the argument reduction schemes of fdlibm (cf. detail/math.hpp) but use truncated Taylor series with
+    // a fixed number of terms. For finite arguments, the errors are bounded by
+    //
+    //     vector_exp()                  2 ulp, plus one subnormal spacing for subnormal results
+    //     vector_log()                  2 ulp
+    //     vector_sincos<>()             2 ulp       for  |x| ≤ 2²⁰⋅π/2
+    //     vector_atan()                 2 ulp
+    //
+    // where "ulp" refers to the unit in the last place of the exact result. The callers widen the results by
+    // `vector_math_error_bound` to obtain enclosures.
+    //
+
+
+    // Relative error bound of the kernels, including one additional ulp for the rounding of the widened bound.
+constexpr double vector_math_error_bound = 3*std::numeric_limits<double>::epsilon();
+
+    // Largest argument magnitude supported by `vector_reduce_pio2()`.
+constexpr double vector_trig_max_argument = 1647099.3291652855;  // 2²⁰⋅π/2
+
+constexpr double vector_round_magic = 6755399441055744.;  // 1.5⋅2⁵²
+
+    // Round  x  to the nearest integer for  |x| < 2⁵¹ .
+inline double
+vector_round(double x) noexcept
+{
+    return (x + vector_round_magic) - vector_round_magic;
+}
+    // Two's complement representation of an integral value  k  with  |k| < 2⁵¹ .
+inline std::int64_t
+vector_to_int(double k) noexcept
+{
+    return std::bit_cast<std::int64_t>(k + vector_round_magic) - std::bit_cast<std::int64_t>(vector_round_magic);
+}
+    // Compute  2ᵏ  for integral  k  with  -1022 ≤ k ≤ 1023 .
+inline double
+vector_exp2i(double k) noexcept
+{
+    return std::bit_cast<double>(std::uint64_t(detail::vector_to_int(k) + 1023) << 52);
+}
+
+    // Evaluate the polynomial  c[0] + c[1]⋅z + … + c[N-1]⋅zᴺ⁻¹  with Horner's scheme. The recursion is unrolled at compile
+    // time; a loop might not be unrolled before vectorization.
+template <int I = 0, int N>
+inline double
+vector_horner(double z, double const (&c)[N]) noexcept
+{
+    if constexpr (I == N - 1)
+    {
+        return c[I];
+    }
+    else
+    {
+        return detail::vector_horner<I + 1>(z, c)*z + c[I];
+    }
+}
+
+constexpr double vector_ln2_hi = 6.93147180369123816490e-01;
+constexpr double vector_ln2_lo = 1.90821492927058770002e-10;
+
+inline double
+vector_exp(double x) noexcept
+{
+        // 1/n!  for  n = 2, …, 14 .
+    constexpr double c[] = {
+        1./2, 1./6, 1./24, 1./120, 1./720, 1./5040, 1./40320, 1./362880, 1./3628800, 1./39916800, 1./479001600,
+        1./6227020800, 1./87178291200
+    };
+
+        // Clamping maps arguments beyond the overflow and underflow thresholds to results which overflow or underflow; NaN is
+        // passed through.
+    double xc = x < -746. ? -746. : x > 710. ? 710. : x;
+
+        // Reduce to  x = k⋅ln 2 + r  with  |r| ≤ ln(2)/2 , and compute  eʳ = 1 + r + r²⋅(1/2 + r/6 + …) .
+    double k = detail::vector_round(xc*1.4426950408889634);
+    double hi = xc - k*vector_ln2_hi;
+    double lo = k*vector_ln2_lo;
+    double r = hi - lo;
+    double p = 1 + (hi - (lo - r*r*detail::vector_horner(r, c)));
+
+        // Scale by  2ᵏ = 2ᵏ¹⋅2ᵏ²  in two steps so that neither factor overflows and only the second product is rounded.
+    double k1 = detail::vector_round(k*0.5);
+    double k2 = k - k1;
+    return p*detail::vector_exp2i(k1)*detail::vector_exp2i(k2);
+}
+
+inline double
+vector_log(double x) noexcept
+{
+    constexpr double inf = std::numeric_limits<double>::infinity();
+    constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+
+        // 2/(2n + 1)  for  n = 1, …, 11 .
+    constexpr double c[] = {
+        2./3, 2./5, 2./7, 2./9, 2./11, 2./13, 2./15, 2./17, 2./19, 2./21, 2./23
+    };
+
+        // Normalize subnormal arguments, then decompose  x = 2ᵉ⋅m  with  √½ < m ≤ √2 .
+    bool subnormal = x < std::numeric_limits<double>::min();
+    double xs = subnormal ? x*18014398509481984. : x;  // 2⁵⁴
+    std::uint64_t bits = std::bit_cast<std::uint64_t>(xs);
+    double e = std::bit_cast<double>((bits >> 52) | std::bit_cast<std::uint64_t>(4503599627370496.)) - 4503599627370496.;  // 2⁵²
+    e -= subnormal ? 1023. + 54. : 1023.;
+    double m = std::bit_cast<double>((bits & 0x000F'FFFF'FFFF'FFFFull) | 0x3FF0'0000'0000'0000ull);
+    bool large = m > 1.4142135623730951;
+    m = large ? m*0.5 : m;
+    e = large ? e + 1 : e;
+
+        // log(1 + f) = f - (f²/2 - s⋅(f²/2 + R))  with  s = f/(2 + f) ,  R = z⋅(2/3 + 2z/5 + …) ,  z = s² .
+    double f = m - 1;
+    double s = f/(2 + f);
+    double z = s*s;
+    double R = z*detail::vector_horner(z, c);
+    double hfsq = 0.5*f*f;
+    double result = e*vector_ln2_hi - ((hfsq - (s*(hfsq + R) + e*vector_ln2_lo)) - f);
+
+    return x > 0 && x < inf ? result
+         : x == 0 ? -inf
+         : x == inf ? inf
+         : nan;
+}
+
+constexpr double vector_pio2_1 = 1.57079632673412561417e+00;
+constexpr double vector_pio2_2 = 6.07710050630396597660e-11;
+constexpr double vector_pio2_3 = 2.02226624871116645580e-21;
+constexpr double vector_pio2_3t = 8.47842766036889956997e-32;
+
+    // Reduced argument  x = k⋅π/2 + (r_hi + r_lo) .
+struct vector_trig_reduction
+{
+    double k;
+    double r_hi;
+    double r_lo;
+};
+
+    // Reduce  x  modulo  π/2 . Requires  |x| ≤ 2²⁰⋅π/2 .
+inline vector_trig_reduction
+vector_reduce_pio2(double x) noexcept
+{
+    auto two_sum = [](double a, double b, double& e)
+    {
+        double s = a + b;
+        double bb = s - a;
+        e = (a - (s - bb)) + (b - bb);
+        return s;
+    };
+
+    double k = detail::vector_round(x*0.63661977236758134);
+    double a = x - k*vector_pio2_1;  // exact
+    double e1 = 0;
+    double b = two_sum(a, -k*vector_pio2_2, e1);
+    double e2 = 0;
+    double c = two_sum(b, -k*vector_pio2_3, e2);
+    double lo = (e1 + e2) - k*vector_pio2_3t;
+    double e3 = 0;
+    double r = two_sum(c, lo, e3);
+    return { k, r, e3 };
+}
+
+    // sin(r)  and  cos(r)  for  |r| ≲ π/4 .
+inline double
+vector_sin_kernel(double r, double rlo) noexcept
+{
+        // (-1)ⁿ/(2n + 1)!  for  n = 1, …, 9 .
+    constexpr double c[] = {
+        -1./6, 1./120, -1./5040, 1./362880, -1./39916800, 1./6227020800, -1./1307674368000, 1./355687428096000,
+        -1./121645100408832000
+    };
+
+    double z = r*r;
+    return r + (r*z*detail::vector_horner(z, c) + rlo*(1 - 0.5*z));
+}
+inline double
+vector_cos_kernel(double r, double rlo) noexcept
+{
+        // (-1)ⁿ/(2n)!  for  n = 2, …, 9 .
+    constexpr double c[] = {
+        1./24, -1./720, 1./40320, -1./3628800, 1./479001600, -1./87178291200, 1./20922789888000, -1./6402373705728000
+    };
+
+    double z = r*r;
+    double hz = 0.5*z;
+    double w = 1 - hz;
+    return w + (((1 - w) - hz) + (z*z*detail::vector_horner(z, c) - r*rlo));
+}
+
+    // Compute  sin(x)  from the reduced argument; the  Shift  argument selects  sin(x + Shift⋅π/2) , i.e.  Shift = 1  yields
+    // cos(x) .
+template <int Shift>
+inline double
+vector_sincos(vector_trig_reduction const& x) noexcept
+{
+    double s = detail::vector_sin_kernel(x.r_hi, x.r_lo);
+    double c = detail::vector_cos_kernel(x.r_hi, x.r_lo);
+    std::int64_t q = (detail::vector_to_int(x.k) + Shift) & 3;
+    double sc = (q & 1) != 0 ? c : s;
+    return (q & 2) != 0 ? -sc : sc;
+}
+
+inline double
+vector_atan(double x) noexcept
+{
+        // (-1)ⁿ/(2n + 1)  for  n = 1, …, 22 .
+    constexpr double c[] = {
+        -1./3, 1./5, -1./7, 1./9, -1./11, 1./13, -1./15, 1./17, -1./19, 1./21, -1./23, 1./25, -1./27, 1./29, -1./31,
+        1./33, -1./35, 1./37, -1./39, 1./41, -1./43, 1./45
+    };
+
+        // atan(x) = atan(c) + atan((x - c)/(1 + x⋅c))  for the breakpoints  c = 1/2, 1, 3/2 , and  atan(x) = π/2 + atan(-1/x)
+        // for  x ≥ 39/16 .
+    double ax = x < 0 ? -x : x;
+    bool b0 = ax >= 0.4375;
+    bool b1 = ax >= 0.6875;
+    bool b2 = ax >= 1.1875;
+    bool b3 = ax >= 2.4375;
+    double bc = b2 ? 1.5 : b1 ? 1. : b0 ? 0.5 : 0.;
+    double hi = b3 ? 1.57079632679489655800e+00 : b2 ? 9.82793723247329054082e-01 : b1 ? 7.85398163397448278999e-01 : b0 ? 4.63647609000806093515e-01 : 0.;
+    double lo = b3 ? 6.12323399573676603587e-17 : b2 ? 1.39033110312309984516e-17 : b1 ? 3.06161699786838301793e-17 : b0 ? 2.26987774529616870924e-17 : 0.;
+    double num = b3 ? -1. : ax - bc;
+    double den = b3 ? ax : 1 + ax*bc;
+    double t = num/den;
+    double z = t*t;
+    double result = hi + (lo + (t + t*z*detail::vector_horner(z, c)));
+    return x < 0 ? -result : result;
+}
+
+
+} // namespace detail
+
+} // namespace intervals
+
+
+#endif // INCLUDED_INTERVALS_DETAIL_VECTOR_MATH_HPP_
@@ -0,0 +1,68 @@
+
+#ifndef INCLUDED_INTERVALS_EXPRESSION_HPP_
+#define INCLUDED_INTERVALS_EXPRESSION_HPP_
+
+
+#include <cmath>        // for isfinite()
+#include <type_traits>  // for remove_cvref<>
+
+#include <gsl-lite/gsl-lite.hpp>  // for gsl_ExpectsDebug()
+
+#include <intervals/concepts.hpp>
+#include <intervals/interval.hpp>
+#include <intervals/type_traits.hpp>
+
+#include <intervals/detail/expression.hpp>
+
+
+namespace intervals {
+
+namespace gsl = gsl_lite;
+
+
+    //
+    // Opt-in lazy evaluation of interval expressions.
+    //
+    // `lazy(x)` wraps a floating-point interval in an expression node. The arithmetic operators +, -, *, / applied to an
+    // expression node and another expression node, an interval, or a scalar build an expression tree instead of an
+    // interval; `evaluate()` computes the value of the tree in a single pass:
+    //
+    //     auto y = evaluate(y0 + (lazy(xc) - x0)/(x1 - x0)*(y1 - y0));
+    //
+    // The result is identical to that of the corresponding eager expression. The operands are checked for assignedness once,
+    // and intermediate results are computed with the arithmetic of the rounding policy only; special values are handled by
+    // re-evaluating the expression eagerly if an operand or an intermediate result has a non-finite bound, or if a divisor
+    // contains 0.
+    //
+    // Expression nodes store copies of their operands, so they can be returned from functions and stored.
+    //
+template <floating_point_interval X>
+[[nodiscard]] constexpr detail::lazy_terminal<interval_t<X>>
+lazy(X const& x)
+{
+    return detail::lazy_terminal<interval_t<X>>(interval_t<X>(x));
+}
+
+template <detail::lazy_node E>
+[[nodiscard]] constexpr typename std::remove_cvref_t<E>::interval_type
+evaluate(E const& expr)
+{
+    gsl_ExpectsDebug(expr._assigned());
+
+    using Result = typename std::remove_cvref_t<E>::interval_type;
+    using T = typename Result::value_type;
+    using Policy = typename Result::policy_type;
+    T check = 0;
+    auto result = expr.template _bounds<Policy, T>(check);
+    if (std::isfinite(check))
+    {
+        return Result{ result.lower, result.upper };
+    }
+    return Result(expr._evaluate());
+}
+
+
+} // namespace intervals
+
+
+#endif // INCLUDED_INTERVALS_EXPRESSION_HPP_
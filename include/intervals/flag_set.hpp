@@ -0,0 +1,312 @@
+
+#ifndef INCLUDED_INTERVALS_FLAG_SET_HPP_
+#define INCLUDED_INTERVALS_FLAG_SET_HPP_
+
+
+#include <iosfwd>
+#include <utility>           // for pair<>
+#include <type_traits>       // for is_enum<>, underlying_type<>, make_unsigned<>
+#include <initializer_list>
+
+#include <gsl-lite/gsl-lite.hpp>  // for type_identity<>, gsl_Expects(), gsl_ExpectsDebug()
+
+#include <intervals/set.hpp>
+
+#include <intervals/math.hpp>   // to make assign*() and reset() available
+#include <intervals/logic.hpp>  // to make if_else(), possibly() et al. for Boolean arguments available
+
+
+namespace intervals {
+
+namespace gsl = gsl_lite;
+
+
+    //
+    // Set of values of a flag enum.
+    //
+    // A set of values of a flag enum  E  is represented by two bit masks: the "must" mask has the flags that are set in every
+    // value in the set, and the "may" mask has the flags that are set in at least one value in the set. The set represents all
+    // values  v  with  `must ⊆ v ⊆ may` . This is the smallest such range which encloses the values assigned to the set, much
+    // like an interval encloses a set of numbers. Unlike `set<E>`, which would need one bit per flag combination, the
+    // representation has a fixed size, and the operators `&`, `|`, `^`, `==`, and `!=` as well as `contains()` are computed with
+    // a few bitwise operations. Because every flag is computed independently, the results of `&`, `|`, and `^` are exact.
+    //
+    // Flags are tested by comparing masked values, for instance
+    //
+    //     auto canWrite = (perms & Permissions::write) == Permissions::write;  // `set<bool>`
+    //
+    // The default-constructed set is empty. Operators and predicates expect their arguments to be non-empty.
+    //
+template <typename E>
+class flag_set
+{
+    static_assert(std::is_enum_v<E>, "flag_set<> requires an enumeration type");
+
+public:
+    using value_type = E;
+    using mask_type = std::make_unsigned_t<std::underlying_type_t<E>>;
+
+private:
+        // An empty set is represented by  must = ~0  and  may = 0 .
+    mask_type must_ = mask_type(~mask_type(0));
+    mask_type may_ = 0;
+
+    constexpr flag_set(mask_type _must, mask_type _may)
+        : must_(_must), may_(_may)
+    {
+    }
+
+    static constexpr mask_type
+    bits(E value) noexcept
+    {
+        return static_cast<mask_type>(value);
+    }
+    static constexpr std::pair<bool, bool>
+    compare_eq(flag_set const& lhs, flag_set const& rhs)
+    {
+            // The sets have a common value if the union of the "must" masks is contained in both "may" masks.
+        bool anyMatch = ((lhs.must_ | rhs.must_) & ~(lhs.may_ & rhs.may_)) == 0;
+        bool bothSingle = lhs.must_ == lhs.may_ && rhs.must_ == rhs.may_;
+        bool anyPossibleMismatch = !bothSingle || lhs.must_ != rhs.must_;
+        return { anyPossibleMismatch, anyMatch };
+    }
+
+public:
+    constexpr flag_set() = default;
+    constexpr flag_set(E value)
+        : must_(bits(value)), may_(bits(value))
+    {
+    }
+    explicit constexpr flag_set(std::initializer_list<E> _values)
+    {
+        for (E value : _values)
+        {
+            assign(value);
+        }
+    }
+    static constexpr flag_set
+    from_masks(E must, E may)
+    {
+        gsl_Expects((bits(must) & ~bits(may)) == 0);
+
+        return flag_set(bits(must), bits(may));
+    }
+
+    constexpr flag_set&
+    reset()
+    {
+        must_ = mask_type(~mask_type(0));
+        may_ = 0;
+        return *this;
+    }
+    constexpr flag_set&
+    reset(flag_set const& rhs)
+    {
+        must_ = rhs.must_;
+        may_ = rhs.may_;
+        return *this;
+    }
+
+    constexpr bool
+    assigned() const
+    {
+        return (must_ & ~may_) == 0;
+    }
+
+    flag_set(flag_set const&) = default;
+    flag_set& operator =(flag_set const&) = delete;
+    constexpr flag_set&
+    assign(flag_set const& rhs)
+    {
+        gsl_ExpectsDebug(rhs.assigned());
+
+        must_ &= rhs.must_;
+        may_ |= rhs.may_;
+        return *this;
+    }
+    constexpr flag_set&
+    assign(E value)
+    {
+        must_ &= bits(value);
+        may_ |= bits(value);
+        return *this;
+    }
+
+        // Flags that are set in every value in the set.
+    [[nodiscard]] constexpr E
+    must() const
+    {
+        gsl_ExpectsDebug(assigned());
+
+        return E(must_);
+    }
+        // Flags that are set in some value in the set.
+    [[nodiscard]] constexpr E
+    may() const
+    {
+        gsl_ExpectsDebug(assigned());
+
+        return E(may_);
+    }
+
+    [[nodiscard]] constexpr bool
+    contains(E value) const
+    {
+        return (must_ & ~bits(value)) == 0 && (bits(value) & ~may_) == 0;
+    }
+    [[nodiscard]] constexpr bool
+    contains(flag_set const& _set) const
+    {
+        return !_set.assigned() || ((must_ & ~_set.must_) == 0 && (_set.may_ & ~may_) == 0);
+    }
+    [[nodiscard]] constexpr bool
+    matches(flag_set const& _set) const
+    {
+        return (!assigned() && !_set.assigned()) || (must_ == _set.must_ && may_ == _set.may_);
+    }
+    [[nodiscard]] constexpr E
+    value() const
+    {
+        gsl_ExpectsDebug(assigned());
+        gsl_Expects(must_ == may_);
+
+        return E(must_);
+    }
+
+    [[nodiscard]] friend constexpr flag_set
+    operator &(flag_set const& lhs, flag_set const& rhs)
+    {
+        gsl_ExpectsDebug(lhs.assigned() && rhs.assigned());
+
+        return flag_set(lhs.must_ & rhs.must_, lhs.may_ & rhs.may_);
+    }
+    [[nodiscard]] friend constexpr flag_set
+    operator |(flag_set const& lhs, flag_set const& rhs)
+    {
+        gsl_ExpectsDebug(lhs.assigned() && rhs.assigned());
+
+        return flag_set(lhs.must_ | rhs.must_, lhs.may_ | rhs.may_);
+    }
+    [[nodiscard]] friend constexpr flag_set
+    operator ^(flag_set const& lhs, flag_set const& rhs)
+    {
+        gsl_ExpectsDebug(lhs.assigned() && rhs.assigned());
+
+            // Flags that are known in both operands are known in the result; all other flags are unknown.
+        mask_type known = ~(lhs.must_ ^ lhs.may_) & ~(rhs.must_ ^ rhs.may_);
+        mask_type flags = lhs.must_ ^ rhs.must_;
+        return flag_set(mask_type(flags & known), mask_type(flags | ~known));
+    }
+
+    [[nodiscard]] friend constexpr set<bool>
+    operator ==(flag_set const& lhs, flag_set const& rhs)
+    {
+        gsl_ExpectsDebug(lhs.assigned() && rhs.assigned());
+
+        auto [anyPossibleMismatch, anyMatch] = compare_eq(lhs, rhs);
+        auto result = set<bool>{ };
+        if (anyMatch)
+        {
+            result.assign(true);
+        }
+        if (anyPossibleMismatch)
+        {
+            result.assign(false);
+        }
+        return result;
+    }
+    [[nodiscard]] friend constexpr set<bool>
+    operator !=(flag_set const& lhs, flag_set const& rhs)
+    {
+        gsl_ExpectsDebug(lhs.assigned() && rhs.assigned());
+
+        auto [anyPossibleMismatch, anyMatch] = compare_eq(lhs, rhs);
+        auto result = set<bool>{ };
+        if (anyMatch)
+        {
+            result.assign(false);
+        }
+        if (anyPossibleMismatch)
+        {
+            result.assign(true);
+        }
+        return result;
+    }
+};
+
+
+template <typename ElemT, typename TraitsT, typename E>
+std::basic_ostream<ElemT, TraitsT>&
+operator <<(std::basic_ostream<ElemT, TraitsT>& stream, flag_set<E> const& x)
+{
+    using U = std::underlying_type_t<E>;
+
+    stream << ElemT('{') << ElemT(' ');
+    if (x.assigned())
+    {
+        stream << +U(x.must()) << ElemT(' ') << ElemT('.') << ElemT('.') << ElemT(' ') << +U(x.may());
+    }
+    stream << ElemT(' ') << ElemT('}');
+    return stream;
+}
+
+
+inline namespace logic {
+
+
+template <typename E>
+[[nodiscard]] constexpr flag_set<E>
+if_else(set<bool> cond, flag_set<E> resultIfTrue, flag_set<E> resultIfFalse)
+{
+    flag_set<E> result;
+    if (intervals::possibly(cond))
+    {
+        result.assign(resultIfTrue);
+    }
+    if (intervals::possibly_not(cond))
+    {
+        result.assign(resultIfFalse);
+    }
+    return result;
+}
+template <typename E>
+[[nodiscard]] constexpr flag_set<E>
+if_else(set<bool> cond, E resultIfTrue, flag_set<E> resultIfFalse)
+{
+    return intervals::if_else(cond, flag_set<E>(resultIfTrue), resultIfFalse);
+}
+template <typename E>
+[[nodiscard]] constexpr flag_set<E>
+if_else(set<bool> cond, flag_set<E> resultIfTrue, E resultIfFalse)
+{
+    return intervals::if_else(cond, resultIfTrue, flag_set<E>(resultIfFalse));
+}
+
+
+} // inline namespace logic
+
+
+template <typename E>
+constexpr void
+assign(flag_set<E>& lhs, gsl::type_identity_t<flag_set<E>> const& rhs)
+{
+    lhs.reset(rhs);
+}
+template <typename E>
+constexpr void
+assign_partial(flag_set<E>& lhs, gsl::type_identity_t<flag_set<E>> const& rhs)
+{
+    lhs.assign(rhs);
+}
+template <typename E>
+constexpr void
+reset(flag_set<E>& lhs, gsl::type_identity_t<flag_set<E>> const& rhs)
+{
+    lhs.reset(rhs);
+}
+
+
+} // namespace intervals
+
+
+#endif // INCLUDED_INTERVALS_FLAG_SET_HPP_
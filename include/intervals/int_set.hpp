@@ -0,0 +1,633 @@
+
+#ifndef INCLUDED_INTERVALS_INT_SET_HPP_
+#define INCLUDED_INTERVALS_INT_SET_HPP_
+
+
+#include <bit>               // for countr_zero()
+#include <array>
+#include <iosfwd>
+#include <cstddef>           // for size_t, ptrdiff_t
+#include <cstdint>           // for uint64_t
+#include <utility>           // for pair<>, swap()
+#include <initializer_list>
+
+#include <gsl-lite/gsl-lite.hpp>  // for dim, type_identity<>, gsl_Expects(), gsl_ExpectsDebug()
+
+#include <intervals/set.hpp>
+#include <intervals/interval.hpp>
+
+#include <intervals/math.hpp>   // to make assign*() and reset() available
+#include <intervals/logic.hpp>  // to make if_else(), possibly() et al. for Boolean arguments available
+
+#include <intervals/detail/set.hpp>
+#include <intervals/detail/int_set.hpp>
+
+
+namespace intervals {
+
+namespace gsl = gsl_lite;
+
+
+    //
+    // Set of integers in the range  [Min, Max] .
+    //
+    // Unlike `interval<int>`, which can only represent the hull of a set of integers, `int_set<>` represents sparse sets such
+    // as  {1, 7, 63}  exactly. The set is stored as a bit mask with one bit per value in  [Min, Max] , kept in an array of
+    // 64-bit words. Enumerating the elements with `enumerate()` or `at()` visits only the elements of the set. Adding or
+    // subtracting a constant shifts the bit mask, and the sum of two sets, `min()`, `max()`, and the relational operators
+    // are computed with word-level operations. The bounds of the set are available as `lower()` and `upper()`, and `hull()`
+    // converts the set to an `interval<int>`.
+    //
+    // Operations whose results stay in the same range, i.e. adding, subtracting, or multiplying by an integer, expect the
+    // resulting values to lie in  [Min, Max] . The sum of two sets has the range  [MinL + MinR, MaxL + MaxR] .
+    //
+template <int Min, int Max>
+class int_set
+{
+    static_assert(Min <= Max, "int_set<> requires Min ≤ Max");
+
+public:
+    using value_type = int;
+
+    static constexpr int min_value = Min;
+    static constexpr int max_value = Max;
+    static constexpr gsl::dim num_values = gsl::dim(Max) - Min + 1;
+    static constexpr gsl::dim num_words = gsl::dim(detail::set_word_count(std::size_t(num_values)));
+
+private:
+    static constexpr std::size_t n = std::size_t(num_values);
+
+    using storage = detail::set_words<n>;
+
+    storage state_ = { };
+
+    constexpr explicit int_set(storage _state)
+        : state_(_state)
+    {
+    }
+
+    static constexpr std::size_t
+    index_of(int value)
+    {
+        gsl_Expects(value >= Min && value <= Max);
+
+        return std::size_t(std::ptrdiff_t(value) - Min);
+    }
+    static constexpr std::pair<bool, bool>
+    compare_eq(int_set const& lhs, int_set const& rhs)
+    {
+        bool anyMatch = detail::set_any(lhs.state_ & rhs.state_);
+        int cl = detail::set_count(lhs.state_);
+        int cr = detail::set_count(rhs.state_);
+        bool anyPossibleMismatch = cl > 1 || cr > 1 || (cl == 1 && cr == 1 && !anyMatch);
+        return { anyPossibleMismatch, anyMatch };
+    }
+    static constexpr set<bool>
+    make_truth(bool mayBeFalse, bool mayBeTrue)
+    {
+        return set<bool>::from_bits((mayBeFalse ? 1u : 0u) | (mayBeTrue ? 2u : 0u));
+    }
+
+public:
+    constexpr int_set() = default;
+    constexpr int_set(int value)
+    {
+        detail::set_insert(state_, index_of(value));
+    }
+    explicit constexpr int_set(std::initializer_list<int> _values)
+    {
+        for (int value : _values)
+        {
+            detail::set_insert(state_, index_of(value));
+        }
+    }
+        // Set of all integers in the interval  x .
+    explicit constexpr int_set(interval<int> const& x)
+    {
+        gsl_Expects(x.assigned());
+
+        state_ = detail::int_set_range_mask<n>(std::ptrdiff_t(index_of(x.lower())), std::ptrdiff_t(index_of(x.upper())));
+    }
+    static constexpr int_set
+    from_words(std::array<std::uint64_t, num_words> const& words)
+    {
+        return int_set(detail::set_from_words<n, storage>(words));
+    }
+
+    constexpr int_set&
+    reset()
+    {
+        state_ = { };
+        return *this;
+    }
+    constexpr int_set&
+    reset(int_set const& rhs)
+    {
+        state_ = rhs.state_;
+        return *this;
+    }
+
+    constexpr bool
+    assigned() const
+    {
+        return detail::set_any(state_);
+    }
+
+    int_set(int_set const&) = default;
+    int_set& operator =(int_set const&) = delete;
+    constexpr int_set&
+    assign(int_set const& rhs)
+    {
+        gsl_ExpectsDebug(rhs.assigned());
+
+        state_ |= rhs.state_;
+        return *this;
+    }
+    constexpr int_set&
+    assign(int value)
+    {
+        detail::set_insert(state_, index_of(value));
+        return *this;
+    }
+
+    constexpr std::array<std::uint64_t, num_words>
+    to_words() const
+    {
+        return state_.words;
+    }
+
+        // Number of elements.
+    [[nodiscard]] constexpr gsl::dim
+    count() const
+    {
+        return detail::set_count(state_);
+    }
+    [[nodiscard]] constexpr bool
+    contains(int value) const
+    {
+        return value >= Min && value <= Max && detail::set_test(state_, index_of(value));
+    }
+    [[nodiscard]] constexpr bool
+    contains(int_set const& _set) const
+    {
+        return (state_ & _set.state_) == _set.state_;
+    }
+    [[nodiscard]] constexpr bool
+    matches(int_set const& _set) const
+    {
+        return state_ == _set.state_;
+    }
+    [[nodiscard]] constexpr int
+    value() const
+    {
+        gsl_ExpectsDebug(assigned());
+
+        if (detail::set_count(state_) == 1)
+        {
+            return Min + int(detail::set_next_index<n>(state_, 0));
+        }
+        gsl_FailFast();
+    }
+
+        // Smallest and largest element.
+    [[nodiscard]] constexpr int
+    lower() const
+    {
+        gsl_ExpectsDebug(assigned());
+
+        return Min + int(detail::set_next_index<n>(state_, 0));
+    }
+    [[nodiscard]] constexpr int
+    upper() const
+    {
+        gsl_ExpectsDebug(assigned());
+
+        return Min + int(detail::int_set_last_index(state_));
+    }
+    [[nodiscard]] constexpr interval<int>
+    hull() const
+    {
+        return interval<int>{ lower(), upper() };
+    }
+
+    [[nodiscard]] friend constexpr int_set
+    operator +(int_set const& x)
+    {
+        return x;
+    }
+    [[nodiscard]] friend constexpr int_set
+    operator +(int_set const& lhs, int rhs)
+    {
+        gsl_ExpectsDebug(lhs.assigned());
+        gsl_Expects(lhs.lower() + rhs >= Min && lhs.upper() + rhs <= Max);
+
+        return int_set(detail::int_set_shift<n>(lhs.state_, rhs));
+    }
+    [[nodiscard]] friend constexpr int_set
+    operator +(int lhs, int_set const& rhs)
+    {
+        return rhs + lhs;
+    }
+    [[nodiscard]] friend constexpr int_set
+    operator -(int_set const& lhs, int rhs)
+    {
+        return lhs + -rhs;
+    }
+    [[nodiscard]] friend constexpr int_set
+    operator *(int_set const& lhs, int rhs)
+    {
+        gsl_ExpectsDebug(lhs.assigned());
+
+        auto result = int_set{ };
+        for (std::size_t i = detail::set_next_index<n>(lhs.state_, 0); i != n; i = detail::set_next_index<n>(lhs.state_, i + 1))
+        {
+            result.assign((Min + int(i))*rhs);
+        }
+        return result;
+    }
+    [[nodiscard]] friend constexpr int_set
+    operator *(int lhs, int_set const& rhs)
+    {
+        return rhs*lhs;
+    }
+
+    [[nodiscard]] friend constexpr set<bool>
+    operator ==(int_set const& lhs, int_set const& rhs)
+    {
+        gsl_ExpectsDebug(lhs.assigned() && rhs.assigned());
+
+        auto [anyPossibleMismatch, anyMatch] = compare_eq(lhs, rhs);
+        return make_truth(anyPossibleMismatch, anyMatch);
+    }
+    [[nodiscard]] friend constexpr set<bool>
+    operator !=(int_set const& lhs, int_set const& rhs)
+    {
+        gsl_ExpectsDebug(lhs.assigned() && rhs.assigned());
+
+        auto [anyPossibleMismatch, anyMatch] = compare_eq(lhs, rhs);
+        return make_truth(anyMatch, anyPossibleMismatch);
+    }
+    [[nodiscard]] friend constexpr set<bool>
+    operator ==(int_set const& lhs, int rhs)
+    {
+        gsl_ExpectsDebug(lhs.assigned());
+
+        bool anyMatch = lhs.contains(rhs);
+        return make_truth(!anyMatch || lhs.count() > 1, anyMatch);
+    }
+    [[nodiscard]] friend constexpr set<bool>
+    operator ==(int lhs, int_set const& rhs)
+    {
+        return rhs == lhs;
+    }
+    [[nodiscard]] friend constexpr set<bool>
+    operator !=(int_set const& lhs, int rhs)
+    {
+        return !(lhs == rhs);
+    }
+    [[nodiscard]] friend constexpr set<bool>
+    operator !=(int lhs, int_set const& rhs)
+    {
+        return !(rhs == lhs);
+    }
+
+        // The relational operators only depend on the smallest and largest elements of their operands.
+    template <int MinR, int MaxR>
+    [[nodiscard]] friend constexpr set<bool>
+    operator <(int_set const& lhs, int_set<MinR, MaxR> const& rhs)
+    {
+        return less(lhs.lower(), lhs.upper(), rhs.lower(), rhs.upper());
+    }
+    [[nodiscard]] friend constexpr set<bool>
+    operator <(int_set const& lhs, int rhs)
+    {
+        return less(lhs.lower(), lhs.upper(), rhs, rhs);
+    }
+    [[nodiscard]] friend constexpr set<bool>
+    operator <(int lhs, int_set const& rhs)
+    {
+        return less(lhs, lhs, rhs.lower(), rhs.upper());
+    }
+    template <int MinR, int MaxR>
+    [[nodiscard]] friend constexpr set<bool>
+    operator <=(int_set const& lhs, int_set<MinR, MaxR> const& rhs)
+    {
+        return !less(rhs.lower(), rhs.upper(), lhs.lower(), lhs.upper());
+    }
+    [[nodiscard]] friend constexpr set<bool>
+    operator <=(int_set const& lhs, int rhs)
+    {
+        return !less(rhs, rhs, lhs.lower(), lhs.upper());
+    }
+    [[nodiscard]] friend constexpr set<bool>
+    operator <=(int lhs, int_set const& rhs)
+    {
+        return !less(rhs.lower(), rhs.upper(), lhs, lhs);
+    }
+    template <int MinR, int MaxR>
+    [[nodiscard]] friend constexpr set<bool>
+    operator >(int_set const& lhs, int_set<MinR, MaxR> const& rhs)
+    {
+        return less(rhs.lower(), rhs.upper(), lhs.lower(), lhs.upper());
+    }
+    [[nodiscard]] friend constexpr set<bool>
+    operator >(int_set const& lhs, int rhs)
+    {
+        return less(rhs, rhs, lhs.lower(), lhs.upper());
+    }
+    [[nodiscard]] friend constexpr set<bool>
+    operator >(int lhs, int_set const& rhs)
+    {
+        return less(rhs.lower(), rhs.upper(), lhs, lhs);
+    }
+    template <int MinR, int MaxR>
+    [[nodiscard]] friend constexpr set<bool>
+    operator >=(int_set const& lhs, int_set<MinR, MaxR> const& rhs)
+    {
+        return !less(lhs.lower(), lhs.upper(), rhs.lower(), rhs.upper());
+    }
+    [[nodiscard]] friend constexpr set<bool>
+    operator >=(int_set const& lhs, int rhs)
+    {
+        return !less(lhs.lower(), lhs.upper(), rhs, rhs);
+    }
+    [[nodiscard]] friend constexpr set<bool>
+    operator >=(int lhs, int_set const& rhs)
+    {
+        return !less(lhs, lhs, rhs.lower(), rhs.upper());
+    }
+
+private:
+        // Truth value of  x < y  for  x  in  [xl, xu]  and  y  in  [yl, yu] .
+    static constexpr set<bool>
+    less(int xl, int xu, int yl, int yu)
+    {
+        return make_truth(xu >= yl, xl < yu);
+    }
+};
+
+
+    // Sum of two sets: the set of all  x + y  for  x  in  lhs  and  y  in  rhs .
+template <int MinL, int MaxL, int MinR, int MaxR>
+[[nodiscard]] constexpr int_set<MinL + MinR, MaxL + MaxR>
+operator +(int_set<MinL, MaxL> const& lhs, int_set<MinR, MaxR> const& rhs)
+{
+    using Result = int_set<MinL + MinR, MaxL + MaxR>;
+    constexpr auto n = std::size_t(Result::num_values);
+
+    gsl_ExpectsDebug(lhs.assigned() && rhs.assigned());
+
+    auto widen = [](auto const& words)
+    {
+        auto result = detail::set_words<n>{ };
+        for (std::size_t i = 0; i != words.size(); ++i)
+        {
+            result.words[i] = words[i];
+        }
+        return result;
+    };
+
+        // Shift the operand with more elements by every element of the other one.
+    auto xs = widen(lhs.to_words());
+    auto ys = widen(rhs.to_words());
+    if (lhs.count() > rhs.count())
+    {
+        std::swap(xs, ys);
+    }
+    auto result = detail::set_words<n>{ };
+    for (std::size_t w = 0; w != xs.words.size(); ++w)
+    {
+        for (std::uint64_t bits = xs.words[w]; bits != 0; bits &= bits - 1)
+        {
+            result |= detail::int_set_shift<n>(ys, std::ptrdiff_t(64*w) + std::countr_zero(bits));
+        }
+    }
+    return Result::from_words(result.words);
+}
+
+    // Negation: the set of all  -x  for  x  in  x .
+template <int Min, int Max>
+[[nodiscard]] constexpr int_set<-Max, -Min>
+operator -(int_set<Min, Max> const& x)
+{
+    gsl_ExpectsDebug(x.assigned());
+
+    auto result = int_set<-Max, -Min>{ };
+    auto words = x.to_words();
+    for (std::size_t w = 0; w != words.size(); ++w)
+    {
+        for (std::uint64_t bits = words[w]; bits != 0; bits &= bits - 1)
+        {
+            result.assign(-(Min + int(64*w) + std::countr_zero(bits)));
+        }
+    }
+    return result;
+}
+
+
+template <typename ElemT, typename TraitsT, int Min, int Max>
+std::basic_ostream<ElemT, TraitsT>&
+operator <<(std::basic_ostream<ElemT, TraitsT>& stream, int_set<Min, Max> const& x)
+{
+    stream << ElemT('{') << ElemT(' ');
+    bool first = true;
+    auto words = x.to_words();
+    for (std::size_t w = 0; w != words.size(); ++w)
+    {
+        for (std::uint64_t bits = words[w]; bits != 0; bits &= bits - 1)
+        {
+            if (first)
+            {
+                first = false;
+            }
+            else
+            {
+                stream << ElemT(',') << ElemT(' ');
+            }
+            stream << Min + int(64*w) + std::countr_zero(bits);
+        }
+    }
+    stream << ElemT(' ') << ElemT('}');
+    return stream;
+}
+
+
+inline namespace math {
+
+
+template <int Min, int Max>
+[[nodiscard]] constexpr int
+infimum(int_set<Min, Max> const& x)
+{
+    return x.lower();
+}
+template <int Min, int Max>
+[[nodiscard]] constexpr int
+supremum(int_set<Min, Max> const& x)
+{
+    return x.upper();
+}
+
+    // Minimum and maximum: an element  v  of either operand is in the result if the other operand has an element  ≥ v
+    // (for `min()`) or  ≤ v  (for `max()`).
+template <int Min, int Max>
+[[nodiscard]] constexpr int_set<Min, Max>
+min(int_set<Min, Max> const& lhs, gsl::type_identity_t<int_set<Min, Max>> const& rhs)
+{
+    using Words = std::array<std::uint64_t, int_set<Min, Max>::num_words>;
+    constexpr auto n = std::size_t(int_set<Min, Max>::num_values);
+
+    gsl_ExpectsDebug(lhs.assigned() && rhs.assigned());
+
+    auto lhsMask = detail::int_set_range_mask<n>(0, rhs.upper() - Min);
+    auto rhsMask = detail::int_set_range_mask<n>(0, lhs.upper() - Min);
+    Words x = lhs.to_words();
+    Words y = rhs.to_words();
+    auto result = Words{ };
+    for (std::size_t i = 0; i != result.size(); ++i)
+    {
+        result[i] = (x[i] & lhsMask.words[i]) | (y[i] & rhsMask.words[i]);
+    }
+    return int_set<Min, Max>::from_words(result);
+}
+template <int Min, int Max>
+[[nodiscard]] constexpr int_set<Min, Max>
+max(int_set<Min, Max> const& lhs, gsl::type_identity_t<int_set<Min, Max>> const& rhs)
+{
+    using Words = std::array<std::uint64_t, int_set<Min, Max>::num_words>;
+    constexpr auto n = std::size_t(int_set<Min, Max>::num_values);
+
+    gsl_ExpectsDebug(lhs.assigned() && rhs.assigned());
+
+    auto lhsMask = detail::int_set_range_mask<n>(rhs.lower() - Min, std::ptrdiff_t(n) - 1);
+    auto rhsMask = detail::int_set_range_mask<n>(lhs.lower() - Min, std::ptrdiff_t(n) - 1);
+    Words x = lhs.to_words();
+    Words y = rhs.to_words();
+    auto result = Words{ };
+    for (std::size_t i = 0; i != result.size(); ++i)
+    {
+        result[i] = (x[i] & lhsMask.words[i]) | (y[i] & rhsMask.words[i]);
+    }
+    return int_set<Min, Max>::from_words(result);
+}
+
+    // With a scalar operand  c , the elements  ≤ c  (for `min()`) or  ≥ c  (for `max()`) are retained, and  c  is in the
+    // result if the set has an element beyond it. The scalar need not lie in  [Min, Max]  unless it is in the result.
+template <int Min, int Max>
+[[nodiscard]] constexpr int_set<Min, Max>
+min(int_set<Min, Max> const& lhs, int rhs)
+{
+    constexpr auto n = std::size_t(int_set<Min, Max>::num_values);
+
+    gsl_ExpectsDebug(lhs.assigned());
+
+    auto mask = detail::int_set_range_mask<n>(0, std::ptrdiff_t(rhs) - Min);
+    auto x = lhs.to_words();
+    for (std::size_t i = 0; i != x.size(); ++i)
+    {
+        x[i] &= mask.words[i];
+    }
+    auto result = int_set<Min, Max>::from_words(x);
+    if (lhs.upper() >= rhs)
+    {
+        result.assign(rhs);
+    }
+    return result;
+}
+template <int Min, int Max>
+[[nodiscard]] constexpr int_set<Min, Max>
+max(int_set<Min, Max> const& lhs, int rhs)
+{
+    constexpr auto n = std::size_t(int_set<Min, Max>::num_values);
+
+    gsl_ExpectsDebug(lhs.assigned());
+
+    auto mask = detail::int_set_range_mask<n>(std::ptrdiff_t(rhs) - Min, std::ptrdiff_t(n) - 1);
+    auto x = lhs.to_words();
+    for (std::size_t i = 0; i != x.size(); ++i)
+    {
+        x[i] &= mask.words[i];
+    }
+    auto result = int_set<Min, Max>::from_words(x);
+    if (lhs.lower() <= rhs)
+    {
+        result.assign(rhs);
+    }
+    return result;
+}
+template <int Min, int Max>
+[[nodiscard]] constexpr int_set<Min, Max>
+min(int lhs, int_set<Min, Max> const& rhs)
+{
+    return intervals::min(rhs, lhs);
+}
+template <int Min, int Max>
+[[nodiscard]] constexpr int_set<Min, Max>
+max(int lhs, int_set<Min, Max> const& rhs)
+{
+    return intervals::max(rhs, lhs);
+}
+
+
+} // inline namespace math
+
+
+inline namespace logic {
+
+
+template <int Min, int Max>
+[[nodiscard]] constexpr int_set<Min, Max>
+if_else(set<bool> cond, int_set<Min, Max> resultIfTrue, int_set<Min, Max> resultIfFalse)
+{
+    auto result = int_set<Min, Max>{ };
+    if (intervals::possibly(cond))
+    {
+        result.assign(resultIfTrue);
+    }
+    if (intervals::possibly_not(cond))
+    {
+        result.assign(resultIfFalse);
+    }
+    return result;
+}
+template <int Min, int Max>
+[[nodiscard]] constexpr int_set<Min, Max>
+if_else(set<bool> cond, int resultIfTrue, int_set<Min, Max> resultIfFalse)
+{
+    return intervals::if_else(cond, int_set<Min, Max>(resultIfTrue), resultIfFalse);
+}
+template <int Min, int Max>
+[[nodiscard]] constexpr int_set<Min, Max>
+if_else(set<bool> cond, int_set<Min, Max> resultIfTrue, int resultIfFalse)
+{
+    return intervals::if_else(cond, resultIfTrue, int_set<Min, Max>(resultIfFalse));
+}
+
+
+} // inline namespace logic
+
+
+template <int Min, int Max>
+constexpr void
+assign(int_set<Min, Max>& lhs, gsl::type_identity_t<int_set<Min, Max>> const& rhs)
+{
+    lhs.reset(rhs);
+}
+template <int Min, int Max>
+constexpr void
+assign_partial(int_set<Min, Max>& lhs, gsl::type_identity_t<int_set<Min, Max>> const& rhs)
+{
+    lhs.assign(rhs);
+}
+template <int Min, int Max>
+constexpr void
+reset(int_set<Min, Max>& lhs, gsl::type_identity_t<int_set<Min, Max>> const& rhs)
+{
+    lhs.reset(rhs);
+}
+
+
+} // namespace intervals
+
+
+#endif // INCLUDED_INTERVALS_INT_SET_HPP_
@@ -8,7 +8,6 @@
 #include <bitset>
 #include <limits>
 #include <iosfwd>
-#include <numbers>
 #include <utility>      // for pair<>
 #include <concepts>
 #include <iterator>     // for random_access_iterator<>
@@ -21,6 +20,7 @@
 #include <intervals/set.hpp>
 #include <intervals/sign.hpp>
 #include <intervals/math.hpp>         // for floating_point<>, integral<>, and to make assign*() and reset() available
+#include <intervals/rounding.hpp>     // for no_rounding
 #include <intervals/logic.hpp>        // to make possibly() et al. for Boolean arguments available
 #include <intervals/concepts.hpp>
 #include <intervals/type_traits.hpp>
@@ -34,7 +34,7 @@ namespace intervals {
 namespace gsl = gsl_lite;
 
 
-template <typename T>
+template <typename T, typename PolicyT>
 class interval;
 
 
@@ -209,7 +209,7 @@ public:
     {
         gsl_ExpectsDebug(assigned(x) && assigned(y));
 
-        if constexpr (floating_point_operands<X, Y>)
+        if constexpr (special_value_operands<X, Y>)
         {
             if ((is_negative_inf(lower(x)) && is_positive_inf(upper(y)))
                 || (is_negative_inf(lower(y)) && is_positive_inf(upper(x))))
@@ -217,7 +217,9 @@ public:
                 return detail::nan_interval<X, Y>();
             }
         }
-        return common_interval_t<X, Y>{ lower(x) + lower(y), upper(x) + upper(y) };
+        using T = common_interval_value_t<X, Y>;
+        using Policy = common_interval_policy_t<X, Y>;
+        return common_interval_t<X, Y>{ Policy::add_down(T(lower(x)), T(lower(y))), Policy::add_up(T(upper(x)), T(upper(y))) };
     }
     template <typename X, typename Y>
     requires any_interval<X, Y> && arithmetic_operands<X, Y>
@@ -226,7 +228,7 @@ public:
     {
         gsl_ExpectsDebug(assigned(x) && assigned(y));
 
-        if constexpr (floating_point_operands<X, Y>)
+        if constexpr (special_value_operands<X, Y>)
         {
             if ((is_negative_inf(lower(x)) && is_negative_inf(lower(y)))
                 || (is_positive_inf(upper(y)) && is_positive_inf(upper(x))))
@@ -234,7 +236,9 @@ public:
                 return detail::nan_interval<X, Y>();
             }
         }
-        return common_interval_t<X, Y>{ lower(x) - upper(y), upper(x) - lower(y) };
+        using T = common_interval_value_t<X, Y>;
+        using Policy = common_interval_policy_t<X, Y>;
+        return common_interval_t<X, Y>{ Policy::sub_down(T(lower(x)), T(upper(y))), Policy::sub_up(T(upper(x)), T(lower(y))) };
     }
     template <typename X, typename Y>
     requires any_interval<X, Y> && arithmetic_operands<X, Y>
@@ -244,7 +248,8 @@ public:
         gsl_ExpectsDebug(assigned(x) && assigned(y));
 
         using T = common_interval_value_t<X, Y>;
-        if constexpr (floating_point_operands<X, Y>)
+        using Policy = common_interval_policy_t<X, Y>;
+        if constexpr (special_value_operands<X, Y>)
         {
             if (((is_negative_inf(lower(x)) || is_positive_inf(upper(x))) && contains(y, 0))
                 || (contains(x, 0) && (is_negative_inf(lower(y)) || is_positive_inf(upper(y)))))
@@ -254,23 +259,31 @@ public:
         }
         if constexpr (interval_value<X>)
         {
-            T v1 = x*lower(y);
-            T v2 = x*upper(y);
-            return common_interval_t<X, Y>{ intervals::min(v1, v2), intervals::max(v1, v2) };
+            return common_interval_t<X, Y>{
+                intervals::min(Policy::mul_down(T(x), T(lower(y))), Policy::mul_down(T(x), T(upper(y)))),
+                intervals::max(Policy::mul_up(T(x), T(lower(y))), Policy::mul_up(T(x), T(upper(y))))
+            };
         }
         else if constexpr (interval_value<Y>)
         {
-            T v1 = lower(x)*y;
-            T v2 = upper(x)*y;
-            return common_interval_t<X, Y>{ intervals::min(v1, v2), intervals::max(v1, v2) };
+            return common_interval_t<X, Y>{
+                intervals::min(Policy::mul_down(T(lower(x)), T(y)), Policy::mul_down(T(upper(x)), T(y))),
+                intervals::max(Policy::mul_up(T(lower(x)), T(y)), Policy::mul_up(T(upper(x)), T(y)))
+            };
         }
         else
         {
-            T v1 = lower(x)*lower(y);
-            T v2 = lower(x)*upper(y);
-            T v3 = upper(x)*lower(y);
-            T v4 = upper(x)*upper(y);
-            return common_interval_t<X, Y>{ intervals::min(intervals::min(v1, v2), intervals::min(v3, v4)), intervals::max(intervals::max(v1, v2), intervals::max(v3, v4)) };
+                // Unlike for division, we do not dispatch on the sign classes of the operands (cf. `hickey_divide_selectors`) here:
+                // multiplication is cheap, and computing all four products followed by a branch-free reduction was found to
+                // be faster than the class-based dispatch which needs only two products in most cases.
+            T a = lower(x);
+            T b = upper(x);
+            T c = lower(y);
+            T d = upper(y);
+            return common_interval_t<X, Y>{
+                intervals::min(intervals::min(Policy::mul_down(a, c), Policy::mul_down(a, d)), intervals::min(Policy::mul_down(b, c), Policy::mul_down(b, d))),
+                intervals::max(intervals::max(Policy::mul_up(a, c), Policy::mul_up(a, d)), intervals::max(Policy::mul_up(b, c), Policy::mul_up(b, d)))
+            };
         }
     }
 
@@ -320,9 +333,10 @@ public:
         gsl_ExpectsDebug(assigned(x) && assigned(y));
 
         using T = common_interval_value_t<X, Y>;
+        using Policy = common_interval_policy_t<X, Y>;
         if constexpr (interval_value<X>)
         {
-            if constexpr (floating_point_operands<X, Y>)
+            if constexpr (special_value_operands<X, Y>)
             {
                 if ((is_negative_inf(x) || is_positive_inf(x))  // x = -∞ ∨ x = ∞
                     && (is_negative_inf(lower(y)) || is_positive_inf(upper(y))))  // c = -∞ ∨ d = ∞
@@ -330,6 +344,9 @@ public:
                         // ∞/∞ = NaN
                     return detail::nan_interval<X, Y>();
                 }
+            }
+            if constexpr (floating_point_operands<X, Y>)
+            {
                 if (x == 0 && lower(y) <= 0 && 0 <= upper(y))  // x = 0 ∧ c ≤ 0 ≤ d
                 {
                         // 0/0 = NaN
@@ -350,13 +367,14 @@ public:
                     return common_interval_t<X, Y>{ 0/zero, 0 };
                 }
             }
-            T v1 = x/lower(y);
-            T v2 = x/upper(y);
-            return common_interval_t<X, Y>{ intervals::min(v1, v2), intervals::max(v1, v2) };
+            return common_interval_t<X, Y>{
+                intervals::min(Policy::div_down(T(x), T(lower(y))), Policy::div_down(T(x), T(upper(y)))),
+                intervals::max(Policy::div_up(T(x), T(lower(y))), Policy::div_up(T(x), T(upper(y))))
+            };
         }
         else if constexpr (interval_value<Y>)
         {
-            if constexpr (floating_point_operands<X, Y>)
+            if constexpr (special_value_operands<X, Y>)
             {
                 if ((is_negative_inf(lower(x)) || is_positive_inf(upper(x)))  // a = -∞ ∨ b = ∞
                     && (is_negative_inf(y) || is_positive_inf(y)))  // x = -∞ ∨ x = ∞
@@ -364,6 +382,9 @@ public:
                         // ∞/∞ = NaN
                     return detail::nan_interval<X, Y>();
                 }
+            }
+            if constexpr (floating_point_operands<X, Y>)
+            {
                 if (lower(x) <= 0 && 0 <= upper(x) && y == 0)  // a ≤ 0 ≤ b ∧ y = 0
                 {
                         // 0/0 = NaN
@@ -371,13 +392,14 @@ public:
                 }
             }
 
-            T v1 = lower(x)/y;
-            T v2 = upper(x)/y;
-            return common_interval_t<X, Y>{ intervals::min(v1, v2), intervals::max(v1, v2) };
+            return common_interval_t<X, Y>{
+                intervals::min(Policy::div_down(T(lower(x)), T(y)), Policy::div_down(T(upper(x)), T(y))),
+                intervals::max(Policy::div_up(T(lower(x)), T(y)), Policy::div_up(T(upper(x)), T(y)))
+            };
         }
         else
         {
-            if constexpr (floating_point_operands<X, Y>)
+            if constexpr (special_value_operands<X, Y>)
             {
                 if ((is_negative_inf(lower(x)) || is_positive_inf(upper(x)))  // a = -∞ ∨ b = ∞
                     && (is_negative_inf(lower(y)) || is_positive_inf(upper(y))))  // c = -∞ ∨ d = ∞
@@ -385,6 +407,19 @@ public:
                         // ∞/∞ = NaN
                     return detail::nan_interval<X, Y>();
                 }
+            }
+                // The checks for division by 0 below do not apply if  0 ∉ [c,d] .
+            if (lower(y) > 0 || upper(y) < 0)  // 0 ∉ [c,d]
+            {
+                    // Select the quotients attaining the bounds by the sign classes of the operands, which requires only two
+                    // divisions. The classes are determined without branching because the signs of the dividend are often
+                    // unpredictable.
+                bool xP = 0 <= lower(x);
+                bool xN = !xP & (upper(x) <= 0);
+                return divide_classified<common_interval_t<X, Y>, Policy>(T(lower(x)), T(upper(x)), T(lower(y)), T(upper(y)), xP, xN);
+            }
+            if constexpr (floating_point_operands<X, Y>)
+            {
                 if (lower(x) <= 0 && 0 <= upper(x) && lower(y) <= 0 && 0 <= upper(y))  // a ≤ 0 ≤ b ∧ c ≤ 0 ≤ d
                 {
                         // 0/0 = NaN
@@ -405,11 +440,14 @@ public:
                     return common_interval_t<X, Y>{ 0/zero, 0 };
                 }
             }
-            T v1 = lower(x)/lower(y);
-            T v2 = lower(x)/upper(y);
-            T v3 = upper(x)/lower(y);
-            T v4 = upper(x)/upper(y);
-            return common_interval_t<X, Y>{ intervals::min(intervals::min(v1, v2), intervals::min(v3, v4)), intervals::max(intervals::max(v1, v2), intervals::max(v3, v4)) };
+            T a = lower(x);
+            T b = upper(x);
+            T c = lower(y);
+            T d = upper(y);
+            return common_interval_t<X, Y>{
+                intervals::min(intervals::min(Policy::div_down(a, c), Policy::div_down(a, d)), intervals::min(Policy::div_down(b, c), Policy::div_down(b, d))),
+                intervals::max(intervals::max(Policy::div_up(a, c), Policy::div_up(a, d)), intervals::max(Policy::div_up(b, c), Policy::div_up(b, d)))
+            };
         }
     }
 
@@ -451,36 +489,6 @@ public:
         using Result = interval<std::iter_difference_t<interval_arg_value_t<L>>>;
         return Result{ lower(lhs) - upper(rhs), upper(lhs) - lower(rhs) };
     }
-
-    //    // Given an interval  [a,b] , determines the interval classification as per Hickey et al. (2001).
-    //enum class hickey_classification : unsigned
-    //{
-    //    Z  = 0,  // a = 0 ∧ b = 0
-    //    M  = 1,  // a < 0 ∧ b > 0
-    //    P0 = 2,  // a = 0 ∧ b > 0
-    //    P1 = 3,  // a > 0 ∧ b > 0
-    //    N0 = 4,  // a < 0 ∧ b = 0
-    //    N1 = 5   // a < 0 ∧ b < 0
-    //};
-    //
-    //hickey_classification
-    //_classify() const
-    //{
-    //    gsl_Assert(lower_ <= upper_);  // this traps NaNs and uninitialized states
-    //
-    //    if (lower_ < T{ })
-    //    {
-    //        if (upper_ > T{ }) return hickey_classification::M;
-    //        else if (upper_ == T{ }) return hickey_classification::N0;
-    //        else return hickey_classification::N1;
-    //    }
-    //    else if (lower_ == T{ })
-    //    {
-    //        if (upper_ == T{ }) return hickey_classification::Z;
-    //        else return hickey_classification::P0;
-    //    }
-    //    else return hickey_classification::P1;
-    //}
 };
 
     // Compute  x⋅y  but impose that  0⋅∞ = 0 .
@@ -704,38 +712,59 @@ public:
 } // namespace detail
 
 
+    //
     // Algebraic type representing a bounded scalar.
-template <typename T>
+    //
+    // For floating-point intervals, the rounding policy  PolicyT  determines how the bounds of the results of arithmetic
+    // operations are rounded (cf. "rounding.hpp").
+    //
+template <typename T, typename PolicyT>
 class interval;
-template <interval_value T>
-interval(interval<T>) -> interval<T>;
+template <interval_value T, typename PolicyT>
+interval(interval<T, PolicyT>) -> interval<T, PolicyT>;
 template <interval_value T>
 interval(T) -> interval<T>;
 template <interval_value T1, interval_value T2>
 interval(T1, T2) -> interval<std::common_type_t<T1, T2>>;
-template <std::floating_point T>
-class interval<T> : public detail::arithmetic_interval_base<T>
+template <std::floating_point T, typename PolicyT>
+class interval<T, PolicyT> : public detail::arithmetic_interval_base<T>
 {
     using basebase = detail::interval_base<T>;
 
     static constexpr T inf_ = std::numeric_limits<T>::infinity();
 
+        // If the policy declares that all bounds are finite (cf. `finite_only_policy<>`), this is checked for every interval
+        // constructed or assigned in debug mode. The checks also detect overflow in arithmetic operations.
+    static constexpr bool finite_only_ = detail::assumes_finite<PolicyT>;
+
+    static constexpr void
+    _check_finite([[maybe_unused]] T _lower, [[maybe_unused]] T _upper)
+    {
+        if constexpr (finite_only_)
+        {
+            gsl_ExpectsDebug(-inf_ < _lower && _upper < inf_);
+        }
+    }
+
 public:
     using base = detail::arithmetic_interval_base<T>;
     using interval_type = interval;
+    using policy_type = PolicyT;
 
     constexpr interval() noexcept
         : base(inf_, -inf_)
     {
     }
-    constexpr interval(T value) noexcept
+    constexpr interval(T value) noexcept(!finite_only_)
         : base(value, value)
     {
+        _check_finite(value, value);
     }
     explicit constexpr interval(T _lower, T _upper)
         : base(_lower, _upper)
     {
         gsl_Expects(!(_lower > _upper));  // does not trigger for NaNs
+        _check_finite(_lower, _upper);
     }
     template <std::convertible_to<T> U>
     constexpr interval(detail::interval_base<U> const& rhs)
@@ -743,6 +772,7 @@ public:
     {
         if (rhs.assigned())
         {
+            _check_finite(rhs.lower_unchecked(), rhs.upper_unchecked());
             this->_reset(rhs.lower_unchecked(), rhs.upper_unchecked());
         }
     }
@@ -754,20 +784,26 @@ public:
         return *this;
     }
     constexpr interval&
-    reset(T rhs) noexcept
+    reset(T rhs) noexcept(!finite_only_)
     {
+        _check_finite(rhs, rhs);
         this->_reset(rhs, rhs);
         return *this;
     }
     constexpr interval&
-    reset(basebase const& rhs) noexcept
+    reset(basebase const& rhs) noexcept(!finite_only_)
     {
+        if (rhs.assigned())
+        {
+            _check_finite(rhs.lower_unchecked(), rhs.upper_unchecked());
+        }
         this->_reset(rhs.lower_unchecked(), rhs.upper_unchecked());
         return *this;
     }
     constexpr interval&
-    assign(T rhs) noexcept
+    assign(T rhs) noexcept(!finite_only_)
     {
+        _check_finite(rhs, rhs);
         this->_assign(rhs, rhs);
         return *this;
     }
@@ -775,6 +811,7 @@ public:
     assign(basebase const& rhs)
     {
         gsl_Expects(rhs.assigned());
+        _check_finite(rhs.lower_unchecked(), rhs.upper_unchecked());
 
         this->_assign(rhs.lower_unchecked(), rhs.upper_unchecked());
         return *this;
@@ -793,6 +830,7 @@ class interval<T> : public detail::arithmetic_interval_base<T>
 public:
     using base = detail::arithmetic_interval_base<T>;
     using interval_type = interval;
+    using policy_type = no_rounding;
 
     constexpr interval() noexcept
         : base(max_, min_)
@@ -858,6 +896,7 @@ class interval<T> : public detail::iterator_interval_base<T>
 public:
     using base = detail::iterator_interval_base<T>;
     using interval_type = interval;
+    using policy_type = no_rounding;
 
     /*constexpr interval() noexcept
         : base(max_, min_)
@@ -936,21 +975,75 @@ supremum(X&& x)
 
 template <typename L, typename R>
 requires any_interval<L, R> && detail::same_values<L, R> && detail::relational_values<L, R>
-[[nodiscard]] constexpr interval_of_t<L>
+[[nodiscard]] constexpr common_interval_t<L, R>
 min(L&& lhs, R&& rhs)
 {
     gsl_ExpectsDebug(detail::assigned(lhs) && detail::assigned(rhs));
 
-    return interval_of_t<L>{ intervals::min(detail::lower(lhs), detail::lower(rhs)), intervals::min(detail::upper(lhs), detail::upper(rhs)) };
+    return common_interval_t<L, R>{ intervals::min(detail::lower(lhs), detail::lower(rhs)), intervals::min(detail::upper(lhs), detail::upper(rhs)) };
 }
 template <typename L, typename R>
 requires any_interval<L, R> && detail::same_values<L, R> && detail::relational_values<L, R>
-[[nodiscard]] constexpr interval_of_t<L>
+[[nodiscard]] constexpr common_interval_t<L, R>
 max(L&& lhs, R&& rhs)
 {
     gsl_ExpectsDebug(detail::assigned(lhs) && detail::assigned(rhs));
 
-    return interval_of_t<L>{ intervals::max(detail::lower(lhs), detail::lower(rhs)), intervals::max(detail::upper(lhs), detail::upper(rhs)) };
+    return common_interval_t<L, R>{ intervals::max(detail::lower(lhs), detail::lower(rhs)), intervals::max(detail::upper(lhs), detail::upper(rhs)) };
+}
+
+    // Compute  x⋅y + z  where the candidate products are accumulated with a fused multiply–add operation. The result is
+    // never wider than that of  x*y + z , and it is obtained without the intermediate interval.
+template <typename X, typename Y, typename Z>
+requires any_interval<X, Y, Z> && detail::floating_point_operands<X, Y, Z>
+[[nodiscard]] constexpr common_interval_t<X, Y, Z>
+fma(X&& x, Y&& y, Z&& z)
+{
+    gsl_ExpectsDebug(detail::assigned(x) && detail::assigned(y) && detail::assigned(z));
+
+    using T = common_interval_value_t<X, Y, Z>;
+    using Policy = common_interval_policy_t<X, Y, Z>;
+    if constexpr (detail::special_value_operands<X, Y, Z>)
+    {
+            // Infinite and NaN bounds are rare; let the operators handle them.
+        if (!(std::isfinite(detail::lower(x)) && std::isfinite(detail::upper(x))
+            && std::isfinite(detail::lower(y)) && std::isfinite(detail::upper(y))
+            && std::isfinite(detail::lower(z)) && std::isfinite(detail::upper(z))))
+        {
+            return common_interval_t<X, Y, Z>(x*y + z);
+        }
+    }
+    T e = detail::lower(z);
+    T f = detail::upper(z);
+    if constexpr (interval_value<X> && interval_value<Y>)
+    {
+        return common_interval_t<X, Y, Z>{ Policy::fma_down(T(x), T(y), e), Policy::fma_up(T(x), T(y), f) };
+    }
+    else if constexpr (interval_value<X>)
+    {
+        return common_interval_t<X, Y, Z>{
+            intervals::min(Policy::fma_down(T(x), T(detail::lower(y)), e), Policy::fma_down(T(x), T(detail::upper(y)), e)),
+            intervals::max(Policy::fma_up(T(x), T(detail::lower(y)), f), Policy::fma_up(T(x), T(detail::upper(y)), f))
+        };
+    }
+    else if constexpr (interval_value<Y>)
+    {
+        return common_interval_t<X, Y, Z>{
+            intervals::min(Policy::fma_down(T(detail::lower(x)), T(y), e), Policy::fma_down(T(detail::upper(x)), T(y), e)),
+            intervals::max(Policy::fma_up(T(detail::lower(x)), T(y), f), Policy::fma_up(T(detail::upper(x)), T(y), f))
+        };
+    }
+    else
+    {
+        T a = detail::lower(x);
+        T b = detail::upper(x);
+        T c = detail::lower(y);
+        T d = detail::upper(y);
+        return common_interval_t<X, Y, Z>{
+            intervals::min(intervals::min(Policy::fma_down(a, c, e), Policy::fma_down(a, d, e)), intervals::min(Policy::fma_down(b, c, e), Policy::fma_down(b, d, e))),
+            intervals::max(intervals::max(Policy::fma_up(a, c, f), Policy::fma_up(a, d, f)), intervals::max(Policy::fma_up(b, c, f), Policy::fma_up(b, d, f)))
+        };
+    }
 }
 
 template <arithmetic_interval X>
@@ -959,13 +1052,14 @@ square(X&& x)
 {
     gsl_ExpectsDebug(x.assigned());
 
+    using Policy = interval_policy_t<X>;
     auto lo = detail::lower(x);
     auto hi = detail::upper(x);
     return interval_t<X>{
         lo <= 0 && hi >= 0  // 0 ∈ [a, b]
             ? 0
-            : intervals::min(lo*lo, hi*hi),
-        intervals::max(lo*lo, hi*hi)
+            : intervals::min(Policy::mul_down(lo, lo), Policy::mul_down(hi, hi)),
+        intervals::max(Policy::mul_up(lo, lo), Policy::mul_up(hi, hi))
     };
 }
 template <arithmetic_interval X>
@@ -1024,9 +1118,11 @@ sqrt(X&& x)
 {
     gsl_ExpectsDebug(x.assigned());
 
+    using Policy = interval_policy_t<X>;
+
         // Allow for slight numerical non-monotonicity of the `sqrt()` implementation, as might occur with an iterative implementation.
     //return interval_t<X>{ intervals::sqrt(detail::lower(x)), intervals::sqrt(detail::upper(x)) };
-    return interval_t<X>::from_unordered_bounds(intervals::sqrt(detail::lower(x)), intervals::sqrt(detail::upper(x)));
+    return interval_t<X>::from_unordered_bounds(Policy::sqrt_down(detail::lower(x)), Policy::sqrt_up(detail::upper(x)));
 }
 template <floating_point_interval X>
 [[nodiscard]] constexpr interval_t<X>
@@ -1036,7 +1132,10 @@ cbrt(X&& x)
 
         // Allow for slight numerical non-monotonicity of the `cbrt()` implementation, as might occur with an iterative implementation.
     //return interval_t<X>{ intervals::cbrt(detail::lower(x)), intervals::cbrt(detail::upper(x)) };
-    return interval_t<X>::from_unordered_bounds(intervals::cbrt(detail::lower(x)), intervals::cbrt(detail::upper(x)));
+    using Pad = detail::libm_padding<interval_policy_t<X>>;
+    return interval_t<X>::from_unordered_bounds(
+        detail::pad_down(intervals::cbrt(detail::lower(x)), Pad::cbrt),
+        detail::pad_up(intervals::cbrt(detail::upper(x)), Pad::cbrt));
 }
 template <floating_point_interval X>
 [[nodiscard]] constexpr interval_t<X>
@@ -1044,7 +1143,10 @@ log(X&& x)
 {
     gsl_ExpectsDebug(x.assigned());
 
-    return interval_t<X>{ intervals::log(detail::lower(x)), intervals::log(detail::upper(x)) };
+    using Pad = detail::libm_padding<interval_policy_t<X>>;
+    return interval_t<X>{
+        detail::pad_down(intervals::log(detail::lower(x)), Pad::log),
+        detail::pad_up(intervals::log(detail::upper(x)), Pad::log) };
 }
 template <floating_point_interval X>
 [[nodiscard]] constexpr interval_t<X>
@@ -1052,7 +1154,11 @@ exp(X&& x)
 {
     gsl_ExpectsDebug(x.assigned());
 
-    return interval_t<X>{ intervals::exp(detail::lower(x)), intervals::exp(detail::upper(x)) };
+    using T = interval_value_t<X>;
+    using Pad = detail::libm_padding<interval_policy_t<X>>;
+    return interval_t<X>{
+        detail::pad_down(intervals::exp(detail::lower(x)), Pad::exp, T(0)),
+        detail::pad_up(intervals::exp(detail::upper(x)), Pad::exp) };
 }
 template <interval_arg X, interval_arg Y>
 requires any_interval<X, Y> && detail::floating_point_operands<X, Y>
@@ -1066,6 +1172,20 @@ pow(X&& x, Y&& y)
 
     using XV = interval_arg_value_t<X>;
     using YV = interval_arg_value_t<Y>;
+    if (!std::is_constant_evaluated() && detail::degenerate(x) && detail::degenerate(y) && detail::lower(x) > 0)
+    {
+            // Degenerate arguments need a single call to `pow()`. The error bound of the `constexpr` implementation depends
+            // on the arguments, so constant evaluation takes the general path.
+        using T = common_interval_value_t<X, Y>;
+        using Pad = detail::libm_padding<common_interval_policy_t<X, Y>>;
+        T v = intervals::pow(T(detail::lower(x)), T(detail::lower(y)));
+        return common_interval_t<X, Y>{ detail::pad_down(v, Pad::pow, T(0)), detail::pad_up(v, Pad::pow) };
+    }
+    if (detail::lower(x) > 0)
+    {
+            // Fast path for strictly positive bases, which are the common case.
+        return common_interval_t<X, Y>(intervals::exp(detail::_multiply_0(y, intervals::log(x))));
+    }
     auto result = common_interval_t<X, Y>{ };
     if (intervals::possibly(x >= 0))
     {
@@ -1089,50 +1209,107 @@ pow(X&& x, Y&& y)
     return result;
 }
 
-template <floating_point_interval X>
+    // Compute  xⁿ  for an integer exponent  n . Unlike `pow()`, `pown()` is defined for negative bases and uses binary
+    // exponentiation rather than logarithms. For integral intervals,  n  must be non-negative.
+template <arithmetic_interval X>
 [[nodiscard]] constexpr interval_t<X>
-cos(X&& x)
+pown(X&& x, int n)
 {
     gsl_ExpectsDebug(x.assigned());
 
     using T = interval_value_t<X>;
-    auto lo = intervals::wraparound(detail::lower(x), -std::numbers::pi_v<T>, std::numbers::pi_v<T>);
-    auto delta = lo - detail::lower(x);
-    auto hi = detail::upper(x) + delta;
-    if (lo <= T(0))
+    using Policy = interval_policy_t<X>;
+    if constexpr (std::integral<T>)
+    {
+        gsl_Expects(n >= 0);
+    }
+
+    if (n == 0)
+    {
+        return interval_t<X>{ T(1) };  // includes  0⁰ = 1
+    }
+    unsigned k = n < 0 ? 0u - unsigned(n) : unsigned(n);
+    auto pown_down = [k](T v) { return detail::pown_nonnegative<false, Policy>(v, k); };
+    auto pown_up = [k](T v) { return detail::pown_nonnegative<true, Policy>(v, k); };
+    T a = detail::lower(x);
+    T b = detail::upper(x);
+    if (n > 0)
     {
-        if (hi <= T(0))
+        if (k % 2 != 0)  // xⁿ is monotonically increasing for odd  n
         {
-                // Allow for slight numerical non-monotonicity of the `cos()` implementation, as might occur with an iterative implementation.
-            //return interval_t<X>{ intervals::cos(lo), intervals::cos(hi) };
-            return interval_t<X>::from_unordered_bounds(intervals::cos(lo), intervals::cos(hi));
+            return interval_t<X>{
+                a >= 0 ? pown_down(a) : -pown_up(-a),
+                b >= 0 ? pown_up(b) : -pown_down(-b)
+            };
         }
-        else if (hi <= std::numbers::pi_v<T>)
+        if (a >= 0)  // 0 ≤ a ≤ b
         {
-            return interval_t<X>{ intervals::min(intervals::cos(lo), intervals::cos(hi)), 1 };
+            return interval_t<X>{ pown_down(a), pown_up(b) };
         }
+        if (b <= 0)  // a ≤ b ≤ 0
+        {
+            return interval_t<X>{ pown_down(-b), pown_up(-a) };
+        }
+        return interval_t<X>{ T(0), pown_up(intervals::max(-a, b)) };  // a < 0 < b
     }
-    else  // 0 < lo < π
+    else if constexpr (std::floating_point<T>)
     {
-        if (hi <= std::numbers::pi_v<T>)
+            // xⁿ = 1/xᵏ  with  k = -n ; the reciprocal of  0  is taken to be  ∞  if it is approached from above.
+        constexpr T inf = std::numeric_limits<T>::infinity();
+        auto inv_down = [](T p) { return p == 0 ? inf : Policy::div_down(T(1), p); };
+        auto inv_up = [](T p) { return p == 0 ? inf : Policy::div_up(T(1), p); };
+        if (a >= 0)  // 0 ≤ a ≤ b
         {
-                // Allow for slight numerical non-monotonicity of the `cos()` implementation, as might occur with an iterative implementation.
-            //return interval_t<X>{ intervals::cos(hi), intervals::cos(lo) };
-            return interval_t<X>::from_unordered_bounds(intervals::cos(hi), intervals::cos(lo));
+            return interval_t<X>{ inv_down(pown_up(b)), inv_up(pown_down(a)) };
         }
-        else if (hi <= 2*std::numbers::pi_v<T>)
+        if (b <= 0)  // a ≤ b ≤ 0
         {
-            return interval_t<X>{ -1, intervals::max(intervals::cos(lo), intervals::cos(hi)) };
+            return k % 2 != 0
+                ? interval_t<X>{ -inv_up(pown_down(-b)), -inv_down(pown_up(-a)) }
+                : interval_t<X>{ inv_down(pown_up(-a)), inv_up(pown_down(-b)) };
         }
+        return k % 2 != 0  // a < 0 < b
+            ? interval_t<X>{ -inf, inf }
+            : interval_t<X>{ inv_down(pown_up(intervals::max(-a, b))), inf };
+    }
+    else
+    {
+        gsl_FailFast();  // unreachable
     }
-    return interval_t<X>{ T(-1), T(1) };
+}
+
+    // Compute  xᴺ  for a compile-time exponent  N  (cf. `pown()`).
+template <int N, arithmetic_interval X>
+[[nodiscard]] constexpr interval_t<X>
+pow(X&& x)
+{
+    return intervals::pown(std::forward<X>(x), N);
+}
+
+template <floating_point_interval X>
+[[nodiscard]] constexpr interval_t<X>
+cos(X&& x)
+{
+    gsl_ExpectsDebug(x.assigned());
+
+    return detail::sin_shifted<interval_t<X>, 1>(detail::lower(x), detail::upper(x));
 }
 template <floating_point_interval X>
 [[nodiscard]] constexpr interval_t<X>
 sin(X&& x)
 {
-    using T = interval_value_t<X>;
-    return intervals::cos(x - std::numbers::pi_v<T>/2);
+    gsl_ExpectsDebug(x.assigned());
+
+    return detail::sin_shifted<interval_t<X>, 0>(detail::lower(x), detail::upper(x));
+}
+    // Compute  sin x  and  cos x  with a single argument reduction.
+template <floating_point_interval X>
+[[nodiscard]] constexpr std::pair<interval_t<X>, interval_t<X>>
+sincos(X&& x)
+{
+    gsl_ExpectsDebug(x.assigned());
+
+    return detail::sincos_interval<interval_t<X>>(detail::lower(x), detail::upper(x));
 }
 template <floating_point_interval X>
 [[nodiscard]] constexpr interval_t<X>
@@ -1140,17 +1317,7 @@ tan(X&& x)
 {
     gsl_ExpectsDebug(x.assigned());
 
-    using T = interval_value_t<X>;
-    auto lo = intervals::wraparound(detail::lower(x), -std::numbers::pi_v<T>/2, std::numbers::pi_v<T>/2);
-    auto delta = lo - detail::lower(x);
-    auto hi = detail::upper(x) + delta;
-    if (hi - lo >= std::numbers::pi_v<T>)
-    {
-        return detail::inf_interval<T>();
-    }
-        // Allow for slight numerical non-monotonicity of the `tan()` implementation, as might occur with an iterative implementation.
-    //return interval_t<X>{ intervals::tan(lo), intervals::tan(hi) };
-    return interval_t<X>::from_unordered_bounds(intervals::tan(lo), intervals::tan(hi));
+    return detail::tan_interval<interval_t<X>>(detail::lower(x), detail::upper(x));
 }
 template <floating_point_interval X>
 [[nodiscard]] constexpr interval_t<X>
@@ -1160,7 +1327,11 @@ acos(X&& x)
 
         // Allow for slight numerical non-monotonicity of the `acos()` implementation, as might occur with an iterative implementation.
     //return interval_t<X>{ intervals::acos(detail::upper(x)), intervals::acos(detail::lower(x)) };
-    return interval_t<X>::from_unordered_bounds(intervals::acos(detail::upper(x)), intervals::acos(detail::lower(x)));
+    using T = interval_value_t<X>;
+    using Pad = detail::libm_padding<interval_policy_t<X>>;
+    return interval_t<X>::from_unordered_bounds(
+        detail::pad_down(intervals::acos(detail::upper(x)), Pad::acos, T(0)),
+        detail::pad_up(intervals::acos(detail::lower(x)), Pad::acos, detail::pi_up<T>));
 }
 template <floating_point_interval X>
 [[nodiscard]] constexpr interval_t<X>
@@ -1170,7 +1341,11 @@ asin(X&& x)
 
         // Allow for slight numerical non-monotonicity of the `asin()` implementation, as might occur with an iterative implementation.
     //return interval_t<X>{ intervals::asin(detail::lower(x)), intervals::asin(detail::upper(x)) };
-    return interval_t<X>::from_unordered_bounds(intervals::asin(detail::lower(x)), intervals::asin(detail::upper(x)));
+    using T = interval_value_t<X>;
+    using Pad = detail::libm_padding<interval_policy_t<X>>;
+    return interval_t<X>::from_unordered_bounds(
+        detail::pad_down(intervals::asin(detail::lower(x)), Pad::asin, -detail::pi_up<T>/2),
+        detail::pad_up(intervals::asin(detail::upper(x)), Pad::asin, detail::pi_up<T>/2));
 }
 template <floating_point_interval X>
 [[nodiscard]] constexpr interval_t<X>
@@ -1180,7 +1355,11 @@ atan(X&& x)
 
         // Allow for slight numerical non-monotonicity of the `atan()` implementation, as might occur with an iterative implementation.
     //return interval_t<X>{ intervals::atan(detail::lower(x)), intervals::atan(detail::upper(x)) };
-    return interval_t<X>::from_unordered_bounds(intervals::atan(detail::lower(x)), intervals::atan(detail::upper(x)));
+    using T = interval_value_t<X>;
+    using Pad = detail::libm_padding<interval_policy_t<X>>;
+    return interval_t<X>::from_unordered_bounds(
+        detail::pad_down(intervals::atan(detail::lower(x)), Pad::atan, -detail::pi_up<T>/2),
+        detail::pad_up(intervals::atan(detail::upper(x)), Pad::atan, detail::pi_up<T>/2));
 }
 template <typename Y, typename X>
 requires any_interval<X, Y> && detail::floating_point_operands<Y, X>
@@ -1189,21 +1368,29 @@ atan2(Y&& y, X&& x)
 {
     gsl_ExpectsDebug(detail::assigned(y) && detail::assigned(x));
 
+    using T = common_interval_value_t<Y, X>;
+    using Pad = detail::libm_padding<common_interval_policy_t<Y, X>>;
+    constexpr T pi = detail::pi_up<T>;
     if (detail::lower(x) <= 0 && detail::contains(y, 0))
     {
         return detail::nan_interval<Y, X>();
     }
+    if (detail::degenerate(y) && detail::degenerate(x))
+    {
+        auto v = intervals::atan2(detail::lower(y), detail::lower(x));
+        return common_interval_t<Y, X>{ detail::pad_down(v, Pad::atan2, -pi), detail::pad_up(v, Pad::atan2, pi) };
+    }
     if constexpr (interval_value<Y>)
     {
         auto v1 = intervals::atan2(y, detail::lower(x));
         auto v2 = intervals::atan2(y, detail::upper(x));
-        return common_interval_t<Y, X>{ intervals::min(v1, v2), intervals::max(v1, v2) };
+        return common_interval_t<Y, X>{ detail::pad_down(intervals::min(v1, v2), Pad::atan2, -pi), detail::pad_up(intervals::max(v1, v2), Pad::atan2, pi) };
     }
     else if constexpr (interval_value<X>)
     {
         auto v1 = intervals::atan2(detail::lower(y), x);
         auto v2 = intervals::atan2(detail::upper(y), x);
-        return common_interval_t<Y, X>{ intervals::min(v1, v2), intervals::max(v1, v2) };
+        return common_interval_t<Y, X>{ detail::pad_down(intervals::min(v1, v2), Pad::atan2, -pi), detail::pad_up(intervals::max(v1, v2), Pad::atan2, pi) };
     }
     else
     {
@@ -1211,7 +1398,9 @@ atan2(Y&& y, X&& x)
         auto v2 = intervals::atan2(detail::lower(y), detail::upper(x));
         auto v3 = intervals::atan2(detail::upper(y), detail::lower(x));
         auto v4 = intervals::atan2(detail::upper(y), detail::upper(x));
-        return common_interval_t<Y, X>{ intervals::min(intervals::min(v1, v2), intervals::min(v3, v4)), intervals::max(intervals::max(v1, v2), intervals::max(v3, v4)) };
+        return common_interval_t<Y, X>{
+            detail::pad_down(intervals::min(intervals::min(v1, v2), intervals::min(v3, v4)), Pad::atan2, -pi),
+            detail::pad_up(intervals::max(intervals::max(v1, v2), intervals::max(v3, v4)), Pad::atan2, pi) };
     }
 }
 
@@ -1460,16 +1649,16 @@ operator *(set<sign> lhs, T rhs)
 }
 
 
-template <typename T>
+template <typename T, typename PolicyT>
 constexpr void
-assign(interval<T>& lhs, gsl::type_identity_t<interval<T>> const& rhs)
+assign(interval<T, PolicyT>& lhs, gsl::type_identity_t<interval<T, PolicyT>> const& rhs)
 {
     gsl_Expects(!lhs.assigned());
     lhs.reset(rhs);
 }
-template <typename T>
+template <typename T, typename PolicyT>
 constexpr void
-assign_partial(interval<T>& lhs, gsl::type_identity_t<interval<T>> const& rhs)
+assign_partial(interval<T, PolicyT>& lhs, gsl::type_identity_t<interval<T, PolicyT>> const& rhs)
 {
     lhs.assign(rhs);
 }
@@ -1578,20 +1767,20 @@ template <intervals::any_interval IntervalT> class std::tuple_size<IntervalT> :
 template <std::size_t I, intervals::any_interval IntervalT> class std::tuple_element<I, IntervalT> { public: using type = typename IntervalT::value_type; };
 
     // Specialize `std::common_type<>` for intervals.
-template <typename L, intervals::interval_value R>
-struct std::common_type<intervals::interval<L>, R>
+template <typename L, typename PL, intervals::interval_value R>
+struct std::common_type<intervals::interval<L, PL>, R>
 {
-    using type = intervals::common_interval_t<L, R>;
+    using type = intervals::common_interval_t<intervals::interval<L, PL>, R>;
 };
-template <intervals::interval_value L, typename R>
-struct std::common_type<L, intervals::interval<R>>
+template <intervals::interval_value L, typename R, typename PR>
+struct std::common_type<L, intervals::interval<R, PR>>
 {
-    using type = intervals::common_interval_t<L, R>;
+    using type = intervals::common_interval_t<L, intervals::interval<R, PR>>;
 };
-template <typename L, typename R>
-struct std::common_type<intervals::interval<L>, intervals::interval<R>>
+template <typename L, typename PL, typename R, typename PR>
+struct std::common_type<intervals::interval<L, PL>, intervals::interval<R, PR>>
 {
-    using type = intervals::common_interval_t<L, R>;
+    using type = intervals::common_interval_t<intervals::interval<L, PL>, intervals::interval<R, PR>>;
 };
 template <typename L, intervals::interval_value R>
 struct std::common_type<intervals::detail::constrained_interval<L>, R>
@@ -1603,15 +1792,15 @@ struct std::common_type<L, intervals::detail::constrained_interval<R>>
 {
     using type = intervals::common_interval_t<L, R>;
 };
-template <typename L, typename R>
-struct std::common_type<intervals::detail::constrained_interval<L>, intervals::interval<R>>
+template <typename L, typename R, typename PR>
+struct std::common_type<intervals::detail::constrained_interval<L>, intervals::interval<R, PR>>
 {
-    using type = intervals::common_interval_t<L, R>;
+    using type = intervals::common_interval_t<L, intervals::interval<R, PR>>;
 };
-template <typename L, typename R>
-struct std::common_type<intervals::interval<L>, intervals::detail::constrained_interval<R>>
+template <typename L, typename PL, typename R>
+struct std::common_type<intervals::interval<L, PL>, intervals::detail::constrained_interval<R>>
 {
-    using type = intervals::common_interval_t<L, R>;
+    using type = intervals::common_interval_t<intervals::interval<L, PL>, R>;
 };
 template <typename L, typename R>
 struct std::common_type<intervals::detail::constrained_interval<L>, intervals::detail::constrained_interval<R>>
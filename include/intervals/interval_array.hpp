@@ -0,0 +1,436 @@
+
+#ifndef INCLUDED_INTERVALS_INTERVAL_ARRAY_HPP_
+#define INCLUDED_INTERVALS_INTERVAL_ARRAY_HPP_
+
+
+#include <span>
+#include <vector>
+#include <cstddef>           // for size_t
+#include <cstdint>           // for uint64_t
+#include <concepts>          // for floating_point<>
+#include <algorithm>         // for all_of(), fill()
+#include <initializer_list>
+
+#include <gsl-lite/gsl-lite.hpp>  // for dim, index, gsl_Expects(), gsl_ExpectsDebug(), gsl_ExpectsAudit()
+
+#include <intervals/interval.hpp>
+#include <intervals/bool_set_array.hpp>
+
+#include <intervals/detail/interval_array.hpp>
+
+
+namespace intervals {
+
+namespace gsl = gsl_lite;
+
+
+    //
+    // Array of floating-point intervals with structure-of-arrays layout.
+    //
+    // Lower and upper bounds are stored in two separate arrays aligned to cache-line boundaries. Arithmetic operations on
+    // `interval_array<>` are applied element-wise and are implemented as branch-free loops over the bound arrays which can be
+    // vectorized by the compiler. The results are identical to those obtained by applying the corresponding operation to
+    // each element as an `interval<>`.
+    //
+    // The elementary functions `exp()`, `log()`, `sin()`, `cos()`, and `atan()` are evaluated with branch-free polynomial
+    // kernels (cf. detail/vector_math.hpp) whose error bounds are accounted for by widening the result outward. Their results
+    // thus enclose the exact range of the function, and they may differ from the results of the corresponding functions of
+    // `interval<>` by a few ulp.
+    //
+    // Binary operations accept another `interval_array<>` of equal size, an `interval<>`, or a scalar as second operand; the
+    // latter two are broadcast to all elements.
+    //
+    // The relational operators compare the elements and return the possible truth values as a `bool_set_array`, and
+    // `if_else()` selects elements according to a `bool_set_array`. Both are branch-free and yield the same results as the
+    // corresponding operations on `interval<>`.
+    //
+template <std::floating_point T>
+class interval_array
+{
+    friend detail::interval_array_access;
+
+    using storage = std::vector<T, detail::aligned_allocator<T, detail::interval_array_alignment>>;
+
+    static constexpr T inf_ = std::numeric_limits<T>::infinity();
+
+    storage lower_;
+    storage upper_;
+
+    struct uninitialized_tag { };
+
+        // Allocates storage for  n  elements without initializing them.
+    explicit interval_array(gsl::dim n, uninitialized_tag)
+        : lower_(gsl::narrow_cast<std::size_t>(n)), upper_(gsl::narrow_cast<std::size_t>(n))
+    {
+    }
+
+public:
+    using value_type = interval<T>;
+
+        // Constructs an empty array.
+    interval_array() = default;
+
+        // Constructs an array of  n  unassigned intervals.
+    explicit interval_array(gsl::dim n)
+        : lower_(gsl::narrow_cast<std::size_t>(n), inf_), upper_(gsl::narrow_cast<std::size_t>(n), -inf_)
+    {
+        gsl_Expects(n >= 0);
+    }
+
+        // Constructs an array of  n  copies of the given interval.
+    explicit interval_array(gsl::dim n, interval<T> const& value)
+        : lower_(gsl::narrow_cast<std::size_t>(n), value.lower_unchecked()), upper_(gsl::narrow_cast<std::size_t>(n), value.upper_unchecked())
+    {
+        gsl_Expects(n >= 0);
+    }
+
+        // Constructs an array from a list of intervals.
+    interval_array(std::initializer_list<interval<T>> values)
+        : interval_array(std::span<interval<T> const>(values.begin(), values.size()))
+    {
+    }
+
+        // Constructs an array from a sequence of intervals.
+    explicit interval_array(std::span<interval<T> const> values)
+        : interval_array(gsl::ssize(values), uninitialized_tag{ })
+    {
+        for (std::size_t i = 0, n = values.size(); i != n; ++i)
+        {
+            lower_[i] = values[i].lower_unchecked();
+            upper_[i] = values[i].upper_unchecked();
+        }
+    }
+
+    [[nodiscard]] gsl::dim
+    size() const noexcept
+    {
+        return gsl::ssize(lower_);
+    }
+    [[nodiscard]] bool
+    empty() const noexcept
+    {
+        return lower_.empty();
+    }
+
+        // Resizes the array to  n  elements. New elements are unassigned.
+    void
+    resize(gsl::dim n)
+    {
+        gsl_Expects(n >= 0);
+
+        lower_.resize(gsl::narrow_cast<std::size_t>(n), inf_);
+        upper_.resize(gsl::narrow_cast<std::size_t>(n), -inf_);
+    }
+
+        // Direct access to the arrays of lower and upper bounds. Unassigned elements have lower bound ∞ and upper bound -∞.
+    [[nodiscard]] std::span<T>
+    lower() noexcept
+    {
+        return lower_;
+    }
+    [[nodiscard]] std::span<T const>
+    lower() const noexcept
+    {
+        return lower_;
+    }
+    [[nodiscard]] std::span<T>
+    upper() noexcept
+    {
+        return upper_;
+    }
+    [[nodiscard]] std::span<T const>
+    upper() const noexcept
+    {
+        return upper_;
+    }
+
+    [[nodiscard]] interval<T>
+    operator [](gsl::index i) const
+    {
+        gsl_ExpectsDebug(i >= 0 && i < size());
+
+        auto lo = lower_[gsl::narrow_cast<std::size_t>(i)];
+        auto hi = upper_[gsl::narrow_cast<std::size_t>(i)];
+        return lo > hi
+            ? interval<T>{ }
+            : interval<T>{ lo, hi };
+    }
+
+        // Marks the  i -th element as unassigned.
+    interval_array&
+    reset(gsl::index i)
+    {
+        gsl_ExpectsDebug(i >= 0 && i < size());
+
+        lower_[gsl::narrow_cast<std::size_t>(i)] = inf_;
+        upper_[gsl::narrow_cast<std::size_t>(i)] = -inf_;
+        return *this;
+    }
+        // Sets the  i -th element to the given interval.
+    interval_array&
+    reset(gsl::index i, detail::interval_base<T> const& value)
+    {
+        gsl_ExpectsDebug(i >= 0 && i < size());
+
+        lower_[gsl::narrow_cast<std::size_t>(i)] = value.lower_unchecked();
+        upper_[gsl::narrow_cast<std::size_t>(i)] = value.upper_unchecked();
+        return *this;
+    }
+        // Widens the  i -th element such that it contains the given value or interval.
+    interval_array&
+    assign(gsl::index i, T value)
+    {
+        gsl_ExpectsDebug(i >= 0 && i < size());
+
+        auto& lo = lower_[gsl::narrow_cast<std::size_t>(i)];
+        auto& hi = upper_[gsl::narrow_cast<std::size_t>(i)];
+        lo = intervals::min(lo, value);
+        hi = intervals::max(hi, value);
+        return *this;
+    }
+    interval_array&
+    assign(gsl::index i, detail::interval_base<T> const& value)
+    {
+        gsl_ExpectsDebug(i >= 0 && i < size());
+        gsl_Expects(value.assigned());
+
+        auto& lo = lower_[gsl::narrow_cast<std::size_t>(i)];
+        auto& hi = upper_[gsl::narrow_cast<std::size_t>(i)];
+        lo = intervals::min(lo, value.lower_unchecked());
+        hi = intervals::max(hi, value.upper_unchecked());
+        return *this;
+    }
+
+    [[nodiscard]] friend interval_array
+    operator +(interval_array const& x)
+    {
+        gsl_ExpectsAudit(detail::interval_array_access::all_assigned(x));
+
+        return x;
+    }
+    [[nodiscard]] friend interval_array
+    operator -(interval_array const& x)
+    {
+        return detail::interval_array_access::apply(detail::negate_bounds, x);
+    }
+
+    template <typename X, typename Y>
+    requires detail::interval_array_operands<X, Y, T>
+    [[nodiscard]] friend interval_array
+    operator +(X const& x, Y const& y)
+    {
+        return detail::interval_array_access::apply<T>(detail::add_bounds, x, y);
+    }
+    template <typename X, typename Y>
+    requires detail::interval_array_operands<X, Y, T>
+    [[nodiscard]] friend interval_array
+    operator -(X const& x, Y const& y)
+    {
+        return detail::interval_array_access::apply<T>(detail::subtract_bounds, x, y);
+    }
+    template <typename X, typename Y>
+    requires detail::interval_array_operands<X, Y, T>
+    [[nodiscard]] friend interval_array
+    operator *(X const& x, Y const& y)
+    {
+        return detail::interval_array_access::apply<T>(detail::multiply_bounds, x, y);
+    }
+    template <typename X, typename Y>
+    requires detail::interval_array_operands<X, Y, T>
+    [[nodiscard]] friend interval_array
+    operator /(X const& x, Y const& y)
+    {
+        return detail::interval_array_access::apply<T>(detail::divide_bounds, x, y);
+    }
+
+    template <typename X, typename Y>
+    requires detail::interval_array_operands<X, Y, T>
+    [[nodiscard]] friend bool_set_array
+    operator ==(X const& x, Y const& y)
+    {
+        return detail::interval_array_access::compare<T>(detail::equal_truth_values, x, y);
+    }
+    template <typename X, typename Y>
+    requires detail::interval_array_operands<X, Y, T>
+    [[nodiscard]] friend bool_set_array
+    operator !=(X const& x, Y const& y)
+    {
+        return detail::interval_array_access::compare<T>(detail::not_equal_truth_values, x, y);
+    }
+    template <typename X, typename Y>
+    requires detail::interval_array_operands<X, Y, T>
+    [[nodiscard]] friend bool_set_array
+    operator <(X const& x, Y const& y)
+    {
+        return detail::interval_array_access::compare<T>(detail::less_truth_values, x, y);
+    }
+    template <typename X, typename Y>
+    requires detail::interval_array_operands<X, Y, T>
+    [[nodiscard]] friend bool_set_array
+    operator <=(X const& x, Y const& y)
+    {
+        return detail::interval_array_access::compare<T>(detail::less_equal_truth_values, x, y);
+    }
+    template <typename X, typename Y>
+    requires detail::interval_array_operands<X, Y, T>
+    [[nodiscard]] friend bool_set_array
+    operator >(X const& x, Y const& y)
+    {
+        return detail::interval_array_access::compare<T>(detail::less_truth_values, y, x);
+    }
+    template <typename X, typename Y>
+    requires detail::interval_array_operands<X, Y, T>
+    [[nodiscard]] friend bool_set_array
+    operator >=(X const& x, Y const& y)
+    {
+        return detail::interval_array_access::compare<T>(detail::less_equal_truth_values, y, x);
+    }
+};
+
+
+inline namespace math {
+
+
+template <std::floating_point T, typename Y>
+requires detail::interval_array_operand<Y, T>
+[[nodiscard]] interval_array<T>
+min(interval_array<T> const& x, Y const& y)
+{
+    return detail::interval_array_access::apply<T>(detail::min_bounds, x, y);
+}
+template <typename X, std::floating_point T>
+requires detail::interval_array_operand<X, T> && (!std::same_as<X, interval_array<T>>)
+[[nodiscard]] interval_array<T>
+min(X const& x, interval_array<T> const& y)
+{
+    return detail::interval_array_access::apply<T>(detail::min_bounds, x, y);
+}
+template <std::floating_point T, typename Y>
+requires detail::interval_array_operand<Y, T>
+[[nodiscard]] interval_array<T>
+max(interval_array<T> const& x, Y const& y)
+{
+    return detail::interval_array_access::apply<T>(detail::max_bounds, x, y);
+}
+template <typename X, std::floating_point T>
+requires detail::interval_array_operand<X, T> && (!std::same_as<X, interval_array<T>>)
+[[nodiscard]] interval_array<T>
+max(X const& x, interval_array<T> const& y)
+{
+    return detail::interval_array_access::apply<T>(detail::max_bounds, x, y);
+}
+
+template <std::floating_point T>
+[[nodiscard]] interval_array<T>
+square(interval_array<T> const& x)
+{
+    return detail::interval_array_access::apply(detail::square_bounds, x);
+}
+template <std::floating_point T>
+[[nodiscard]] interval_array<T>
+abs(interval_array<T> const& x)
+{
+    return detail::interval_array_access::apply(detail::abs_bounds, x);
+}
+template <std::floating_point T>
+[[nodiscard]] interval_array<T>
+sqrt(interval_array<T> const& x)
+{
+    gsl_ExpectsAudit(std::ranges::all_of(x.lower(), [](T lo) { return lo >= 0; }));
+
+    return detail::interval_array_access::apply(detail::sqrt_bounds, x);
+}
+template <std::floating_point T>
+[[nodiscard]] interval_array<T>
+exp(interval_array<T> const& x)
+{
+    return detail::interval_array_access::apply(detail::exp_bounds, x);
+}
+template <std::floating_point T>
+[[nodiscard]] interval_array<T>
+log(interval_array<T> const& x)
+{
+    gsl_ExpectsAudit(std::ranges::all_of(x.lower(), [](T lo) { return lo >= 0; }));
+
+    return detail::interval_array_access::apply(detail::log_bounds, x);
+}
+template <std::floating_point T>
+[[nodiscard]] interval_array<T>
+sin(interval_array<T> const& x)
+{
+    return detail::interval_array_access::apply(detail::sin_bounds, x);
+}
+template <std::floating_point T>
+[[nodiscard]] interval_array<T>
+cos(interval_array<T> const& x)
+{
+    return detail::interval_array_access::apply(detail::cos_bounds, x);
+}
+template <std::floating_point T>
+[[nodiscard]] interval_array<T>
+atan(interval_array<T> const& x)
+{
+    return detail::interval_array_access::apply(detail::atan_bounds, x);
+}
+
+    // Element-wise selection: the  i -th element of the result is the hull of  resultIfTrue[i]  if  cond[i]  may be `true`
+    // and of  resultIfFalse[i]  if  cond[i]  may be `false`.
+template <std::floating_point T, typename Y>
+requires detail::interval_array_operand<Y, T>
+[[nodiscard]] interval_array<T>
+if_else(bool_set_array const& cond, interval_array<T> const& resultIfTrue, Y const& resultIfFalse)
+{
+    return detail::interval_array_access::if_else<T>(cond, resultIfTrue, resultIfFalse);
+}
+template <typename X, std::floating_point T>
+requires detail::interval_array_operand<X, T> && (!std::same_as<X, interval_array<T>>)
+[[nodiscard]] interval_array<T>
+if_else(bool_set_array const& cond, X const& resultIfTrue, interval_array<T> const& resultIfFalse)
+{
+    return detail::interval_array_access::if_else<T>(cond, resultIfTrue, resultIfFalse);
+}
+
+
+} // inline namespace math
+
+
+namespace detail {
+
+
+template <typename T, typename F, typename X, typename Y>
+inline bool_set_array
+interval_array_access::compare(F f, X const& x, Y const& y)
+{
+    gsl::dim nx = size<T>(x);
+    gsl::dim ny = size<T>(y);
+    gsl_Expects(nx < 0 || ny < 0 || nx == ny);
+
+    gsl::dim n = nx >= 0 ? nx : ny;
+    return bool_set_array_access::generate(n, [&](std::uint64_t* rf, std::uint64_t* rt)
+    {
+        detail::_compare_transform<T>(gsl::narrow_cast<std::size_t>(n), rf, rt, f, operand<T>(x), operand<T>(y));
+    });
+}
+template <typename T, typename X, typename Y>
+inline interval_array<T>
+interval_array_access::if_else(bool_set_array const& c, X const& x, Y const& y)
+{
+    gsl::dim nx = size<T>(x);
+    gsl::dim ny = size<T>(y);
+    gsl_Expects(nx < 0 || ny < 0 || nx == ny);
+    gsl_Expects(c.size() == (nx >= 0 ? nx : ny));
+
+    auto cw = bool_set_array_access::operand(c);
+    auto result = interval_array<T>(c.size(), typename interval_array<T>::uninitialized_tag{ });
+    detail::_blend(gsl::narrow_cast<std::size_t>(c.size()), result.lower_.data(), result.upper_.data(), cw.f, cw.t, operand<T>(x), operand<T>(y));
+    return result;
+}
+
+
+} // namespace detail
+
+
+} // namespace intervals
+
+
+#endif // INCLUDED_INTERVALS_INTERVAL_ARRAY_HPP_
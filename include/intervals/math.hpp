@@ -3,13 +3,17 @@
 #define INCLUDED_INTERVALS_MATH_HPP_
 
 
-#include <concepts>     // for floating_point<>
-#include <type_traits>  // for common_type<>
+#include <cmath>
+#include <utility>      // for pair<>
+#include <concepts>     // for floating_point<>, integral<>
+#include <type_traits>  // for common_type<>, is_constant_evaluated()
 
 #include <gsl-lite/gsl-lite.hpp>  // for gsl_Expects(), gsl_ExpectsDebug()
 
 #include <intervals/concepts.hpp>
 
+#include <intervals/detail/math.hpp>
+
 
 namespace intervals {
 
@@ -19,8 +23,9 @@ namespace gsl = gsl_lite;
     //
     // Wrap  x  into the  [min,max)  interval.
     //
-    // This routine is not adequate for arguments vastly larger than the target range. To support these arguments with high
-    // accuracy, use an approach that avoids cancellation, e.g. Payne–Hanek (cf. https://stackoverflow.com/a/30465751).
+    // This routine is not adequate for arguments vastly larger than the target range because the rounding error of  max - min
+    // is amplified by the quotient. The trigonometric functions therefore do not use it; they reduce their arguments with the
+    // Cody–Waite and Payne–Hanek algorithms (cf. `detail::reduce_pio2()`).
     //
 template <std::floating_point T>
 [[nodiscard]] constexpr T
@@ -29,13 +34,24 @@ wraparound(T x, T min, T max)
     gsl_Expects(min < max);
 
     T range = max - min;
-    return min + std::fmod(range + fmod(x - min, range), range);
+    if (std::is_constant_evaluated())
+    {
+        return min + detail::constexpr_fmod(range + detail::constexpr_fmod(x - min, range), range);
+    }
+    return min + std::fmod(range + std::fmod(x - min, range), range);
 }
 
 
 inline namespace math {
 
 
+    //
+    // The elementary functions below call the functions of the standard library at runtime. During constant evaluation,
+    // which the standard library functions do not support in C++20, they resort to the `constexpr` implementations in
+    // <intervals/detail/math.hpp> instead; see there for error bounds.
+    //
+
+
 template <interval_value X>
 [[nodiscard]] constexpr inline X
 infimum(X x)
@@ -75,137 +91,261 @@ cube(T x)
     return x*x*x;
 }
 template <arithmetic T>
-[[nodiscard]] inline T
+[[nodiscard]] constexpr T
 abs(T x)
 {
+    if (std::is_constant_evaluated())
+    {
+        if constexpr (std::floating_point<T>)
+        {
+            return detail::constexpr_abs(x);
+        }
+        else
+        {
+            return x < 0 ? -x : x;
+        }
+    }
     return std::abs(x);
 }
 
 template <std::floating_point T>
-[[nodiscard]] inline T
+[[nodiscard]] constexpr T
 sqrt(T x)
 {
     gsl_ExpectsDebug(x >= 0);
 
+    if (std::is_constant_evaluated())
+    {
+        return detail::constexpr_sqrt(x);
+    }
     return std::sqrt(x);
 }
 template <std::floating_point T>
-[[nodiscard]] inline T
+[[nodiscard]] constexpr T
 cbrt(T x)
 {
+    if (std::is_constant_evaluated())
+    {
+        return detail::constexpr_cbrt(x);
+    }
     return std::cbrt(x);
 }
 template <std::floating_point T>
-[[nodiscard]] inline T
+[[nodiscard]] constexpr T
 log(T x)
 {
     gsl_ExpectsDebug(x >= 0);  // 0 is allowed because floats can represent -∞.
 
+    if (std::is_constant_evaluated())
+    {
+        return detail::constexpr_log(x);
+    }
     return std::log(x);
 }
 template <std::floating_point T>
-[[nodiscard]] inline T
+[[nodiscard]] constexpr T
 exp(T x)
 {
+    if (std::is_constant_evaluated())
+    {
+        return detail::constexpr_exp(x);
+    }
     return std::exp(x);
 }
 template <std::floating_point T>
-[[nodiscard]] inline T
+[[nodiscard]] constexpr T
 pow(T x, T y)
 {
+    if (std::is_constant_evaluated())
+    {
+        return detail::constexpr_pow(x, y);
+    }
     return std::pow(x, y);
 }
 
+    // Compute  xⁿ  by binary exponentiation. For integral types,  n  must be non-negative.
+template <arithmetic T>
+[[nodiscard]] constexpr inline T
+pown(T x, int n)
+{
+    if constexpr (std::integral<T>)
+    {
+        gsl_Expects(n >= 0);
+    }
+
+    unsigned k = n < 0 ? 0u - unsigned(n) : unsigned(n);
+    T result = T(1);
+    while (k != 0)
+    {
+        if ((k & 1) != 0)
+        {
+            result *= x;
+        }
+        k >>= 1;
+        if (k != 0)
+        {
+            x *= x;
+        }
+    }
+    return n < 0 ? T(1)/result : result;
+}
+    // Compute  xᴺ  for a compile-time exponent  N .
+template <int N, arithmetic T>
+[[nodiscard]] constexpr inline T
+pow(T x)
+{
+    return intervals::pown(x, N);
+}
+
 template <std::floating_point T>
-[[nodiscard]] inline T
+[[nodiscard]] constexpr T
 sin(T x)
 {
+    if (std::is_constant_evaluated())
+    {
+        return detail::constexpr_sin(x);
+    }
     return std::sin(x);
 }
 template <std::floating_point T>
-[[nodiscard]] inline T
+[[nodiscard]] constexpr T
 cos(T x)
 {
+    if (std::is_constant_evaluated())
+    {
+        return detail::constexpr_cos(x);
+    }
     return std::cos(x);
 }
+    // Compute  sin x  and  cos x . Provided for generic code which calls `sincos()` with interval arguments.
 template <std::floating_point T>
-[[nodiscard]] inline T
+[[nodiscard]] constexpr std::pair<T, T>
+sincos(T x)
+{
+    return { intervals::sin(x), intervals::cos(x) };
+}
+template <std::floating_point T>
+[[nodiscard]] constexpr T
 tan(T x)
 {
+    if (std::is_constant_evaluated())
+    {
+        return detail::constexpr_tan(x);
+    }
     return std::tan(x);
 }
 template <std::floating_point T>
-[[nodiscard]] inline T
+[[nodiscard]] constexpr T
 asin(T x)
 {
     gsl_ExpectsDebug(x >= -1 && x <= 1);
 
+    if (std::is_constant_evaluated())
+    {
+        return detail::constexpr_asin(x);
+    }
     return std::asin(x);
 }
 template <std::floating_point T>
-[[nodiscard]] inline T
+[[nodiscard]] constexpr T
 acos(T x)
 {
     gsl_ExpectsDebug(x >= -1 && x <= 1);
 
+    if (std::is_constant_evaluated())
+    {
+        return detail::constexpr_acos(x);
+    }
     return std::acos(x);
 }
 template <std::floating_point T>
-[[nodiscard]] inline T
+[[nodiscard]] constexpr T
 atan(T x)
 {
+    if (std::is_constant_evaluated())
+    {
+        return detail::constexpr_atan(x);
+    }
     return std::atan(x);
 }
 template <std::floating_point T>
-[[nodiscard]] inline T
+[[nodiscard]] constexpr T
 atan2(T y, T x)
 {
     gsl_ExpectsDebug(y != 0 || x > 0);
 
+    if (std::is_constant_evaluated())
+    {
+        return detail::constexpr_atan2(y, x);
+    }
     return std::atan2(y, x);
 }
 
 template <std::floating_point T>
-[[nodiscard]] inline T
+[[nodiscard]] constexpr T
 floor(T x)
 {
+    if (std::is_constant_evaluated())
+    {
+        return detail::constexpr_floor(x);
+    }
     return std::floor(x);
 }
 template <std::floating_point T>
-[[nodiscard]] inline T
+[[nodiscard]] constexpr T
 ceil(T x)
 {
+    if (std::is_constant_evaluated())
+    {
+        return detail::constexpr_ceil(x);
+    }
     return std::ceil(x);
 }
 template <std::floating_point T>
-[[nodiscard]] inline T
+[[nodiscard]] constexpr T
 round(T x)
 {
+    if (std::is_constant_evaluated())
+    {
+        return detail::constexpr_round(x);
+    }
     return std::round(x);
 }
 template <std::floating_point T>
-[[nodiscard]] inline T
+[[nodiscard]] constexpr T
 frac(T x)
 {
-    return x - std::floor(x);
+    return x - intervals::floor(x);
 }
 
 template <std::floating_point T>
-[[nodiscard]] inline bool
+[[nodiscard]] constexpr bool
 isinf(T x)
 {
+    if (std::is_constant_evaluated())
+    {
+        return detail::constexpr_isinf(x);
+    }
     return std::isinf(x);
 }
 template <std::floating_point T>
-[[nodiscard]] inline bool
+[[nodiscard]] constexpr bool
 isfinite(T x)
 {
+    if (std::is_constant_evaluated())
+    {
+        return detail::constexpr_isfinite(x);
+    }
     return std::isfinite(x);
 }
 template <std::floating_point T>
-[[nodiscard]] inline bool
+[[nodiscard]] constexpr bool
 isnan(T x)
 {
+    if (std::is_constant_evaluated())
+    {
+        return detail::constexpr_isnan(x);
+    }
     return std::isnan(x);
 }
 
@@ -253,7 +393,15 @@ constexpr T
 blend_quadratic(T a, T b, T x, T y)
 {
     auto [wa, wb] = intervals::fractional_weights(a, b);
-    return std::sqrt(intervals::square(wa*x) + intervals::square(wb*y));
+    return intervals::sqrt(intervals::square(wa*x) + intervals::square(wb*y));
+}
+
+    // Compute  x⋅y + z  with a single rounding.
+template <std::floating_point T>
+[[nodiscard]] inline T
+fma(T x, T y, T z)
+{
+    return std::fma(x, y, z);
 }
 
 
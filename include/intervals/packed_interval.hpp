@@ -0,0 +1,251 @@
+
+#ifndef INCLUDED_INTERVALS_PACKED_INTERVAL_HPP_
+#define INCLUDED_INTERVALS_PACKED_INTERVAL_HPP_
+
+
+#include <cfenv>     // for fegetround(), FE_UPWARD
+#include <limits>
+#include <concepts>  // for same_as<>
+
+#include <gsl-lite/gsl-lite.hpp>  // for gsl_Expects(), gsl_ExpectsDebug(), gsl_ExpectsAudit()
+
+#include <intervals/interval.hpp>
+#include <intervals/rounding.hpp>  // for no_rounding, upward_rounding
+
+#include <intervals/detail/packed_interval.hpp>
+
+
+namespace intervals {
+
+namespace gsl = gsl_lite;
+
+
+    //
+    // Interval of `double` values stored as the pair  { -lower, upper }  in a single 16-byte SSE2 register.
+    //
+    // Storing the negated lower bound lets addition and subtraction be computed with a single vector instruction, and it
+    // lets both bounds be rounded in the same direction. With the `upward_rounding` policy, all operations are therefore
+    // rounded outward if the FPU rounding mode is set to upward rounding (cf. `upward_rounding_guard`); no other rounding
+    // policies are supported.
+    //
+    // `packed_interval<>` converts implicitly from and to `interval<double, PolicyT>`. It supports the arithmetic operators
+    // +, -, *, / , which produce the same results as the corresponding operations on `interval<double, PolicyT>`; other
+    // functions can be applied after conversion to `interval<>`. Multiplication and division of intervals with infinite or
+    // NaN bounds and division by intervals containing 0 are delegated to `interval<>`.
+    //
+    // If SSE2 is not available, the bounds are stored as an array, and all operations are delegated to `interval<>`.
+    //
+template <typename PolicyT = no_rounding>
+class packed_interval
+{
+    static_assert(std::same_as<PolicyT, no_rounding> || std::same_as<PolicyT, upward_rounding>,
+        "packed_interval<> supports only the rounding policies 'no_rounding' and 'upward_rounding'");
+
+    static constexpr double inf_ = std::numeric_limits<double>::infinity();
+
+#if INTERVALS_PACKED_INTERVAL_SSE2
+    __m128d bounds_;  // { -lower, upper }
+
+    explicit packed_interval(__m128d _bounds) noexcept
+        : bounds_(_bounds)
+    {
+    }
+
+    void
+    _reset(double _lower, double _upper) noexcept
+    {
+        bounds_ = _mm_set_pd(_upper, -_lower);
+    }
+
+    static void
+    _check_rounding_mode()
+    {
+        if constexpr (std::same_as<PolicyT, upward_rounding>)
+        {
+            gsl_ExpectsAudit(std::fegetround() == FE_UPWARD);
+        }
+    }
+#else // INTERVALS_PACKED_INTERVAL_SSE2
+    alignas(16) double bounds_[2];  // { -lower, upper }
+
+    void
+    _reset(double _lower, double _upper) noexcept
+    {
+        bounds_[0] = -_lower;
+        bounds_[1] = _upper;
+    }
+#endif // INTERVALS_PACKED_INTERVAL_SSE2
+
+public:
+    using value_type = double;
+    using policy_type = PolicyT;
+    using interval_type = interval<double, PolicyT>;
+
+    packed_interval() noexcept
+    {
+        _reset(inf_, -inf_);
+    }
+    packed_interval(double value) noexcept
+    {
+        _reset(value, value);
+    }
+    explicit packed_interval(double _lower, double _upper)
+    {
+        gsl_Expects(!(_lower > _upper));  // does not trigger for NaNs
+
+        _reset(_lower, _upper);
+    }
+    packed_interval(interval_type const& rhs) noexcept
+    {
+        _reset(rhs.lower_unchecked(), rhs.upper_unchecked());
+    }
+
+    packed_interval(packed_interval const&) = default;
+    packed_interval& operator =(packed_interval const&) = delete;
+
+    [[nodiscard]] operator interval_type() const
+    {
+        if (assigned())
+        {
+            return interval_type{ lower_unchecked(), upper_unchecked() };
+        }
+        return interval_type{ };
+    }
+
+    packed_interval&
+    reset() noexcept
+    {
+        _reset(inf_, -inf_);
+        return *this;
+    }
+    packed_interval&
+    reset(packed_interval const& rhs) noexcept
+    {
+        _reset(rhs.lower_unchecked(), rhs.upper_unchecked());
+        return *this;
+    }
+
+    [[nodiscard]] bool
+    assigned() const noexcept
+    {
+        return !(lower_unchecked() > upper_unchecked());
+    }
+
+    [[nodiscard]] double
+    lower_unchecked() const noexcept
+    {
+#if INTERVALS_PACKED_INTERVAL_SSE2
+        return -_mm_cvtsd_f64(bounds_);
+#else // INTERVALS_PACKED_INTERVAL_SSE2
+        return -bounds_[0];
+#endif // INTERVALS_PACKED_INTERVAL_SSE2
+    }
+    [[nodiscard]] double
+    upper_unchecked() const noexcept
+    {
+#if INTERVALS_PACKED_INTERVAL_SSE2
+        return _mm_cvtsd_f64(_mm_unpackhi_pd(bounds_, bounds_));
+#else // INTERVALS_PACKED_INTERVAL_SSE2
+        return bounds_[1];
+#endif // INTERVALS_PACKED_INTERVAL_SSE2
+    }
+    [[nodiscard]] double
+    lower() const
+    {
+        gsl_ExpectsDebug(assigned());
+
+        return lower_unchecked();
+    }
+    [[nodiscard]] double
+    upper() const
+    {
+        gsl_ExpectsDebug(assigned());
+
+        return upper_unchecked();
+    }
+
+    [[nodiscard]] bool
+    matches(packed_interval const& rhs) const noexcept
+    {
+        return lower_unchecked() == rhs.lower_unchecked() && upper_unchecked() == rhs.upper_unchecked();
+    }
+
+    [[nodiscard]] friend packed_interval
+    operator +(packed_interval x)
+    {
+        gsl_ExpectsDebug(x.assigned());
+
+        return x;
+    }
+    [[nodiscard]] friend packed_interval
+    operator -(packed_interval x)
+    {
+        gsl_ExpectsDebug(x.assigned());
+
+#if INTERVALS_PACKED_INTERVAL_SSE2
+        return packed_interval(detail::packed_swap(x.bounds_));
+#else // INTERVALS_PACKED_INTERVAL_SSE2
+        return -interval_type(x);
+#endif // INTERVALS_PACKED_INTERVAL_SSE2
+    }
+
+    [[nodiscard]] friend packed_interval
+    operator +(packed_interval x, packed_interval y)
+    {
+        gsl_ExpectsDebug(x.assigned() && y.assigned());
+
+#if INTERVALS_PACKED_INTERVAL_SSE2
+        _check_rounding_mode();
+        return packed_interval(detail::packed_add(x.bounds_, y.bounds_));
+#else // INTERVALS_PACKED_INTERVAL_SSE2
+        return interval_type(x) + interval_type(y);
+#endif // INTERVALS_PACKED_INTERVAL_SSE2
+    }
+    [[nodiscard]] friend packed_interval
+    operator -(packed_interval x, packed_interval y)
+    {
+        gsl_ExpectsDebug(x.assigned() && y.assigned());
+
+#if INTERVALS_PACKED_INTERVAL_SSE2
+            // x - y = x + (-y)
+        _check_rounding_mode();
+        return packed_interval(detail::packed_add(x.bounds_, detail::packed_swap(y.bounds_)));
+#else // INTERVALS_PACKED_INTERVAL_SSE2
+        return interval_type(x) - interval_type(y);
+#endif // INTERVALS_PACKED_INTERVAL_SSE2
+    }
+    [[nodiscard]] friend packed_interval
+    operator *(packed_interval x, packed_interval y)
+    {
+        gsl_ExpectsDebug(x.assigned() && y.assigned());
+
+#if INTERVALS_PACKED_INTERVAL_SSE2
+        if (detail::packed_all_finite(x.bounds_, y.bounds_))
+        {
+            _check_rounding_mode();
+            return packed_interval(detail::packed_multiply(x.bounds_, y.bounds_));
+        }
+#endif // INTERVALS_PACKED_INTERVAL_SSE2
+        return interval_type(x)*interval_type(y);
+    }
+    [[nodiscard]] friend packed_interval
+    operator /(packed_interval x, packed_interval y)
+    {
+        gsl_ExpectsDebug(x.assigned() && y.assigned());
+
+#if INTERVALS_PACKED_INTERVAL_SSE2
+        if (detail::packed_all_finite(x.bounds_, y.bounds_) && detail::packed_excludes_zero(y.bounds_))
+        {
+            _check_rounding_mode();
+            return packed_interval(detail::packed_divide(x.bounds_, y.bounds_));
+        }
+#endif // INTERVALS_PACKED_INTERVAL_SSE2
+        return interval_type(x)/interval_type(y);
+    }
+};
+
+
+} // namespace intervals
+
+
+#endif // INCLUDED_INTERVALS_PACKED_INTERVAL_HPP_
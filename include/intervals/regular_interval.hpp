@@ -0,0 +1,103 @@
+
+#ifndef INCLUDED_INTERVALS_REGULAR_INTERVAL_HPP_
+#define INCLUDED_INTERVALS_REGULAR_INTERVAL_HPP_
+
+
+#include <iosfwd>
+#include <compare>      // for operator <=>
+#include <type_traits>  // for is_trivially_copyable<>
+
+#include <gsl-lite/gsl-lite.hpp>  // for gsl_Expects(), gsl_ExpectsDebug()
+
+#include <intervals/concepts.hpp>
+#include <intervals/rounding.hpp>  // for no_rounding
+#include <intervals/interval.hpp>
+
+
+namespace intervals {
+
+namespace gsl = gsl_lite;
+
+
+    //
+    // Regular value type representing a non-empty interval of arithmetic values.
+    //
+    // Unlike `interval<>`, `regular_interval<>` has no "unassigned" state, and it supports copy assignment. It is trivially
+    // copyable and has the same layout as a pair of bounds, so arrays of `regular_interval<>` can be copied with `memcpy()`,
+    // sorted with `std::sort()`, and processed in vectorized loops.
+    //
+    // The comparison operators compare the bounds lexicographically, as for `std::pair<>`; they do not implement the
+    // set-valued relational operators of `interval<>`. For arithmetic, convert the operands to `interval<T, PolicyT>`; the
+    // result converts back implicitly:
+    //
+    //     auto xs = std::vector<regular_interval<double>>{ ... };
+    //     xs[0] = interval(xs[0]) + interval(xs[1]);
+    //
+template <arithmetic_interval_value T, typename PolicyT = no_rounding>
+class regular_interval
+{
+private:
+    T lower_ = { };
+    T upper_ = { };
+
+public:
+    using value_type = T;
+    using policy_type = PolicyT;
+    using interval_type = interval<T, PolicyT>;
+
+        // Constructs the degenerate interval  [0,0] .
+    regular_interval() = default;
+
+    constexpr regular_interval(T value) noexcept
+        : lower_(value), upper_(value)
+    {
+    }
+    explicit constexpr regular_interval(T _lower, T _upper)
+        : lower_(_lower), upper_(_upper)
+    {
+        gsl_Expects(!(_lower > _upper));  // does not trigger for NaNs
+    }
+
+        // Converts an interval to a `regular_interval<>`. The interval must be assigned.
+    constexpr regular_interval(interval_type const& rhs)
+        : lower_(rhs.lower_unchecked()), upper_(rhs.upper_unchecked())
+    {
+        gsl_ExpectsDebug(rhs.assigned());
+    }
+
+    [[nodiscard]] constexpr operator interval_type() const
+    {
+        return interval_type{ lower_, upper_ };
+    }
+
+    [[nodiscard]] constexpr T
+    lower() const noexcept
+    {
+        return lower_;
+    }
+    [[nodiscard]] constexpr T
+    upper() const noexcept
+    {
+        return upper_;
+    }
+
+    [[nodiscard]] friend constexpr bool operator ==(regular_interval const&, regular_interval const&) = default;
+    [[nodiscard]] friend constexpr auto operator <=>(regular_interval const&, regular_interval const&) = default;
+};
+template <arithmetic_interval_value T, typename PolicyT>
+regular_interval(interval<T, PolicyT>) -> regular_interval<T, PolicyT>;
+template <arithmetic_interval_value T, typename PolicyT>
+interval(regular_interval<T, PolicyT>) -> interval<T, PolicyT>;
+
+template <typename ElemT, typename TraitsT, typename T, typename PolicyT>
+std::basic_ostream<ElemT, TraitsT>&
+operator <<(std::basic_ostream<ElemT, TraitsT>& stream, regular_interval<T, PolicyT> const& x)
+{
+    return stream << interval<T, PolicyT>(x);
+}
+
+
+} // namespace intervals
+
+
+#endif // INCLUDED_INTERVALS_REGULAR_INTERVAL_HPP_
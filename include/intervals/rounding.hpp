@@ -0,0 +1,479 @@
+
+#ifndef INCLUDED_INTERVALS_ROUNDING_HPP_
+#define INCLUDED_INTERVALS_ROUNDING_HPP_
+
+
+#include <cmath>
+#include <cfenv>        // for fegetround(), fesetround(), FE_UPWARD
+#include <concepts>     // for floating_point<>
+#include <type_traits>  // for is_constant_evaluated()
+
+#include <gsl-lite/gsl-lite.hpp>  // for gsl_Assert(), gsl_ExpectsAudit()
+
+#include <intervals/detail/math.hpp>  // for constexpr_sqrt()
+#include <intervals/detail/rounding.hpp>
+
+
+namespace intervals {
+
+namespace gsl = gsl_lite;
+
+
+    //
+    // Rounding policies for floating-point intervals.
+    //
+    // A rounding policy is passed as the second template argument of `interval<>`, e.g. `interval<double, error_free_rounding>`.
+    // It determines how the bounds of the results of the arithmetic operations  +, -, *, /  and of `square()` and `sqrt()` are
+    // rounded. A rounding policy is a class with static member functions
+    //
+    //     add_down(a, b), add_up(a, b), sub_down(a, b), sub_up(a, b), mul_down(a, b), mul_up(a, b),
+    //     div_down(a, b), div_up(a, b), sqrt_down(x), sqrt_up(x), fma_down(a, b, c), fma_up(a, b, c)
+    //
+    // which return a lower or upper bound of the exact result of the respective operation, where `fma_*()` refer to the
+    // fused multiply–add operation  a⋅b + c . Other elementary functions are computed with the standard library and are not
+    // rounded outward unless the policy is wrapped in `libm_error_padding<>`.
+    //
+    // Operations on intervals with different rounding policies cannot be mixed.
+    //
+
+
+    //
+    // Do not round outward. Bounds are computed in the current rounding mode, which usually is round-to-nearest; results
+    // thus are not guaranteed to enclose the exact result. This is the default policy.
+    //
+    // This is the only policy whose square roots can be computed during constant evaluation.
+    //
+struct no_rounding
+{
+    template <typename T> [[nodiscard]] static constexpr T add_down(T a, T b) noexcept { return a + b; }
+    template <typename T> [[nodiscard]] static constexpr T add_up(T a, T b) noexcept { return a + b; }
+    template <typename T> [[nodiscard]] static constexpr T sub_down(T a, T b) noexcept { return a - b; }
+    template <typename T> [[nodiscard]] static constexpr T sub_up(T a, T b) noexcept { return a - b; }
+    template <typename T> [[nodiscard]] static constexpr T mul_down(T a, T b) noexcept { return a*b; }
+    template <typename T> [[nodiscard]] static constexpr T mul_up(T a, T b) noexcept { return a*b; }
+    template <typename T> [[nodiscard]] static constexpr T div_down(T a, T b) noexcept { return a/b; }
+    template <typename T> [[nodiscard]] static constexpr T div_up(T a, T b) noexcept { return a/b; }
+    template <std::floating_point T> [[nodiscard]] static constexpr T sqrt_down(T x) noexcept { return std::is_constant_evaluated() ? detail::constexpr_sqrt(x) : std::sqrt(x); }
+    template <std::floating_point T> [[nodiscard]] static constexpr T sqrt_up(T x) noexcept { return std::is_constant_evaluated() ? detail::constexpr_sqrt(x) : std::sqrt(x); }
+    template <std::floating_point T> [[nodiscard]] static T fma_down(T a, T b, T c) noexcept { return std::fma(a, b, c); }
+    template <std::floating_point T> [[nodiscard]] static T fma_up(T a, T b, T c) noexcept { return std::fma(a, b, c); }
+};
+
+    //
+    // Widen every rounded bound by one unit in the last place. Operations which are exact because an operand is zero are not
+    // widened.
+    //
+    // This is the simplest strategy that guarantees enclosure in round-to-nearest mode, but it also widens results which
+    // were computed exactly.
+    //
+struct nextafter_rounding
+{
+    template <std::floating_point T>
+    [[nodiscard]] static constexpr T
+    add_down(T a, T b) noexcept
+    {
+        T s = a + b;
+        return (a == 0) | (b == 0) ? s : detail::next_down(s);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static constexpr T
+    add_up(T a, T b) noexcept
+    {
+        T s = a + b;
+        return (a == 0) | (b == 0) ? s : detail::next_up(s);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static constexpr T
+    sub_down(T a, T b) noexcept
+    {
+        return add_down(a, -b);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static constexpr T
+    sub_up(T a, T b) noexcept
+    {
+        return add_up(a, -b);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static constexpr T
+    mul_down(T a, T b) noexcept
+    {
+        T p = a*b;
+        return (a == 0) | (b == 0) ? p : detail::next_down(p);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static constexpr T
+    mul_up(T a, T b) noexcept
+    {
+        T p = a*b;
+        return (a == 0) | (b == 0) ? p : detail::next_up(p);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static constexpr T
+    div_down(T a, T b) noexcept
+    {
+        T q = a/b;
+        return a == 0 ? q : detail::next_down(q);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static constexpr T
+    div_up(T a, T b) noexcept
+    {
+        T q = a/b;
+        return a == 0 ? q : detail::next_up(q);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static T
+    sqrt_down(T x) noexcept
+    {
+        T s = std::sqrt(x);
+        return x == 0 ? s : detail::next_down(s);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static T
+    sqrt_up(T x) noexcept
+    {
+        T s = std::sqrt(x);
+        return x == 0 ? s : detail::next_up(s);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static T
+    fma_down(T a, T b, T c) noexcept
+    {
+        T r = std::fma(a, b, c);
+        return (a == 0) | (b == 0) ? r : detail::next_down(r);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static T
+    fma_up(T a, T b, T c) noexcept
+    {
+        T r = std::fma(a, b, c);
+        return (a == 0) | (b == 0) ? r : detail::next_up(r);
+    }
+};
+
+    //
+    // Compute the rounding error of every operation with an error-free transformation (TwoSum for addition and subtraction,
+    // an FMA-based residual for multiplication, division, and square root), and widen a rounded bound by one unit in the last
+    // place only if the rounding error points outward.
+    //
+    // Exact operations are not widened, so this policy yields tighter enclosures than `nextafter_rounding`. It requires
+    // fast hardware FMA instructions to be competitive.
+    //
+struct error_free_rounding
+{
+    template <std::floating_point T>
+    [[nodiscard]] static constexpr T
+    add_down(T a, T b) noexcept
+    {
+        T s = a + b;
+        T e = detail::two_sum_error(a, b, s);
+        return e >= 0 ? s : detail::next_down(s);  // also widens if  e  is NaN
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static constexpr T
+    add_up(T a, T b) noexcept
+    {
+        T s = a + b;
+        T e = detail::two_sum_error(a, b, s);
+        return e <= 0 ? s : detail::next_up(s);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static constexpr T
+    sub_down(T a, T b) noexcept
+    {
+        return add_down(a, -b);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static constexpr T
+    sub_up(T a, T b) noexcept
+    {
+        return add_up(a, -b);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static T
+    mul_down(T a, T b) noexcept
+    {
+        T p = a*b;
+        T e = std::fma(a, b, -p);  // a⋅b = p + e
+        bool exact = (a == 0) | (b == 0);
+        bool reliable = std::abs(p) >= detail::error_free_threshold<T>;
+        return exact | (reliable & (e >= 0)) ? p : detail::next_down(p);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static T
+    mul_up(T a, T b) noexcept
+    {
+        T p = a*b;
+        T e = std::fma(a, b, -p);
+        bool exact = (a == 0) | (b == 0);
+        bool reliable = std::abs(p) >= detail::error_free_threshold<T>;
+        return exact | (reliable & (e <= 0)) ? p : detail::next_up(p);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static T
+    div_down(T a, T b) noexcept
+    {
+        T q = a/b;
+        T r = std::fma(-q, b, a);  // a/b = q + r/b
+        bool exact = a == 0;
+        bool reliable = std::abs(a) >= detail::error_free_threshold<T>;
+        bool nonnegativeError = (r == 0) | ((r > 0) & (b > 0)) | ((r < 0) & (b < 0));
+        return exact | (reliable & nonnegativeError) ? q : detail::next_down(q);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static T
+    div_up(T a, T b) noexcept
+    {
+        T q = a/b;
+        T r = std::fma(-q, b, a);
+        bool exact = a == 0;
+        bool reliable = std::abs(a) >= detail::error_free_threshold<T>;
+        bool nonpositiveError = (r == 0) | ((r > 0) & (b < 0)) | ((r < 0) & (b > 0));
+        return exact | (reliable & nonpositiveError) ? q : detail::next_up(q);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static T
+    sqrt_down(T x) noexcept
+    {
+        T s = std::sqrt(x);
+        T r = std::fma(-s, s, x);  // x = s² + r
+        bool exact = x == 0;
+        bool reliable = x >= detail::error_free_threshold<T>;
+        return exact | (reliable & (r >= 0)) ? s : detail::next_down(s);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static T
+    sqrt_up(T x) noexcept
+    {
+        T s = std::sqrt(x);
+        T r = std::fma(-s, s, x);
+        bool exact = x == 0;
+        bool reliable = x >= detail::error_free_threshold<T>;
+        return exact | (reliable & (r <= 0)) ? s : detail::next_up(s);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static T
+    fma_down(T a, T b, T c) noexcept
+    {
+            // If the product is exact, the FMA operation amounts to the sum  p + c , whose error can be computed with TwoSum.
+            // Otherwise, the rounded result is widened unconditionally.
+        T p = a*b;
+        T e = std::fma(a, b, -p);
+        bool exactProduct = (a == 0) | (b == 0) | ((std::abs(p) >= detail::error_free_threshold<T>) & (e == 0));
+        return exactProduct ? add_down(p, c) : detail::next_down(std::fma(a, b, c));
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static T
+    fma_up(T a, T b, T c) noexcept
+    {
+        T p = a*b;
+        T e = std::fma(a, b, -p);
+        bool exactProduct = (a == 0) | (b == 0) | ((std::abs(p) >= detail::error_free_threshold<T>) & (e == 0));
+        return exactProduct ? add_up(p, c) : detail::next_up(std::fma(a, b, c));
+    }
+};
+
+    //
+    // Assume that the rounding mode has been set to round upward, e.g. with an `upward_rounding_guard` object, and compute
+    // lower bounds by negating the operands, which is exact, and rounding upward.
+    //
+    // Switching the rounding mode is expensive, and hence should be done once for a batch of operations rather than for every
+    // operation. The compiler must be instructed to respect the dynamic rounding mode, e.g. with `-frounding-math` for GCC
+    // and Clang or `/fp:strict` for MSVC; otherwise, it may constant-fold operations or cancel the negations.
+    //
+struct upward_rounding
+{
+    template <std::floating_point T>
+    [[nodiscard]] static T
+    add_down(T a, T b)
+    {
+        gsl_ExpectsAudit(std::fegetround() == FE_UPWARD);
+
+        return -((-a) - b);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static T
+    add_up(T a, T b)
+    {
+        gsl_ExpectsAudit(std::fegetround() == FE_UPWARD);
+
+        return a + b;
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static T
+    sub_down(T a, T b)
+    {
+        gsl_ExpectsAudit(std::fegetround() == FE_UPWARD);
+
+        return -(b - a);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static T
+    sub_up(T a, T b)
+    {
+        gsl_ExpectsAudit(std::fegetround() == FE_UPWARD);
+
+        return a - b;
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static T
+    mul_down(T a, T b)
+    {
+        gsl_ExpectsAudit(std::fegetround() == FE_UPWARD);
+
+        return -((-a)*b);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static T
+    mul_up(T a, T b)
+    {
+        gsl_ExpectsAudit(std::fegetround() == FE_UPWARD);
+
+        return a*b;
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static T
+    div_down(T a, T b)
+    {
+        gsl_ExpectsAudit(std::fegetround() == FE_UPWARD);
+
+        return -((-a)/b);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static T
+    div_up(T a, T b)
+    {
+        gsl_ExpectsAudit(std::fegetround() == FE_UPWARD);
+
+        return a/b;
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static T
+    sqrt_down(T x)
+    {
+        gsl_ExpectsAudit(std::fegetround() == FE_UPWARD);
+
+            // Square root cannot be rounded downward by negation; instead, check whether  s² ≤ x  holds. The FMA operation
+            // rounds upward, so the check cannot succeed spuriously.
+        T s = std::sqrt(x);
+        return std::fma(s, s, -x) <= 0 ? s : detail::next_down(s);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static T
+    sqrt_up(T x)
+    {
+        gsl_ExpectsAudit(std::fegetround() == FE_UPWARD);
+
+        return std::sqrt(x);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static T
+    fma_down(T a, T b, T c)
+    {
+        gsl_ExpectsAudit(std::fegetround() == FE_UPWARD);
+
+        return -std::fma(-a, b, -c);
+    }
+    template <std::floating_point T>
+    [[nodiscard]] static T
+    fma_up(T a, T b, T c)
+    {
+        gsl_ExpectsAudit(std::fegetround() == FE_UPWARD);
+
+        return std::fma(a, b, c);
+    }
+};
+
+
+    //
+    // Sets the rounding mode to round upward for the lifetime of the object, and restores the previous rounding mode upon
+    // destruction. Use in conjunction with `upward_rounding`.
+    //
+class upward_rounding_guard
+{
+private:
+    int previousMode_;
+
+public:
+    upward_rounding_guard()
+        : previousMode_(std::fegetround())
+    {
+        int status = std::fesetround(FE_UPWARD);
+        gsl_Assert(status == 0);
+    }
+    ~upward_rounding_guard()
+    {
+        std::fesetround(previousMode_);
+    }
+
+    upward_rounding_guard(upward_rounding_guard const&) = delete;
+    upward_rounding_guard& operator =(upward_rounding_guard const&) = delete;
+};
+
+
+    //
+    // Policy adaptor which declares that all bounds are finite. Bounds are rounded as defined by the rounding policy  PolicyT .
+    //
+    // The constructors of `interval<T, finite_only_policy<PolicyT>>` require that the bounds be finite, which is checked in
+    // debug mode. Arithmetic operations can then skip the special-case handling of infinite bounds, which allows for
+    // branch-free code. Scalar operands must also be finite. Overflow of an arithmetic operation to an infinite bound is caught
+    // by the same finiteness checks in debug mode.
+    //
+template <typename PolicyT>
+struct finite_only_policy : PolicyT
+{
+    static constexpr bool finite_only = true;
+};
+
+    //
+    // Policy for intervals with finite bounds which are rounded to nearest (cf. `finite_only_policy<>`, `no_rounding`).
+    //
+using finite_only = finite_only_policy<no_rounding>;
+
+
+    //
+    // Error bounds, in units of the last place of the exact result, of the elementary functions of the standard library, as
+    // used by `libm_error_padding<>`. Other bounds can be defined with a class which derives from `libm_ulp_bounds` and
+    // redefines some of the members.
+    //
+    // The defaults are conservative bounds for glibc on x86-64 for `float` and `double`, based on the known maximal errors
+    // listed in the glibc manual. The benchmark program `benchmark-libm_ulps` compares them to the errors observed on the
+    // build machine. The bounds have not been verified for `long double`.
+    //
+struct libm_ulp_bounds
+{
+    static constexpr int exp = 1;
+    static constexpr int log = 1;
+    static constexpr int pow = 1;
+    static constexpr int cbrt = 4;
+    static constexpr int sin = 1;
+    static constexpr int cos = 1;
+    static constexpr int tan = 2;
+    static constexpr int asin = 1;
+    static constexpr int acos = 1;
+    static constexpr int atan = 1;
+    static constexpr int atan2 = 2;
+};
+
+    //
+    // Policy adaptor which pads the results of the elementary functions `exp()`, `log()`, `cbrt()`, `sin()`, `cos()`,
+    // `tan()`, `asin()`, `acos()`, `atan()`, `atan2()`, and `pow()` by the error bounds  UlpBoundsT  of the
+    // standard library (cf. `libm_ulp_bounds`). Combined with an outward rounding policy  PolicyT , e.g.
+    // `libm_error_padding<error_free_rounding>`, the results are rigorous enclosures without a correctly rounded
+    // implementation of the standard library. Arithmetic operations are rounded as defined by  PolicyT .
+    //
+    // During constant evaluation, the bounds are padded by the larger of  UlpBoundsT  and the error bounds of the
+    // `constexpr` implementations (cf. <intervals/detail/math.hpp>).
+    //
+template <typename PolicyT, typename UlpBoundsT = libm_ulp_bounds>
+struct libm_error_padding : PolicyT
+{
+    using ulp_bounds = UlpBoundsT;
+};
+
+
+} // namespace intervals
+
+
+#endif // INCLUDED_INTERVALS_ROUNDING_HPP_
@@ -5,8 +5,11 @@
 
 #include <array>
 #include <iosfwd>
-#include <bitset>
+#include <cstddef>           // for size_t
+#include <cstdint>           // for uint64_t
 #include <utility>           // for pair<>
+#include <concepts>          // for default_initializable<>
+#include <type_traits>       // for is_empty<>, invoke_result<>
 #include <initializer_list>
 
 #include <gsl-lite/gsl-lite.hpp>  // for type_identity<>, ssize()
@@ -29,8 +32,11 @@ namespace gsl = gsl_lite;
     //
     // Set of discrete values over a bounded type.
     //
-    // TODO: we should somehow handle flag enums here; a set of a flag enum is essentially the flag enum itself, albeit with
-    // set-like assignment/comparison semantics.
+    // The set is stored as a bit mask in the smallest unsigned integer type with at least as many bits as there are values, so
+    // e.g. `sizeof(set<bool>) == 1`, and it is trivially copyable.
+    //
+    // Sets of flag enums are better represented with `flag_set<>` (cf. flag_set.hpp), which encloses the possible flag
+    // combinations with two bit masks.
 template <typename T, typename ReflectorT = makeshift::reflector>
 class set
 {
@@ -39,12 +45,19 @@ public:
 
     static constexpr std::array values = makeshift::metadata::values<T, ReflectorT>();
 
+        // Number of 64-bit words in the bit mask representation of the set; cf. `from_words()` and `to_words()`.
+    static constexpr gsl::dim num_words = gsl::dim(detail::set_word_count(values.size()));
+
 private:
+    template <typename> friend struct detail::set_value_iterator;
+
     static constexpr gsl::dim num_values = gsl::ssize(values);
 
-    std::bitset<num_values> state_;
+    using storage = detail::set_storage_t<num_values>;
 
-    explicit set(std::bitset<num_values> _state)
+    storage state_ = { };
+
+    constexpr explicit set(storage _state)
         : state_(_state)
     {
     }
@@ -52,21 +65,19 @@ private:
     constexpr static gsl::index
     find_value_index(T value)
     {
-        for (gsl::index i = 0; i != num_values; ++i)
+        std::size_t i = detail::set_value_index<values>::find(value);
+        if (i != std::size_t(num_values))
         {
-            if (values[i] == value)
-            {
-                return i;
-            }
+            return gsl::index(i);
         }
         gsl_FailFast();
     }
     constexpr static std::pair<bool, bool>
     compare_eq(set const& lhs, set const& rhs)
     {
-        bool anyMatch = (lhs.state_ & rhs.state_).any();
-        auto cl = lhs.state_.count();
-        auto cr = rhs.state_.count();
+        bool anyMatch = detail::set_any(storage(lhs.state_ & rhs.state_));
+        int cl = detail::set_count(lhs.state_);
+        int cr = detail::set_count(rhs.state_);
         bool anyPossibleMismatch = cl > 1 || cr > 1 || (cl == 1 && cr == 1 && !anyMatch);
         return { anyPossibleMismatch, anyMatch };
     }
@@ -77,19 +88,24 @@ public:
     }
     constexpr set(T value)
     {
-        state_.set(find_value_index(value));
+        detail::set_insert(state_, std::size_t(find_value_index(value)));
     }
     explicit constexpr set(std::initializer_list<T> _values)
     {
         for (T value : _values)
         {
-            state_.set(find_value_index(value));
+            detail::set_insert(state_, std::size_t(find_value_index(value)));
         }
     }
     static constexpr set
     from_bits(unsigned long long bits)
     {
-        return set(std::bitset<num_values>(bits));
+        return set(detail::set_from_words<num_values, storage>(std::array<std::uint64_t, num_words>{ bits }));
+    }
+    static constexpr set
+    from_words(std::array<std::uint64_t, num_words> const& words)
+    {
+        return set(detail::set_from_words<num_values, storage>(words));
     }
 
     constexpr set&
@@ -108,7 +124,7 @@ public:
     constexpr bool
     assigned() const
     {
-        return state_.any();
+        return detail::set_any(state_);
     }
 
     set(set const&) = default;
@@ -124,14 +140,25 @@ public:
     constexpr set&
     assign(T value)
     {
-        state_.set(find_value_index(value));
+        detail::set_insert(state_, std::size_t(find_value_index(value)));
         return *this;
     }
 
+        // Sets of more than 64 values can be converted with `to_bits()` only if they contain none of the values beyond the 64th.
     constexpr unsigned long long
     to_bits() const
     {
-        return state_.to_ullong();
+        auto words = to_words();
+        for (gsl::index i = 1; i != num_words; ++i)
+        {
+            gsl_Expects(words[i] == 0);
+        }
+        return words[0];
+    }
+    constexpr std::array<std::uint64_t, num_words>
+    to_words() const
+    {
+        return detail::set_to_words(state_);
     }
 
     [[nodiscard]] constexpr bool
@@ -139,17 +166,17 @@ public:
     {
         gsl_Expects(i >= 0 && i < num_values);
 
-        return state_.test(i);
+        return detail::set_test(state_, std::size_t(i));
     }
     [[nodiscard]] constexpr bool
     contains(T value) const
     {
-        return state_.test(find_value_index(value));
+        return detail::set_test(state_, std::size_t(find_value_index(value)));
     }
     [[nodiscard]] constexpr bool
     contains(set<T> const& _set) const
     {
-        return (state_ & _set.state_) == _set.state_;
+        return storage(state_ & _set.state_) == _set.state_;
     }
     [[nodiscard]] constexpr bool
     matches(T value) const
@@ -166,19 +193,9 @@ public:
     {
         gsl_ExpectsDebug(assigned());
 
-        auto lstate = state_;
-        for (gsl::index i = 0; i != num_values; ++i)
+        if (detail::set_count(state_) == 1)
         {
-            bool bit0 = lstate.test(0);
-            lstate >>= 1;
-            if (bit0)
-            {
-                if (!lstate.any())
-                {
-                    return values[i];
-                }
-                break;
-            }
+            return values[detail::set_next_index<num_values>(state_, 0)];
         }
         gsl_FailFast();
     }
@@ -461,6 +478,39 @@ reset(set<T, R>& lhs, gsl::type_identity_t<set<T, R>> const& rhs)
 }
 
 
+    //
+    // Image of sets under a function.
+    //
+    // `lift(f, x)` and `lift(f, x, y)` return the set of all values  f(a)  and  f(a, b)  for  a  in  x  and  b  in  y . The
+    // function object  f  must be stateless and usable in constant expressions, and its results must be reflected values. The
+    // images are tabulated at compile time: if the arguments have no more than 10 values altogether, there is a table entry for
+    // every combination of argument sets, and lifting costs a single table look-up.
+    //
+    //     auto s = lift([](sign x, sign y) { return x*y; }, set{ positive_sign, negative_sign }, set{ negative_sign });
+    //     // `set{ negative_sign, positive_sign }`
+    //
+template <typename F, typename A, typename RA>
+requires std::is_empty_v<F> && std::default_initializable<F>
+[[nodiscard]] constexpr set<std::invoke_result_t<F const&, A>>
+lift(F, set<A, RA> const& x)
+{
+    using R = set<std::invoke_result_t<F const&, A>>;
+    using Table = detail::set_lift_table_1<F, R::values, set<A, RA>::values>;
+
+    return R::from_words(Table::apply(x.to_words()));
+}
+template <typename F, typename A, typename RA, typename B, typename RB>
+requires std::is_empty_v<F> && std::default_initializable<F>
+[[nodiscard]] constexpr set<std::invoke_result_t<F const&, A, B>>
+lift(F, set<A, RA> const& x, set<B, RB> const& y)
+{
+    using R = set<std::invoke_result_t<F const&, A, B>>;
+    using Table = detail::set_lift_table_2<F, R::values, set<A, RA>::values, set<B, RB>::values>;
+
+    return R::from_words(Table::apply(x.to_words(), y.to_words()));
+}
+
+
 [[nodiscard]] constexpr set<sign>
 operator +(set<sign> x)
 {
@@ -469,44 +519,12 @@ operator +(set<sign> x)
 [[nodiscard]] constexpr set<sign>
 operator -(set<sign> x)
 {
-    set<sign> result;
-    if (x.contains(positive_sign))
-    {
-        result.assign(negative_sign);
-    }
-    if (x.contains(negative_sign))
-    {
-        result.assign(positive_sign);
-    }
-    if (x.contains(zero_sign))
-    {
-        result.assign(zero_sign);
-    }
-    return result;
+    return intervals::lift([](sign s) { return -s; }, x);
 }
 [[nodiscard]] constexpr set<sign>
 operator *(set<sign> lhs, set<sign> rhs)
 {
-    bool lp = lhs.contains(positive_sign);
-    bool lz = lhs.contains(zero_sign);
-    bool ln = lhs.contains(negative_sign);
-    bool rp = rhs.contains(positive_sign);
-    bool rz = rhs.contains(zero_sign);
-    bool rn = rhs.contains(negative_sign);
-    set<sign> result;
-    if ((lp && rn) || (ln && rp))
-    {
-        result.assign(negative_sign);
-    }
-    if ((lp && rp) || (ln && rn))
-    {
-        result.assign(positive_sign);
-    }
-    if (lz || rz)
-    {
-        result.assign(zero_sign);
-    }
-    return result;
+    return intervals::lift([](sign l, sign r) { return l*r; }, lhs, rhs);
 }
 [[nodiscard]] constexpr set<sign>
 operator *(set<sign> lhs, sign rhs)
@@ -0,0 +1,844 @@
+
+#ifndef INCLUDED_INTERVALS_SIMD_HPP_
+#define INCLUDED_INTERVALS_SIMD_HPP_
+
+
+#include <cmath>
+#include <array>
+#include <limits>
+#include <cstddef>   // for size_t
+#include <concepts>  // for floating_point<>, same_as<>
+#include <utility>   // for forward<>(), move()
+
+#include <gsl-lite/gsl-lite.hpp>  // for gsl_Expects(), gsl_ExpectsDebug(), gsl_ExpectsAudit(), gsl_Assert()
+
+#include <makeshift/type_traits.hpp>  // for dependent_false<>
+
+#include <intervals/set.hpp>
+#include <intervals/math.hpp>      // for min(), max()
+#include <intervals/logic.hpp>
+#include <intervals/rounding.hpp>  // for no_rounding
+#include <intervals/interval.hpp>
+
+#include <intervals/detail/simd.hpp>
+#include <intervals/detail/interval_array.hpp>
+
+
+namespace intervals {
+
+namespace gsl = gsl_lite;
+
+
+    //
+    // Mask of  N  Boolean lanes as returned by the comparison operators of `simd<>`.
+    //
+template <int N>
+class simd_mask
+{
+    static_assert(N > 0);
+
+    friend detail::simd_access;
+
+    std::array<bool, N> v_;
+
+public:
+    constexpr simd_mask() noexcept
+        : v_{ }
+    {
+    }
+    constexpr simd_mask(bool value) noexcept
+        : v_{ }
+    {
+        v_.fill(value);
+    }
+    explicit constexpr simd_mask(std::array<bool, N> const& values) noexcept
+        : v_(values)
+    {
+    }
+
+    [[nodiscard]] static constexpr int
+    size() noexcept
+    {
+        return N;
+    }
+
+    [[nodiscard]] constexpr bool
+    operator [](int i) const
+    {
+        gsl_ExpectsDebug(i >= 0 && i < N);
+
+        return v_[i];
+    }
+
+    [[nodiscard]] friend constexpr simd_mask
+    operator !(simd_mask const& x) noexcept
+    {
+        auto result = simd_mask{ };
+        for (int i = 0; i != N; ++i)
+        {
+            result.v_[i] = !x.v_[i];
+        }
+        return result;
+    }
+    [[nodiscard]] friend constexpr simd_mask
+    operator &(simd_mask const& x, simd_mask const& y) noexcept
+    {
+        auto result = simd_mask{ };
+        for (int i = 0; i != N; ++i)
+        {
+            result.v_[i] = x.v_[i] & y.v_[i];
+        }
+        return result;
+    }
+    [[nodiscard]] friend constexpr simd_mask
+    operator |(simd_mask const& x, simd_mask const& y) noexcept
+    {
+        auto result = simd_mask{ };
+        for (int i = 0; i != N; ++i)
+        {
+            result.v_[i] = x.v_[i] | y.v_[i];
+        }
+        return result;
+    }
+    [[nodiscard]] friend constexpr simd_mask
+    operator ^(simd_mask const& x, simd_mask const& y) noexcept
+    {
+        auto result = simd_mask{ };
+        for (int i = 0; i != N; ++i)
+        {
+            result.v_[i] = x.v_[i] ^ y.v_[i];
+        }
+        return result;
+    }
+
+    [[nodiscard]] friend constexpr bool operator ==(simd_mask const&, simd_mask const&) = default;
+};
+
+template <int N>
+[[nodiscard]] constexpr bool
+any_of(simd_mask<N> const& x) noexcept
+{
+    bool result = false;
+    for (int i = 0; i != N; ++i)
+    {
+        result |= x[i];
+    }
+    return result;
+}
+template <int N>
+[[nodiscard]] constexpr bool
+all_of(simd_mask<N> const& x) noexcept
+{
+    bool result = true;
+    for (int i = 0; i != N; ++i)
+    {
+        result &= x[i];
+    }
+    return result;
+}
+template <int N>
+[[nodiscard]] constexpr bool
+none_of(simd_mask<N> const& x) noexcept
+{
+    return !intervals::any_of(x);
+}
+
+
+    //
+    // Vector of  N  floating-point values which are processed in lockstep.
+    //
+    // `simd<>` is a minimal portable counterpart of `std::experimental::simd<>`: the lanes are stored in a suitably aligned
+    // array, and all operations are implemented as loops over the lanes which compilers can vectorize. The main purpose of
+    // `simd<>` is to serve as the value type of `interval<simd<T, N>>`.
+    //
+template <std::floating_point T, int N>
+class simd
+{
+    static_assert(N > 0);
+
+    friend detail::simd_access;
+
+    alignas(detail::simd_alignment<T, N>) std::array<T, N> v_;
+
+    template <typename F>
+    static constexpr simd
+    _generate(F f) noexcept
+    {
+        auto result = simd{ };
+        for (int i = 0; i != N; ++i)
+        {
+            result.v_[i] = f(i);
+        }
+        return result;
+    }
+    template <typename F>
+    static constexpr simd_mask<N>
+    _compare(F f) noexcept
+    {
+        auto result = simd_mask<N>{ };
+        for (int i = 0; i != N; ++i)
+        {
+            detail::simd_access::lanes(result)[i] = f(i);
+        }
+        return result;
+    }
+
+public:
+    using value_type = T;
+    using mask_type = simd_mask<N>;
+
+    constexpr simd() noexcept
+        : v_{ }
+    {
+    }
+    constexpr simd(T value) noexcept
+        : v_{ }
+    {
+        v_.fill(value);
+    }
+    explicit constexpr simd(std::array<T, N> const& values) noexcept
+        : v_(values)
+    {
+    }
+
+    [[nodiscard]] static constexpr int
+    size() noexcept
+    {
+        return N;
+    }
+
+    [[nodiscard]] constexpr T
+    operator [](int i) const
+    {
+        gsl_ExpectsDebug(i >= 0 && i < N);
+
+        return v_[i];
+    }
+    [[nodiscard]] constexpr T&
+    operator [](int i)
+    {
+        gsl_ExpectsDebug(i >= 0 && i < N);
+
+        return v_[i];
+    }
+
+    [[nodiscard]] friend constexpr simd
+    operator +(simd const& x) noexcept
+    {
+        return x;
+    }
+    [[nodiscard]] friend constexpr simd
+    operator -(simd const& x) noexcept
+    {
+        return _generate([&](int i) { return -x.v_[i]; });
+    }
+    [[nodiscard]] friend constexpr simd
+    operator +(simd const& x, simd const& y) noexcept
+    {
+        return _generate([&](int i) { return x.v_[i] + y.v_[i]; });
+    }
+    [[nodiscard]] friend constexpr simd
+    operator -(simd const& x, simd const& y) noexcept
+    {
+        return _generate([&](int i) { return x.v_[i] - y.v_[i]; });
+    }
+    [[nodiscard]] friend constexpr simd
+    operator *(simd const& x, simd const& y) noexcept
+    {
+        return _generate([&](int i) { return x.v_[i]*y.v_[i]; });
+    }
+    [[nodiscard]] friend constexpr simd
+    operator /(simd const& x, simd const& y) noexcept
+    {
+        return _generate([&](int i) { return x.v_[i]/y.v_[i]; });
+    }
+
+    [[nodiscard]] friend constexpr simd_mask<N>
+    operator ==(simd const& x, simd const& y) noexcept
+    {
+        return _compare([&](int i) { return x.v_[i] == y.v_[i]; });
+    }
+    [[nodiscard]] friend constexpr simd_mask<N>
+    operator !=(simd const& x, simd const& y) noexcept
+    {
+        return _compare([&](int i) { return x.v_[i] != y.v_[i]; });
+    }
+    [[nodiscard]] friend constexpr simd_mask<N>
+    operator <(simd const& x, simd const& y) noexcept
+    {
+        return _compare([&](int i) { return x.v_[i] < y.v_[i]; });
+    }
+    [[nodiscard]] friend constexpr simd_mask<N>
+    operator <=(simd const& x, simd const& y) noexcept
+    {
+        return _compare([&](int i) { return x.v_[i] <= y.v_[i]; });
+    }
+    [[nodiscard]] friend constexpr simd_mask<N>
+    operator >(simd const& x, simd const& y) noexcept
+    {
+        return _compare([&](int i) { return x.v_[i] > y.v_[i]; });
+    }
+    [[nodiscard]] friend constexpr simd_mask<N>
+    operator >=(simd const& x, simd const& y) noexcept
+    {
+        return _compare([&](int i) { return x.v_[i] >= y.v_[i]; });
+    }
+
+    [[nodiscard]] friend constexpr simd
+    min(simd const& x, simd const& y) noexcept
+    {
+        return _generate([&](int i) { return intervals::min(x.v_[i], y.v_[i]); });
+    }
+    [[nodiscard]] friend constexpr simd
+    max(simd const& x, simd const& y) noexcept
+    {
+        return _generate([&](int i) { return intervals::max(x.v_[i], y.v_[i]); });
+    }
+    [[nodiscard]] friend constexpr simd
+    abs(simd const& x) noexcept
+    {
+        return _generate([&](int i) { return x.v_[i] < 0 ? -x.v_[i] : x.v_[i]; });
+    }
+    [[nodiscard]] friend simd
+    sqrt(simd const& x) noexcept
+    {
+        return _generate([&](int i) { return std::sqrt(x.v_[i]); });
+    }
+
+        // Lane-wise selection.
+    [[nodiscard]] friend constexpr simd
+    if_else(simd_mask<N> const& cond, simd const& resultIfTrue, simd const& resultIfFalse) noexcept
+    {
+        return _generate([&](int i) { return cond[i] ? resultIfTrue.v_[i] : resultIfFalse.v_[i]; });
+    }
+};
+
+
+    //
+    // `set<bool>` for each of  N  lanes, as returned by the comparison operators of `interval<simd<T, N>>`.
+    //
+    // The logical operators `!`, `&`, `|` are applied lane-wise. The functions `possibly()`, `possibly_not()`, `always()`, and
+    // `never()` reduce over all lanes: `possibly(c)` holds if  c  may be true in any lane, `always(c)` holds if  c  is
+    // true in every lane. Lanes whose set is empty, e.g. because they are unassigned, are ignored. Use `operator []` to obtain
+    // the `set<bool>` of a single lane.
+    //
+template <int N>
+class simd_bool_set
+{
+    simd_mask<N> true_;   // lanes which may be true
+    simd_mask<N> false_;  // lanes which may be false
+
+public:
+    constexpr simd_bool_set() noexcept
+        : true_(false), false_(false)
+    {
+    }
+    constexpr simd_bool_set(bool value) noexcept
+        : true_(value), false_(!value)
+    {
+    }
+    constexpr simd_bool_set(set<bool> value) noexcept
+        : true_(value.contains(true)), false_(value.contains(false))
+    {
+    }
+    constexpr simd_bool_set(simd_mask<N> const& value) noexcept
+        : true_(value), false_(!value)
+    {
+    }
+    explicit constexpr simd_bool_set(simd_mask<N> const& mayBeTrue, simd_mask<N> const& mayBeFalse) noexcept
+        : true_(mayBeTrue), false_(mayBeFalse)
+    {
+    }
+
+    [[nodiscard]] static constexpr int
+    size() noexcept
+    {
+        return N;
+    }
+
+        // Mask of the lanes whose set contains the given value.
+    [[nodiscard]] constexpr simd_mask<N>
+    contains(bool value) const noexcept
+    {
+        return value ? true_ : false_;
+    }
+        // Mask of the lanes whose set is not empty.
+    [[nodiscard]] constexpr simd_mask<N>
+    assigned() const noexcept
+    {
+        return true_ | false_;
+    }
+
+    [[nodiscard]] constexpr set<bool>
+    operator [](int i) const
+    {
+        gsl_ExpectsDebug(i >= 0 && i < N);
+
+        auto result = set<bool>{ };
+        if (true_[i])
+        {
+            result.assign(true);
+        }
+        if (false_[i])
+        {
+            result.assign(false);
+        }
+        return result;
+    }
+
+    [[nodiscard]] friend constexpr simd_bool_set
+    operator !(simd_bool_set const& x) noexcept
+    {
+        return simd_bool_set(x.false_, x.true_);
+    }
+    [[nodiscard]] friend constexpr simd_bool_set
+    operator &(simd_bool_set const& x, simd_bool_set const& y) noexcept
+    {
+        auto nonempty = x.assigned() & y.assigned();
+        return simd_bool_set(x.true_ & y.true_, (x.false_ | y.false_) & nonempty);
+    }
+    [[nodiscard]] friend constexpr simd_bool_set
+    operator |(simd_bool_set const& x, simd_bool_set const& y) noexcept
+    {
+        auto nonempty = x.assigned() & y.assigned();
+        return simd_bool_set((x.true_ | y.true_) & nonempty, x.false_ & y.false_);
+    }
+
+    [[nodiscard]] friend constexpr bool operator ==(simd_bool_set const&, simd_bool_set const&) = default;
+};
+
+    // As for `set<bool>`, use operators `&` and `|` instead of short-circuiting Boolean operators.
+template <int N> simd_bool_set<N> operator &&(simd_bool_set<N> const&, simd_bool_set<N> const&) = delete;
+template <int N> simd_bool_set<N> operator ||(simd_bool_set<N> const&, simd_bool_set<N> const&) = delete;
+
+
+    //
+    // Interval of SIMD vectors:  N  floating-point intervals which are processed in lockstep.
+    //
+    // `interval<simd<T, N>>` lets interval-aware generic code such as `max3()` in the README run on  N  inputs at once. The
+    // lower and upper bounds of the lanes are stored in two `simd<T, N>` vectors. Arithmetic operations and elementary
+    // functions are applied lane-wise with the branch-free kernels of `interval_array<>` (cf. detail/interval_array.hpp), so
+    // their results are identical to (or, for the elementary functions, within a few ulp of) the results of `interval<T>`.
+    //
+    // Comparisons return a `simd_bool_set<N>` with a `set<bool>` for every lane, and branch conditions are reduced over all
+    // lanes. `constrain(x, c)` narrows the lanes of  x  in which  c  may hold and marks all other lanes as unassigned.
+    // Because arithmetic operations propagate unassigned lanes and `assign_partial()` ignores them, code guarded by
+    // `possibly(c)` is executed for all lanes but affects only the lanes in which  c  may be true. This requires that all
+    // values assigned in such code be derived from intervals constrained by  c , as in `max3()`; unconstrained values need
+    // to be selected with `if_else()` instead.
+    //
+    // Only the rounding policy `no_rounding` is supported.
+    //
+template <std::floating_point T, int N, typename PolicyT>
+class interval<simd<T, N>, PolicyT>
+{
+    static_assert(std::same_as<PolicyT, no_rounding>, "interval<simd<>> supports only the rounding policy 'no_rounding'");
+
+    friend detail::simd_access;
+
+    static constexpr T inf_ = std::numeric_limits<T>::infinity();
+
+    simd<T, N> lower_;
+    simd<T, N> upper_;
+
+public:
+    using value_type = simd<T, N>;
+    using policy_type = PolicyT;
+    using interval_type = interval;
+    using lane_type = interval<T, PolicyT>;
+
+    constexpr interval() noexcept
+        : lower_(inf_), upper_(-inf_)
+    {
+    }
+    constexpr interval(T value) noexcept
+        : lower_(value), upper_(value)
+    {
+    }
+    constexpr interval(simd<T, N> const& value) noexcept
+        : lower_(value), upper_(value)
+    {
+    }
+    explicit constexpr interval(simd<T, N> const& _lower, simd<T, N> const& _upper)
+        : lower_(_lower), upper_(_upper)
+    {
+        gsl_Expects(intervals::none_of(_lower > _upper));  // does not trigger for NaNs
+    }
+        // Broadcasts the given interval to all lanes.
+    constexpr interval(lane_type const& rhs) noexcept
+        : lower_(rhs.lower_unchecked()), upper_(rhs.upper_unchecked())
+    {
+    }
+        // Constructs an interval from the intervals of its lanes.
+    explicit constexpr interval(std::array<lane_type, N> const& lanes) noexcept
+    {
+        for (int i = 0; i != N; ++i)
+        {
+            lower_[i] = lanes[i].lower_unchecked();
+            upper_[i] = lanes[i].upper_unchecked();
+        }
+    }
+
+    interval(interval const&) = default;
+    interval& operator =(interval const&) = delete;
+
+    [[nodiscard]] static constexpr int
+    size() noexcept
+    {
+        return N;
+    }
+
+        // Mask of the assigned lanes.
+    [[nodiscard]] constexpr simd_mask<N>
+    assigned_lanes() const noexcept
+    {
+        return !(lower_ > upper_);
+    }
+        // Whether all lanes are assigned.
+    [[nodiscard]] constexpr bool
+    assigned() const noexcept
+    {
+        return intervals::all_of(assigned_lanes());
+    }
+
+    [[nodiscard]] constexpr simd<T, N> const&
+    lower_unchecked() const noexcept
+    {
+        return lower_;
+    }
+    [[nodiscard]] constexpr simd<T, N> const&
+    upper_unchecked() const noexcept
+    {
+        return upper_;
+    }
+    [[nodiscard]] constexpr simd<T, N> const&
+    lower() const
+    {
+        gsl_ExpectsDebug(assigned());
+
+        return lower_;
+    }
+    [[nodiscard]] constexpr simd<T, N> const&
+    upper() const
+    {
+        gsl_ExpectsDebug(assigned());
+
+        return upper_;
+    }
+
+        // The interval of the  i -th lane.
+    [[nodiscard]] constexpr lane_type
+    operator [](int i) const
+    {
+        gsl_ExpectsDebug(i >= 0 && i < N);
+
+        return lower_[i] > upper_[i]
+            ? lane_type{ }
+            : lane_type{ lower_[i], upper_[i] };
+    }
+
+    [[nodiscard]] constexpr bool
+    matches(interval const& rhs) const noexcept
+    {
+        return intervals::all_of((lower_ == rhs.lower_) & (upper_ == rhs.upper_));
+    }
+
+    constexpr interval&
+    reset() noexcept
+    {
+        lower_ = simd<T, N>(inf_);
+        upper_ = simd<T, N>(-inf_);
+        return *this;
+    }
+    constexpr interval&
+    reset(interval const& rhs) noexcept
+    {
+        lower_ = rhs.lower_;
+        upper_ = rhs.upper_;
+        return *this;
+    }
+        // Widens every lane such that it contains the corresponding lane of  rhs . Unassigned lanes of  rhs  are ignored.
+    constexpr interval&
+    assign(interval const& rhs) noexcept
+    {
+        lower_ = min(lower_, rhs.lower_);
+        upper_ = max(upper_, rhs.upper_);
+        return *this;
+    }
+
+    [[nodiscard]] friend constexpr interval
+    operator +(interval const& x) noexcept
+    {
+        return x;
+    }
+    [[nodiscard]] friend interval
+    operator -(interval const& x)
+    {
+        return detail::simd_access::apply(detail::negate_bounds, x);
+    }
+
+    template <typename X, typename Y>
+    requires detail::simd_interval_operands<X, Y, T, N, PolicyT>
+    [[nodiscard]] friend interval
+    operator +(X const& x, Y const& y)
+    {
+        return detail::simd_access::apply<T, N, PolicyT>(detail::add_bounds, x, y);
+    }
+    template <typename X, typename Y>
+    requires detail::simd_interval_operands<X, Y, T, N, PolicyT>
+    [[nodiscard]] friend interval
+    operator -(X const& x, Y const& y)
+    {
+        return detail::simd_access::apply<T, N, PolicyT>(detail::subtract_bounds, x, y);
+    }
+    template <typename X, typename Y>
+    requires detail::simd_interval_operands<X, Y, T, N, PolicyT>
+    [[nodiscard]] friend interval
+    operator *(X const& x, Y const& y)
+    {
+        return detail::simd_access::apply<T, N, PolicyT>(detail::multiply_bounds, x, y);
+    }
+    template <typename X, typename Y>
+    requires detail::simd_interval_operands<X, Y, T, N, PolicyT>
+    [[nodiscard]] friend interval
+    operator /(X const& x, Y const& y)
+    {
+        return detail::simd_access::apply<T, N, PolicyT>(detail::divide_bounds, x, y);
+    }
+
+    template <typename L, typename R>
+    requires detail::simd_interval_operands<std::remove_cvref_t<L>, std::remove_cvref_t<R>, T, N, PolicyT>
+    [[nodiscard]] friend auto
+    operator ==(L&& lhs, R&& rhs)
+    {
+        auto l = detail::simd_access::comparison_operand<T, N>(std::forward<L>(lhs));
+        auto r = detail::simd_access::comparison_operand<T, N>(std::forward<R>(rhs));
+        return detail::simd_equal_constraint<T, N>{ { detail::simd_access::compare_eq(l, r) }, l, r };
+    }
+    template <typename L, typename R>
+    requires detail::simd_interval_operands<std::remove_cvref_t<L>, std::remove_cvref_t<R>, T, N, PolicyT>
+    [[nodiscard]] friend auto
+    operator !=(L&& lhs, R&& rhs)
+    {
+        auto l = detail::simd_access::comparison_operand<T, N>(std::forward<L>(lhs));
+        auto r = detail::simd_access::comparison_operand<T, N>(std::forward<R>(rhs));
+        return detail::simd_not_equal_constraint<T, N>{ { detail::simd_access::compare_neq(l, r) }, l, r };
+    }
+    template <typename L, typename R>
+    requires detail::simd_interval_operands<std::remove_cvref_t<L>, std::remove_cvref_t<R>, T, N, PolicyT>
+    [[nodiscard]] friend auto
+    operator <(L&& lhs, R&& rhs)
+    {
+        auto l = detail::simd_access::comparison_operand<T, N>(std::forward<L>(lhs));
+        auto r = detail::simd_access::comparison_operand<T, N>(std::forward<R>(rhs));
+        return detail::simd_less_constraint<T, N>{ { detail::simd_access::compare_lt(l, r) }, l, r };
+    }
+    template <typename L, typename R>
+    requires detail::simd_interval_operands<std::remove_cvref_t<L>, std::remove_cvref_t<R>, T, N, PolicyT>
+    [[nodiscard]] friend auto
+    operator <=(L&& lhs, R&& rhs)
+    {
+        auto l = detail::simd_access::comparison_operand<T, N>(std::forward<L>(lhs));
+        auto r = detail::simd_access::comparison_operand<T, N>(std::forward<R>(rhs));
+        return detail::simd_less_equal_constraint<T, N>{ { detail::simd_access::compare_leq(l, r) }, l, r };
+    }
+    template <typename L, typename R>
+    requires detail::simd_interval_operands<std::remove_cvref_t<L>, std::remove_cvref_t<R>, T, N, PolicyT>
+    [[nodiscard]] friend auto
+    operator >(L&& lhs, R&& rhs)
+    {
+        auto l = detail::simd_access::comparison_operand<T, N>(std::forward<L>(lhs));
+        auto r = detail::simd_access::comparison_operand<T, N>(std::forward<R>(rhs));
+        return detail::simd_less_constraint<T, N>{ { detail::simd_access::compare_lt(r, l) }, r, l };
+    }
+    template <typename L, typename R>
+    requires detail::simd_interval_operands<std::remove_cvref_t<L>, std::remove_cvref_t<R>, T, N, PolicyT>
+    [[nodiscard]] friend auto
+    operator >=(L&& lhs, R&& rhs)
+    {
+        auto l = detail::simd_access::comparison_operand<T, N>(std::forward<L>(lhs));
+        auto r = detail::simd_access::comparison_operand<T, N>(std::forward<R>(rhs));
+        return detail::simd_less_equal_constraint<T, N>{ { detail::simd_access::compare_leq(r, l) }, r, l };
+    }
+};
+template <std::floating_point T, int N>
+interval(simd<T, N>) -> interval<simd<T, N>>;
+template <std::floating_point T, int N>
+interval(simd<T, N>, simd<T, N>) -> interval<simd<T, N>>;
+
+
+inline namespace logic {
+
+
+template <int N>
+[[nodiscard]] constexpr bool
+possibly(simd_bool_set<N> const& x) noexcept
+{
+    return intervals::any_of(x.contains(true));
+}
+template <int N>
+[[nodiscard]] constexpr bool
+possibly_not(simd_bool_set<N> const& x) noexcept
+{
+    return intervals::any_of(x.contains(false));
+}
+template <int N>
+[[nodiscard]] constexpr bool
+always(simd_bool_set<N> const& x) noexcept
+{
+    return intervals::none_of(x.contains(false));
+}
+template <int N>
+[[nodiscard]] constexpr bool
+never(simd_bool_set<N> const& x) noexcept
+{
+    return intervals::none_of(x.contains(true));
+}
+    // Whether  x  may be true in some lanes and false in some lanes, i.e. whether both branches of a conditional need to be
+    // executed.
+template <int N>
+[[nodiscard]] constexpr bool
+contingent(simd_bool_set<N> const& x) noexcept
+{
+    return logic::possibly(x) && logic::possibly_not(x);
+}
+    // Whether the sets of all lanes are empty.
+template <int N>
+[[nodiscard]] constexpr bool
+vacuous(simd_bool_set<N> const& x) noexcept
+{
+    return intervals::none_of(x.assigned());
+}
+
+
+} // inline namespace logic
+
+
+inline namespace math {
+
+
+template <std::floating_point T, int N, typename PolicyT>
+constexpr interval<simd<T, N>, PolicyT> const&
+constrain(interval<simd<T, N>, PolicyT> const& x, simd_bool_set<N> const&)
+{
+    static_assert(makeshift::dependent_false<PolicyT>, "conditional expression does not constrain given interval");
+    return x;
+}
+template <std::floating_point T, int N, typename PolicyT, std::derived_from<detail::simd_condition<N>> ConditionT>
+[[nodiscard]] interval<simd<T, N>, PolicyT>
+constrain(interval<simd<T, N>, PolicyT> const& x, ConditionT const& c)
+{
+    bool isLhs = c.lhs_.id_ == &x;
+    bool isRhs = c.rhs_.id_ == &x;
+    gsl_Assert((isLhs || isRhs) && "conditional expression does not constrain given interval");
+    return detail::simd_access::constrain(x, c, isLhs, isRhs);
+}
+template <std::floating_point T, int N, typename PolicyT, std::derived_from<detail::simd_condition<N>> ConditionT>
+interval<simd<T, N>, PolicyT> const&&
+constrain(interval<simd<T, N>, PolicyT> const&& x, ConditionT const&)
+{
+    static_assert(makeshift::dependent_false<PolicyT>, "rvalue interval cannot be constrained");
+    return std::move(x);
+}
+
+    // Masked selection: every lane of the result is the union of the lanes of  resultIfTrue  and  resultIfFalse  for which
+    // cond  may be true and false, respectively.
+template <std::floating_point T, int N, typename PolicyT>
+[[nodiscard]] interval<simd<T, N>, PolicyT>
+if_else(simd_bool_set<N> const& cond, interval<simd<T, N>, PolicyT> const& resultIfTrue, interval<simd<T, N>, PolicyT> const& resultIfFalse)
+{
+    auto result = interval<simd<T, N>, PolicyT>{ };
+    result.assign(detail::simd_access::masked(resultIfTrue, cond.contains(true)));
+    result.assign(detail::simd_access::masked(resultIfFalse, cond.contains(false)));
+    return result;
+}
+
+template <std::floating_point T, int N, typename PolicyT, typename Y>
+requires detail::simd_interval_operand<Y, T, N, PolicyT>
+[[nodiscard]] interval<simd<T, N>, PolicyT>
+min(interval<simd<T, N>, PolicyT> const& x, Y const& y)
+{
+    return detail::simd_access::apply<T, N, PolicyT>(detail::min_bounds, x, y);
+}
+template <typename X, std::floating_point T, int N, typename PolicyT>
+requires detail::simd_interval_operand<X, T, N, PolicyT> && (!std::same_as<X, interval<simd<T, N>, PolicyT>>)
+[[nodiscard]] interval<simd<T, N>, PolicyT>
+min(X const& x, interval<simd<T, N>, PolicyT> const& y)
+{
+    return detail::simd_access::apply<T, N, PolicyT>(detail::min_bounds, x, y);
+}
+template <std::floating_point T, int N, typename PolicyT, typename Y>
+requires detail::simd_interval_operand<Y, T, N, PolicyT>
+[[nodiscard]] interval<simd<T, N>, PolicyT>
+max(interval<simd<T, N>, PolicyT> const& x, Y const& y)
+{
+    return detail::simd_access::apply<T, N, PolicyT>(detail::max_bounds, x, y);
+}
+template <typename X, std::floating_point T, int N, typename PolicyT>
+requires detail::simd_interval_operand<X, T, N, PolicyT> && (!std::same_as<X, interval<simd<T, N>, PolicyT>>)
+[[nodiscard]] interval<simd<T, N>, PolicyT>
+max(X const& x, interval<simd<T, N>, PolicyT> const& y)
+{
+    return detail::simd_access::apply<T, N, PolicyT>(detail::max_bounds, x, y);
+}
+
+template <std::floating_point T, int N, typename PolicyT>
+[[nodiscard]] interval<simd<T, N>, PolicyT>
+square(interval<simd<T, N>, PolicyT> const& x)
+{
+    return detail::simd_access::apply(detail::square_bounds, x);
+}
+template <std::floating_point T, int N, typename PolicyT>
+[[nodiscard]] interval<simd<T, N>, PolicyT>
+abs(interval<simd<T, N>, PolicyT> const& x)
+{
+    return detail::simd_access::apply(detail::abs_bounds, x);
+}
+template <std::floating_point T, int N, typename PolicyT>
+[[nodiscard]] interval<simd<T, N>, PolicyT>
+sqrt(interval<simd<T, N>, PolicyT> const& x)
+{
+    gsl_ExpectsAudit(intervals::none_of(x.assigned_lanes() & (x.lower_unchecked() < simd<T, N>(0))));
+
+    return detail::simd_access::apply(detail::sqrt_bounds, x);
+}
+template <std::floating_point T, int N, typename PolicyT>
+[[nodiscard]] interval<simd<T, N>, PolicyT>
+exp(interval<simd<T, N>, PolicyT> const& x)
+{
+    return detail::simd_access::apply(detail::exp_bounds, x);
+}
+template <std::floating_point T, int N, typename PolicyT>
+[[nodiscard]] interval<simd<T, N>, PolicyT>
+log(interval<simd<T, N>, PolicyT> const& x)
+{
+    gsl_ExpectsAudit(intervals::none_of(x.assigned_lanes() & (x.lower_unchecked() < simd<T, N>(0))));
+
+    return detail::simd_access::apply(detail::log_bounds, x);
+}
+template <std::floating_point T, int N, typename PolicyT>
+[[nodiscard]] interval<simd<T, N>, PolicyT>
+sin(interval<simd<T, N>, PolicyT> const& x)
+{
+    return detail::simd_access::apply(detail::sin_bounds, x);
+}
+template <std::floating_point T, int N, typename PolicyT>
+[[nodiscard]] interval<simd<T, N>, PolicyT>
+cos(interval<simd<T, N>, PolicyT> const& x)
+{
+    return detail::simd_access::apply(detail::cos_bounds, x);
+}
+template <std::floating_point T, int N, typename PolicyT>
+[[nodiscard]] interval<simd<T, N>, PolicyT>
+atan(interval<simd<T, N>, PolicyT> const& x)
+{
+    return detail::simd_access::apply(detail::atan_bounds, x);
+}
+
+
+} // inline namespace math
+
+} // namespace intervals
+
+
+#endif // INCLUDED_INTERVALS_SIMD_HPP_
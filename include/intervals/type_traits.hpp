@@ -15,6 +15,10 @@ namespace intervals {
 
 template <typename T, typename ReflectorT>
 class set;
+template <typename E>
+class flag_set;
+template <int Min, int Max>
+class int_set;
 
 
 template <any_interval T>
@@ -23,7 +27,10 @@ using interval_value_t = typename std::remove_cvref_t<T>::value_type;
 template <interval_arg T> struct interval_arg_value : detail::interval_arg_value_0_<std::remove_cvref_t<T>> { };
 template <interval_arg T> using interval_arg_value_t = typename interval_arg_value<T>::type;
 
-template <interval_arg T> using interval_of_t = interval<interval_arg_value_t<T>>;
+template <interval_arg T> struct interval_arg_policy : detail::default_interval_policy_<typename detail::interval_arg_policy_0_<std::remove_cvref_t<T>>::type> { };
+template <interval_arg T> using interval_arg_policy_t = typename interval_arg_policy<T>::type;
+
+template <interval_arg T> using interval_of_t = interval<interval_arg_value_t<T>, interval_arg_policy_t<T>>;
 template <interval_arg T>
 struct interval_of
 {
@@ -32,13 +39,20 @@ struct interval_of
 
 template <any_interval T> using interval_t = typename std::remove_cvref_t<T>::interval_type;
 
+template <any_interval T> using interval_policy_t = typename interval_t<T>::policy_type;
+
 template <interval_arg... Ts>
 struct common_interval_value : std::common_type<interval_arg_value_t<Ts>...> { };
 template <interval_arg... Ts>
 using common_interval_value_t = typename common_interval_value<Ts...>::type;
 
 template <interval_arg... Ts>
-using common_interval_t = interval<common_interval_value_t<Ts...>>;
+struct common_interval_policy : detail::default_interval_policy_<typename detail::common_interval_policy_0_<typename detail::interval_arg_policy_0_<std::remove_cvref_t<Ts>>::type...>::type> { };
+template <interval_arg... Ts>
+using common_interval_policy_t = typename common_interval_policy<Ts...>::type;
+
+template <interval_arg... Ts>
+using common_interval_t = interval<common_interval_value_t<Ts...>, common_interval_policy_t<Ts...>>;
 template <interval_arg... Ts>
 struct common_interval
 {
@@ -53,7 +67,9 @@ template <std::floating_point T, typename ReflectorT> struct set_of<T, Reflector
 template <std::integral T, typename ReflectorT> struct set_of<T, ReflectorT> { using type = interval<T>; };
 template <std::random_access_iterator T, typename ReflectorT> struct set_of<T, ReflectorT> { using type = interval<T>; };
 template <typename T, typename ReflectorT> struct set_of<set<T, ReflectorT>> { using type = set<T, ReflectorT>; };
-template <any_interval IntervalT, typename ReflectorT> struct set_of<IntervalT, ReflectorT> { using type = interval<typename IntervalT::value_type>; };
+template <typename E, typename ReflectorT> struct set_of<flag_set<E>, ReflectorT> { using type = flag_set<E>; };
+template <int Min, int Max, typename ReflectorT> struct set_of<int_set<Min, Max>, ReflectorT> { using type = int_set<Min, Max>; };
+template <any_interval IntervalT, typename ReflectorT> struct set_of<IntervalT, ReflectorT> { using type = interval_of_t<IntervalT>; };
 template <typename T, typename ReflectorT = makeshift::reflector> using set_of_t = typename set_of<T>::type;
 
 template <typename S, typename T, typename ReflectorT = makeshift::reflector> struct propagate_set { using type = T; };
@@ -1,8 +1,14 @@
 
+#include <cmath>
 #include <limits>
+#include <span>
 #include <vector>
+#include <numeric>
+#include <algorithm>
+#include <bit>
 #include <ranges>
 #include <numbers>
+#include <concepts>
 #include <iterator>
 
 #include <gsl-lite/gsl-lite.hpp>  // for fail_fast, type_identity<>
@@ -15,6 +21,9 @@
 #include <intervals/interval.hpp>
 #include <intervals/algorithm.hpp>
 
+#include "test-enums.hpp"     // for Wide
+#include "test-fixtures.hpp"  // for max3()
+
 
 namespace {
 
@@ -28,6 +37,14 @@ reflect(gsl::type_identity<Color>)
     return std::array{ red, green, blue };
 }
 
+template <typename X, typename Y0, typename Y1>
+auto
+interpolate_linear(X x, Y0 y0, Y1 y1)
+{
+    using namespace intervals::math;  // for min(), max()
+    return y0 + (y1 - y0)*max(X(0), min(x, X(1)));
+}
+
 static_assert(std::input_iterator<intervals::detail::single_value_iterator<int>>);
 static_assert(std::input_iterator<intervals::detail::set_value_iterator<bool>>);
 static_assert(std::input_iterator<intervals::detail::set_value_iterator<Color>>);
@@ -78,6 +95,21 @@ TEST_CASE("enumerate()")
         CHECK_THAT(to_vector(enumerate(set{ red })), Catch::Matchers::Equals(std::vector{ red }));
         CHECK_THAT(to_vector(enumerate(set{ blue })), Catch::Matchers::Equals(std::vector{ blue }));
         CHECK_THAT(to_vector(enumerate(set{ green, blue })), Catch::Matchers::Equals(std::vector{ green, blue }));
+        CHECK_THAT(to_vector(enumerate(set{ red, blue })), Catch::Matchers::Equals(std::vector{ red, blue }));
+        CHECK_THAT(to_vector(enumerate(set{ red, green, blue })), Catch::Matchers::Equals(std::vector{ red, green, blue }));
+    }
+    SECTION("set<Wide>")
+    {
+        CHECK_THROWS_AS(enumerate(set<Wide>{ }), gsl::fail_fast);
+        CHECK_THAT(to_vector(enumerate(set{ Wide(69) })), Catch::Matchers::Equals(std::vector{ Wide(69) }));
+        CHECK_THAT(to_vector(enumerate(set{ Wide(0), Wide(63), Wide(64), Wide(69) })),
+            Catch::Matchers::Equals(std::vector{ Wide(0), Wide(63), Wide(64), Wide(69) }));
+        auto all = set<Wide>{ };
+        for (Wide w : set<Wide>::values)
+        {
+            all.assign(w);
+        }
+        CHECK(to_vector(enumerate(all)).size() == 70);
     }
     SECTION("interval<int>")
     {
@@ -127,5 +159,139 @@ TEST_CASE("at()")
     }
 }
 
+TEST_CASE("partition_point()")
+{
+    using intervals::set;
+    using intervals::interval;
+
+    auto numbers = std::vector<int>(100);
+    std::iota(numbers.begin(), numbers.end(), 0);
+
+    int n = GENERATE(0, 1, 2, 7, 64, 100);
+    int lo = GENERATE(-1, 0, 13, 50, 99, 100);
+    int hi = GENERATE(-1, 0, 13, 50, 99, 100);
+    if (lo > hi) return;
+    auto range = std::span(numbers).first(n);
+
+        // Predicate is `true` for  x < lo , contingent for  x ∈ [lo, hi) , and `false` for  x ≥ hi .
+    int calls = 0;
+    auto predicate = [lo, hi, &calls](int x)
+    {
+        ++calls;
+        return x < lo ? set{ true }
+            : x < hi ? set{ false, true }
+            : set{ false };
+    };
+    auto [_, pos] = intervals::partition_point(range, predicate);
+    CAPTURE(n, lo, hi);
+    CHECK(pos.lower_unchecked() == range.begin() + std::clamp(lo, 0, n));
+    CHECK(pos.upper_unchecked() == range.begin() + std::clamp(hi, 0, n));
+
+        // Both partition points are found with no more predicate evaluations than a binary search over the range takes for
+        // each of them.
+    int log2n = std::bit_width(unsigned(n));
+    CHECK(calls <= 2*log2n);
+    if (lo == hi)
+    {
+        CHECK(calls <= log2n);
+    }
+}
+
+TEST_CASE("scalar_fast_path()")
+{
+    using intervals::set;
+    using intervals::interval;
+    using intervals::scalar_fast_path;
+
+    int scalar_calls = 0;
+    auto max3_fast = scalar_fast_path([&scalar_calls](auto a, auto b)
+    {
+        scalar_calls += std::floating_point<decltype(a)>;
+        return max3(a, b);
+    });
+    auto interpolate_fast = scalar_fast_path([&scalar_calls](auto x, auto y0, auto y1)
+    {
+        scalar_calls += std::floating_point<decltype(x)>;
+        return interpolate_linear(x, y0, y1);
+    });
+
+    SECTION("degenerate arguments")
+    {
+        auto x = max3_fast(interval{ 2. }, interval{ 3. });
+        static_assert(std::same_as<decltype(x), interval<double>>);
+        CHECK(x.matches(interval{ 3. }));
+        CHECK(interpolate_fast(interval{ 0.25 }, interval{ 1. }, 5.).matches(interval{ 2. }));
+        CHECK(scalar_calls == 2);
+    }
+    SECTION("non-degenerate arguments")
+    {
+        CHECK(max3_fast(interval{ 0., 3. }, interval{ 1., 2. }).matches(interval{ 1., 3. }));
+        CHECK(interpolate_fast(interval{ 0.25, 0.5 }, interval{ 1. }, 5.).matches(interval{ 2., 3. }));
+        CHECK(max3_fast(interval{ 2. }, interval{ 1., 2. }).matches(interval{ 2. }));
+        CHECK(scalar_calls == 0);
+    }
+    SECTION("scalar arguments")
+    {
+        CHECK(max3_fast(2., 3.) == 3.);
+        CHECK(scalar_calls == 1);
+    }
+    SECTION("sets")
+    {
+        auto select = scalar_fast_path([&scalar_calls](auto color, auto x)
+        {
+            using namespace intervals::logic;  // for possibly()
+            scalar_calls += std::same_as<decltype(color), Color>;
+            auto result = decltype(x){ };
+            if (possibly(color == red))
+            {
+                intervals::assign_partial(result, -x);
+            }
+            if (possibly(color != red))
+            {
+                intervals::assign_partial(result, x);
+            }
+            return result;
+        });
+        CHECK(select(set{ red }, interval{ 1. }).matches(interval{ -1. }));
+        CHECK(scalar_calls == 1);
+        CHECK(select(set{ red, blue }, interval{ 1. }).matches(interval{ -1., 1. }));
+        CHECK(scalar_calls == 1);
+    }
+    SECTION("rounding policies")
+    {
+        using J = interval<double, intervals::error_free_rounding>;
+        using K = interval<double, intervals::libm_error_padding<intervals::error_free_rounding>>;
+        using L = interval<double, intervals::finite_only>;
+
+        auto mul_fast = scalar_fast_path([&scalar_calls](auto a, auto b)
+        {
+            scalar_calls += std::floating_point<decltype(a)>;
+            return a*b;
+        });
+        auto exp_fast = scalar_fast_path([&scalar_calls](auto x)
+        {
+            scalar_calls += std::floating_point<decltype(x)>;
+            return intervals::exp(x);
+        });
+
+            // Degenerate intervals with outward rounding are not passed as scalars, so the result still encloses the exact
+            // product  0.1⋅0.1 , which is not representable.
+        auto p = mul_fast(J{ 0.1 }, J{ 0.1 });
+        double p0 = 0.1*0.1;
+        double r = std::fma(0.1, 0.1, -p0);  // 0.1⋅0.1 = p0 + r
+        CHECK(p.lower() < p.upper());
+        CHECK((r >= 0 ? p.upper() > p0 : p.lower() < p0));
+        CHECK(p.lower() <= p0);
+        CHECK(p.upper() >= p0);
+        auto e = exp_fast(K{ 1. });
+        CHECK(e.matches(intervals::exp(K{ 1. })));
+        CHECK(e.lower() < e.upper());
+        CHECK(scalar_calls == 0);
+
+        CHECK(max3_fast(L{ 2. }, L{ 3. }).matches(L{ 3. }));
+        CHECK(scalar_calls == 1);
+    }
+}
+
 
 } // anonymous namespace
@@ -0,0 +1,219 @@
+
+#include <bit>      // for popcount()
+#include <random>
+#include <vector>
+#include <cstdint>  // for uint64_t
+
+#include <gsl-lite/gsl-lite.hpp>  // for index, dim
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <intervals/set.hpp>
+#include <intervals/bool_set_array.hpp>
+
+
+namespace {
+
+namespace gsl = ::gsl_lite;
+
+
+    // All four states of `set<bool>`: unassigned, `false`, `true`, and both.
+intervals::set<bool>
+state(unsigned bits)
+{
+    return intervals::set<bool>::from_bits(bits);
+}
+
+    // Negation of a `set<bool>` which also accepts the unassigned state.
+intervals::set<bool>
+negate(intervals::set<bool> x)
+{
+    return x.assigned() ? !x : x;
+}
+
+intervals::bool_set_array
+random_array(gsl::dim n, std::mt19937& rng)
+{
+    auto dist = std::uniform_int_distribution<unsigned>{ 0, 3 };
+    auto values = std::vector<intervals::set<bool>>{ };
+    for (gsl::index i = 0; i != n; ++i)
+    {
+        values.push_back(state(dist(rng)));
+    }
+    return intervals::bool_set_array(values);
+}
+
+
+TEST_CASE("bool_set_array", "packed set-valued logic")
+{
+    using namespace intervals;
+
+    auto rng = std::mt19937{ 42 };
+
+    SECTION("construction and element access")
+    {
+        auto xs = bool_set_array{ set{ false }, set{ true }, set{ false, true }, set<bool>{ } };
+        REQUIRE(xs.size() == 4);
+        CHECK(xs[0].matches(false));
+        CHECK(xs[1].matches(true));
+        CHECK(xs[2].matches(set{ false, true }));
+        CHECK_FALSE(xs[3].assigned());
+
+        xs.assign(0, true);
+        CHECK(xs[0].matches(set{ false, true }));
+        xs.reset(1, false);
+        CHECK(xs[1].matches(false));
+        xs.reset(2);
+        CHECK_FALSE(xs[2].assigned());
+
+        auto ys = bool_set_array(130, set{ false, true });
+        REQUIRE(ys.size() == 130);
+        REQUIRE(ys.false_bits().size() == 3);
+        CHECK(ys[129].matches(set{ false, true }));
+        CHECK(ys.true_bits()[2] == 0b11u);
+
+            // Bits beyond the size are cleared when shrinking and are unassigned when growing again.
+        ys.resize(65);
+        ys.resize(130);
+        CHECK(ys[64].matches(set{ false, true }));
+        CHECK_FALSE(ys[65].assigned());
+        CHECK_FALSE(ys[129].assigned());
+
+        auto zs = bool_set_array(70);
+        CHECK_FALSE(zs[69].assigned());
+    }
+    SECTION("logical operators")
+    {
+        for (gsl::dim n : { 1, 63, 64, 65, 200 })
+        {
+            auto xs = random_array(n, rng);
+            auto ys = random_array(n, rng);
+            auto nots = !xs;
+            auto ands = xs & ys;
+            auto ors = xs | ys;
+            auto xors = xs ^ ys;
+            for (gsl::index i = 0; i != n; ++i)
+            {
+                CHECK(nots[i].matches(negate(xs[i])));
+                CHECK(ands[i].matches(xs[i] & ys[i]));
+                CHECK(ors[i].matches(xs[i] | ys[i]));
+                CHECK(xors[i].matches(xs[i] ^ ys[i]));
+            }
+
+                // Broadcast operands.
+            for (unsigned bits = 0; bits != 4; ++bits)
+            {
+                auto y = state(bits);
+                auto andsl = xs & y;
+                auto andsr = y & xs;
+                auto orsl = xs | y;
+                auto xorsl = xs ^ y;
+                for (gsl::index i = 0; i != n; ++i)
+                {
+                    CHECK(andsl[i].matches(xs[i] & y));
+                    CHECK(andsr[i].matches(y & xs[i]));
+                    CHECK(orsl[i].matches(xs[i] | y));
+                    CHECK(xorsl[i].matches(xs[i] ^ y));
+                }
+            }
+            auto orsb = xs | true;
+            auto andsb = false & xs;
+            for (gsl::index i = 0; i != n; ++i)
+            {
+                CHECK(orsb[i].matches(xs[i] | true));
+                CHECK(andsb[i].matches(false & xs[i]));
+            }
+
+                // The unused bits of the last word must remain cleared.
+            auto numTrue = gsl::index(0);
+            auto numBits = 0;
+            for (gsl::index i = 0; i != n; ++i)
+            {
+                numTrue += nots[i].contains(true) ? 1 : 0;
+            }
+            for (std::uint64_t w : nots.true_bits())
+            {
+                numBits += std::popcount(w);
+            }
+            CHECK(numBits == numTrue);
+        }
+    }
+    SECTION("predicates")
+    {
+        for (gsl::dim n : { 1, 64, 100 })
+        {
+            auto xs = random_array(n, rng);
+            auto ps = possibly(xs);
+            auto pns = possibly_not(xs);
+            auto as = always(xs);
+            auto ns = never(xs);
+            auto cs = contingent(xs);
+            auto vs = vacuous(xs);
+            for (gsl::index i = 0; i != n; ++i)
+            {
+                CHECK(ps[i].matches(possibly(xs[i])));
+                CHECK(pns[i].matches(possibly_not(xs[i])));
+                CHECK(as[i].matches(always(xs[i])));
+                CHECK(ns[i].matches(never(xs[i])));
+                CHECK(cs[i].matches(contingent(xs[i])));
+                CHECK(vs[i].matches(vacuous(xs[i])));
+            }
+        }
+    }
+    SECTION("reductions")
+    {
+        auto kleene_any = [](bool_set_array const& xs)
+        {
+            auto result = set{ false };
+            for (gsl::index i = 0; i != xs.size(); ++i)
+            {
+                result.reset(result | xs[i]);
+            }
+            return result;
+        };
+        auto kleene_all = [](bool_set_array const& xs)
+        {
+            auto result = set{ true };
+            for (gsl::index i = 0; i != xs.size(); ++i)
+            {
+                result.reset(result & xs[i]);
+            }
+            return result;
+        };
+
+        CHECK(any_of(bool_set_array{ }).matches(false));
+        CHECK(all_of(bool_set_array{ }).matches(true));
+
+        for (gsl::dim n : { 1, 2, 63, 64, 65, 300 })
+        {
+            for (unsigned bits = 1; bits != 4; ++bits)
+            {
+                auto xs = bool_set_array(n, state(bits));
+                CHECK(any_of(xs).matches(kleene_any(xs)));
+                CHECK(all_of(xs).matches(kleene_all(xs)));
+
+                    // A single deviating element, possibly in the last word.
+                for (unsigned other = 0; other != 4; ++other)
+                {
+                    for (gsl::index i : { gsl::index(0), n - 1 })
+                    {
+                        auto ys = bool_set_array(n, state(bits));
+                        ys.reset(i, state(other));
+                        CHECK(any_of(ys).matches(kleene_any(ys)));
+                        CHECK(all_of(ys).matches(kleene_all(ys)));
+                    }
+                }
+            }
+        }
+
+        auto xs = bool_set_array(1000, false);
+        CHECK(never(any_of(contingent(xs))));
+        xs.reset(777, set{ false, true });
+        CHECK(always(any_of(contingent(xs))));
+        CHECK(contingent(any_of(xs)));
+        CHECK(always(!all_of(xs)));
+    }
+}
+
+
+}  // anonymous namespace
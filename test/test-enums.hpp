@@ -0,0 +1,32 @@
+
+#ifndef INCLUDED_INTERVALS_TEST_ENUMS_HPP_
+#define INCLUDED_INTERVALS_TEST_ENUMS_HPP_
+
+
+#include <array>
+#include <cstdint>  // for uint8_t
+
+#include <gsl-lite/gsl-lite.hpp>  // for type_identity<>
+
+
+namespace {
+
+
+    // Enumeration with more values than fit into a 64-bit word.
+enum class Wide : std::uint8_t { };
+consteval auto
+reflect(gsl_lite::type_identity<Wide>)
+{
+    auto result = std::array<Wide, 70>{ };
+    for (int i = 0; i != 70; ++i)
+    {
+        result[i] = Wide(i);
+    }
+    return result;
+}
+
+
+} // anonymous namespace
+
+
+#endif // INCLUDED_INTERVALS_TEST_ENUMS_HPP_
@@ -0,0 +1,92 @@
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <concepts>  // for same_as<>
+
+#include <gsl-lite/gsl-lite.hpp>  // for fail_fast
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <intervals/interval.hpp>
+#include <intervals/rounding.hpp>
+#include <intervals/expression.hpp>
+
+#include "test-fixtures.hpp"  // for bounds, same_bounds()
+
+
+namespace {
+
+namespace gsl = ::gsl_lite;
+
+
+TEST_CASE("lazy()", "interval arithmetic")
+{
+    using intervals::interval;
+    using intervals::lazy;
+    using intervals::evaluate;
+
+    SECTION("operators")
+    {
+            // Check all pairs of intervals from the `bounds` table, including special values and divisors containing 0.
+        for (auto [a, b] : bounds)
+        {
+            auto x = interval{ a, b };
+            CAPTURE(x);
+            CHECK(same_bounds(evaluate(-lazy(x)), -x));
+            for (auto [c, d] : bounds)
+            {
+                auto y = interval{ c, d };
+                CAPTURE(y);
+                CHECK(same_bounds(evaluate(lazy(x) + y), x + y));
+                CHECK(same_bounds(evaluate(lazy(x) - y), x - y));
+                CHECK(same_bounds(evaluate(lazy(x)*y), x*y));
+                CHECK(same_bounds(evaluate(lazy(x)/y), x/y));
+                CHECK(same_bounds(evaluate(2.*lazy(x) - y/lazy(x)), 2.*x - y/x));
+            }
+        }
+    }
+    SECTION("compound expressions")
+    {
+        auto rng = std::mt19937_64{ 42 };
+        auto dist = std::uniform_real_distribution<double>{ -4., 4. };
+        auto random_interval = [&]
+        {
+            return interval<double>::from_unordered_bounds(dist(rng), dist(rng));
+        };
+        for (int i = 0; i != 1000; ++i)
+        {
+            auto x = random_interval();
+            auto x0 = dist(rng);
+            auto x1 = x0 + 1.;
+            auto y0 = random_interval();
+            auto y1 = random_interval();
+            CAPTURE(x, x0, y0, y1);
+            CHECK(same_bounds(evaluate(y0 + (lazy(x) - x0)/(x1 - x0)*(y1 - y0)), y0 + (x - x0)/(x1 - x0)*(y1 - y0)));
+            CHECK(same_bounds(evaluate((lazy(x) - y0)*(lazy(x) + y1)/(y1 - 5.)), (x - y0)*(x + y1)/(y1 - 5.)));
+        }
+
+            // Overflow of an intermediate result is handled by the interval operators.
+        constexpr double max = std::numeric_limits<double>::max();
+        auto x = interval{ max };
+        CHECK(same_bounds(evaluate(1./(lazy(x)*x)), 1./(x*x)));
+        CHECK(same_bounds(evaluate(lazy(x)*x - lazy(x)*x), x*x - x*x));
+    }
+    SECTION("result type")
+    {
+        using I = interval<double, intervals::error_free_rounding>;
+        auto x = I{ 0.1, 0.2 };
+        auto e = lazy(x)*3. + 1;
+        static_assert(std::same_as<decltype(evaluate(e)), I>);
+        CHECK(evaluate(e).matches(x*3. + 1));
+        static_assert(std::same_as<decltype(evaluate(lazy(interval{ 1.f })*2.)), interval<double>>);
+    }
+    SECTION("assignedness")
+    {
+        auto x = interval<double>{ };
+        CHECK_THROWS_AS(evaluate(lazy(x) + 1.), gsl::fail_fast);
+    }
+}
+
+
+} // anonymous namespace
@@ -0,0 +1,82 @@
+
+#ifndef INCLUDED_INTERVALS_TEST_FIXTURES_HPP_
+#define INCLUDED_INTERVALS_TEST_FIXTURES_HPP_
+
+
+#include <array>
+#include <limits>
+
+#include <intervals/set.hpp>
+#include <intervals/interval.hpp>
+
+
+namespace {
+
+
+constexpr double inf = std::numeric_limits<double>::infinity();
+constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+
+    // Bounds of intervals with special values, signed zeros, and divisors containing 0, for exhaustive tests of operations
+    // on all pairs of intervals.
+constexpr std::array<std::array<double, 2>, 19> bounds = {{
+    { -inf,   -inf },
+    { -inf,   -1.  },
+    { -inf,   -0.  },
+    { -inf,    1.  },
+    { -inf,    inf },
+    { -1.5,   -1.5 },
+    { -1.5,   -0.1 },
+    { -1.5,   -0.  },
+    { -1.5,    1.  },
+    { -1.5,    inf },
+    {  0.,     0.  },
+    {  0.,     1.  },
+    {  0.,     inf },
+    {  0.1,    0.1 },
+    {  0.1,    2.  },
+    {  0.1,    inf },
+    {  inf,    inf },
+    {  nan,    nan },
+    { -2.,     3.  }
+}};
+
+    // Whether two intervals have the same bounds, where NaN bounds are considered equal.
+template <typename PolicyT>
+bool
+same_bounds(intervals::interval<double, PolicyT> const& lhs, intervals::interval<double, PolicyT> const& rhs)
+{
+    auto same = [](double a, double b)
+    {
+        return (a != a && b != b) || a == b;
+    };
+    return lhs.assigned() == rhs.assigned()
+        && (!lhs.assigned() || (same(lhs.lower_unchecked(), rhs.lower_unchecked()) && same(lhs.upper_unchecked(), rhs.upper_unchecked())));
+}
+
+    // The generic function from the README.
+template <typename T>
+T
+max3(T a, T b)
+{
+    using namespace intervals::math;   // for constrain(), assign_partial()
+    using namespace intervals::logic;  // for possibly()
+    auto x = T{ };
+    auto c = (a < b);
+    if (possibly(c))
+    {
+        auto bc = constrain(b, c);
+        assign_partial(x, bc);
+    }
+    if (possibly(!c))
+    {
+        auto ac = constrain(a, !c);
+        assign_partial(x, ac);
+    }
+    return x;
+}
+
+
+} // anonymous namespace
+
+
+#endif // INCLUDED_INTERVALS_TEST_FIXTURES_HPP_
@@ -0,0 +1,159 @@
+
+#include <vector>
+#include <cstdint>  // for uint8_t
+#include <type_traits>
+
+#include <gsl-lite/gsl-lite.hpp>  // for fail_fast
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <intervals/set.hpp>
+#include <intervals/flag_set.hpp>
+
+
+namespace {
+
+namespace gsl = ::gsl_lite;
+
+
+enum class Permissions : std::uint8_t
+{
+    none    = 0,
+    read    = 1,
+    write   = 2,
+    execute = 4,
+    admin   = 8
+};
+constexpr Permissions
+operator |(Permissions lhs, Permissions rhs)
+{
+    return Permissions(unsigned(lhs) | unsigned(rhs));
+}
+
+
+    // All values enclosed by a flag set with the given masks.
+std::vector<Permissions>
+values_of(unsigned must, unsigned may)
+{
+    auto result = std::vector<Permissions>{ };
+    for (unsigned v = 0; v != 16; ++v)
+    {
+        if ((must & ~v) == 0 && (v & ~may) == 0)
+        {
+            result.push_back(Permissions(v));
+        }
+    }
+    return result;
+}
+
+    // All non-empty flag sets over the four flags.
+std::vector<std::pair<unsigned, unsigned>>
+all_masks()
+{
+    auto result = std::vector<std::pair<unsigned, unsigned>>{ };
+    for (unsigned may = 0; may != 16; ++may)
+    {
+        for (unsigned must = 0; must != 16; ++must)
+        {
+            if ((must & ~may) == 0)
+            {
+                result.emplace_back(must, may);
+            }
+        }
+    }
+    return result;
+}
+
+
+TEST_CASE("flag_set<>", "set of flag enum values")
+{
+    using intervals::set;
+    using intervals::flag_set;
+    using enum Permissions;
+
+    static_assert(sizeof(flag_set<Permissions>) == 2);
+    static_assert(std::is_trivially_copyable_v<flag_set<Permissions>>);
+
+    SECTION("construction and assignment")
+    {
+        auto s0 = flag_set<Permissions>{ };
+        CHECK_FALSE(s0.assigned());
+        CHECK_FALSE(s0.contains(none));
+        CHECK_FALSE(s0.contains(read));
+
+        auto s1 = flag_set{ read | write };
+        CHECK(s1.assigned());
+        CHECK(s1.value() == (read | write));
+        CHECK(s1.contains(read | write));
+        CHECK_FALSE(s1.contains(read));
+
+        auto s2 = flag_set{ read, read | write, read | execute };
+        CHECK(s2.must() == read);
+        CHECK(s2.may() == (read | write | execute));
+        CHECK(s2.contains(read | write | execute));
+        CHECK_FALSE(s2.contains(write));
+        CHECK(s2.contains(s1));
+        CHECK_FALSE(s1.contains(s2));
+        CHECK_THROWS_AS(s2.value(), gsl::fail_fast);
+
+        s1.assign(admin);
+        CHECK(s1.matches(flag_set<Permissions>::from_masks(none, read | write | admin)));
+        s1.reset(read);
+        CHECK(s1.value() == read);
+        s1.reset();
+        CHECK_FALSE(s1.assigned());
+        CHECK(s1.matches(s0));
+
+        CHECK_THROWS_AS(flag_set<Permissions>::from_masks(read, write), gsl::fail_fast);
+    }
+    SECTION("operators")
+    {
+        auto masks = all_masks();
+        for (auto [lmust, lmay] : masks)
+        {
+            auto lhs = flag_set<Permissions>::from_masks(Permissions(lmust), Permissions(lmay));
+            auto lvalues = values_of(lmust, lmay);
+            for (auto [rmust, rmay] : masks)
+            {
+                auto rhs = flag_set<Permissions>::from_masks(Permissions(rmust), Permissions(rmay));
+                auto rvalues = values_of(rmust, rmay);
+
+                auto ands = flag_set<Permissions>{ };
+                auto ors = flag_set<Permissions>{ };
+                auto xors = lhs ^ rhs;
+                auto eqs = set<bool>{ };
+                for (Permissions l : lvalues)
+                {
+                    for (Permissions r : rvalues)
+                    {
+                        ands.assign(Permissions(unsigned(l) & unsigned(r)));
+                        ors.assign(Permissions(unsigned(l) | unsigned(r)));
+                        CHECK(xors.contains(Permissions(unsigned(l) ^ unsigned(r))));
+                        eqs.assign(l == r);
+                    }
+                }
+
+                    // `&`, `|`, `==`, and `!=` are exact.
+                CHECK((lhs & rhs).matches(ands));
+                CHECK((lhs | rhs).matches(ors));
+                CHECK((lhs == rhs).matches(eqs));
+                CHECK((lhs != rhs).matches(!eqs));
+            }
+        }
+    }
+    SECTION("flag tests")
+    {
+        auto perms = flag_set{ read, read | write };
+        CHECK(((perms & read) == read).matches(true));
+        CHECK(((perms & write) == write).matches(set{ false, true }));
+        CHECK(((perms & execute) == execute).matches(false));
+        CHECK(((perms | admin) & admin).value() == admin);
+        CHECK((perms ^ read).matches(flag_set{ none, write }));
+
+        auto p = intervals::if_else(set{ false, true }, flag_set{ admin }, read);
+        CHECK(p.matches(flag_set{ admin, read }));
+    }
+}
+
+
+}  // anonymous namespace
@@ -0,0 +1,214 @@
+
+#include <limits>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <algorithm>  // for min(), max()
+#include <type_traits>
+
+#include <gsl-lite/gsl-lite.hpp>  // for fail_fast
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_vector.hpp>
+
+#include <intervals/set.hpp>
+#include <intervals/int_set.hpp>
+#include <intervals/interval.hpp>
+#include <intervals/algorithm.hpp>
+
+
+namespace {
+
+namespace gsl = ::gsl_lite;
+
+
+template <typename R>
+std::vector<int>
+to_vector(R&& range)
+{
+    auto result = std::vector<int>{ };
+    for (int value : range)
+    {
+        result.push_back(value);
+    }
+    return result;
+}
+
+    // Random sparse subset of  [Min, Max] .
+template <int Min, int Max>
+intervals::int_set<Min, Max>
+sparse_set(unsigned seed)
+{
+    auto result = intervals::int_set<Min, Max>{ };
+    for (int v = Min; v <= Max; ++v)
+    {
+        seed = seed*1103515245u + 12345u;
+        if ((seed >> 16) % 7 == 0)
+        {
+            result.assign(v);
+        }
+    }
+    if (!result.assigned())
+    {
+        result.assign(Min);
+    }
+    return result;
+}
+
+
+TEST_CASE("int_set<>", "sparse set of bounded integers")
+{
+    using namespace intervals;
+
+    static_assert(sizeof(int_set<0, 63>) == 8);
+    static_assert(sizeof(int_set<-10, 199>) == 32);
+    static_assert(std::is_trivially_copyable_v<int_set<0, 63>>);
+
+    SECTION("construction and element access")
+    {
+        auto s0 = int_set<0, 99>{ };
+        CHECK_FALSE(s0.assigned());
+        CHECK_THROWS_AS(enumerate(s0), gsl::fail_fast);
+
+        auto s = int_set<0, 99>{ 1, 7, 63, 64, 99 };
+        CHECK(s.count() == 5);
+        CHECK(s.lower() == 1);
+        CHECK(s.upper() == 99);
+        CHECK(s.contains(63));
+        CHECK_FALSE(s.contains(62));
+        CHECK_FALSE(s.contains(-1));
+        CHECK_FALSE(s.contains(100));
+        CHECK_THROWS_AS(s.value(), gsl::fail_fast);
+        CHECK(int_set<0, 99>{ 64 }.value() == 64);
+        CHECK_THAT(to_vector(enumerate(s)), Catch::Matchers::Equals(std::vector{ 1, 7, 63, 64, 99 }));
+        CHECK(s.hull().lower() == 1);
+        CHECK(s.hull().upper() == 99);
+
+        CHECK_THROWS_AS((int_set<0, 99>{ 100 }), gsl::fail_fast);
+
+        auto r = int_set<-5, 80>(interval{ -2, 70 });
+        CHECK(r.count() == 73);
+        CHECK(r.lower() == -2);
+        CHECK(r.upper() == 70);
+        CHECK(r.contains(int_set<-5, 80>{ -2, 0, 63, 64, 70 }));
+        CHECK_FALSE(r.contains(int_set<-5, 80>{ -3 }));
+
+        r.reset(3);
+        r.assign(int_set<-5, 80>{ -5, 80 });
+        CHECK_THAT(to_vector(enumerate(r)), Catch::Matchers::Equals(std::vector{ -5, 3, 80 }));
+    }
+    SECTION("arithmetic")
+    {
+        auto s = int_set<-10, 150>{ -3, 0, 1, 60, 63, 64 };
+        CHECK_THAT(to_vector(enumerate(s + 5)), Catch::Matchers::Equals(std::vector{ 2, 5, 6, 65, 68, 69 }));
+        CHECK_THAT(to_vector(enumerate(s + 70)), Catch::Matchers::Equals(std::vector{ 67, 70, 71, 130, 133, 134 }));
+        CHECK_THAT(to_vector(enumerate(s - 7)), Catch::Matchers::Equals(std::vector{ -10, -7, -6, 53, 56, 57 }));
+        CHECK_THROWS_AS(s + 100, gsl::fail_fast);
+        CHECK_THROWS_AS(s - 8, gsl::fail_fast);
+        CHECK_THAT(to_vector(enumerate(s*2)), Catch::Matchers::Equals(std::vector{ -6, 0, 2, 120, 126, 128 }));
+        CHECK_THROWS_AS(-1*s, gsl::fail_fast);
+        CHECK_THROWS_AS(s*3, gsl::fail_fast);
+
+        auto ns = -s;
+        static_assert(std::is_same_v<decltype(ns), int_set<-150, 10>>);
+        CHECK_THAT(to_vector(enumerate(ns)), Catch::Matchers::Equals(std::vector{ -64, -63, -60, -1, 0, 3 }));
+
+            // Sums of sets are checked against all pairs of elements.
+        for (unsigned seed = 0; seed != 20; ++seed)
+        {
+            auto x = sparse_set<-20, 70>(seed);
+            auto y = sparse_set<3, 140>(seed + 100);
+            auto sum = x + y;
+            static_assert(std::is_same_v<decltype(sum), int_set<-17, 210>>);
+            auto expected = int_set<-17, 210>{ };
+            for (int a : enumerate(x))
+            {
+                for (int b : enumerate(y))
+                {
+                    expected.assign(a + b);
+                }
+            }
+            CHECK(sum.matches(expected));
+        }
+    }
+    SECTION("min() and max()")
+    {
+        for (unsigned seed = 0; seed != 20; ++seed)
+        {
+            auto x = sparse_set<-30, 100>(seed);
+            auto y = sparse_set<-30, 100>(seed + 50);
+            auto expectedMin = int_set<-30, 100>{ };
+            auto expectedMax = int_set<-30, 100>{ };
+            for (int a : enumerate(x))
+            {
+                for (int b : enumerate(y))
+                {
+                    expectedMin.assign(std::min(a, b));
+                    expectedMax.assign(std::max(a, b));
+                }
+            }
+            CHECK(intervals::min(x, y).matches(expectedMin));
+            CHECK(intervals::max(x, y).matches(expectedMax));
+        }
+        auto s = int_set<0, 99>{ 1, 7, 63 };
+        CHECK(intervals::min(s, 10).matches(int_set<0, 99>{ 1, 7, 10 }));
+        CHECK(intervals::max(5, s).matches(int_set<0, 99>{ 5, 7, 63 }));
+        CHECK(intervals::min(200, s).matches(s));
+        CHECK(intervals::min(s, 0).matches(int_set<0, 99>{ 0 }));
+        CHECK(intervals::max(s, -50).matches(s));
+        CHECK(intervals::max(int_set<0, 99>{ 1 }, 1).matches(int_set<0, 99>{ 1 }));
+        CHECK_THROWS_AS(intervals::min(s, -1), gsl::fail_fast);
+        CHECK_THROWS_AS(intervals::max(200, s), gsl::fail_fast);
+    }
+    SECTION("comparisons")
+    {
+        auto s = int_set<0, 99>{ 1, 7, 63 };
+        CHECK((s == 7).matches(set{ false, true }));
+        CHECK((s == 8).matches(false));
+        CHECK((int_set<0, 99>{ 7 } == 7).matches(true));
+        CHECK((s != 8).matches(true));
+        CHECK((s == int_set<0, 99>{ 2, 63 }).matches(set{ false, true }));
+        CHECK((s == int_set<0, 99>{ 2, 64 }).matches(false));
+        CHECK((s < 1).matches(false));
+        CHECK((s < 2).matches(set{ false, true }));
+        CHECK((s < 64).matches(true));
+        CHECK((s <= 63).matches(true));
+        CHECK((0 < s).matches(true));
+        CHECK((s > 63).matches(false));
+        CHECK((s >= 1).matches(true));
+        CHECK((s < int_set<50, 200>{ 70, 80 }).matches(true));
+        CHECK((s < int_set<50, 200>{ 60, 80 }).matches(set{ false, true }));
+        CHECK((s >= int_set<-10, 0>{ -1, 0 }).matches(true));
+    }
+    SECTION("output")
+    {
+        auto str = [](auto const& x)
+        {
+            auto stream = std::ostringstream{ };
+            stream << x;
+            return stream.str();
+        };
+        CHECK(str(int_set<0, 99>{ }) == "{  }");
+        CHECK(str(int_set<-10, 199>{ -10, 7, 64, 199 }) == "{ -10, 7, 64, 199 }");
+        constexpr int intMax = std::numeric_limits<int>::max();
+        CHECK(str(int_set<intMax - 3, intMax>{ intMax - 1, intMax }) == "{ " + std::to_string(intMax - 1) + ", " + std::to_string(intMax) + " }");
+    }
+    SECTION("interoperation")
+    {
+        auto table = std::vector<double>(100);
+        for (int i = 0; i != 100; ++i)
+        {
+            table[i] = 0.5*i;
+        }
+        auto v = at(table, int_set<0, 99>{ 1, 7, 63 });
+        CHECK(v.lower() == 0.5);
+        CHECK(v.upper() == 31.5);
+
+        auto c = set{ false, true };
+        auto r = if_else(c, int_set<0, 9>{ 1 }, int_set<0, 9>{ 8 });
+        CHECK(r.matches(int_set<0, 9>{ 1, 8 }));
+    }
+}
+
+
+}  // anonymous namespace
@@ -393,6 +393,26 @@ TEST_CASE("interval<>", "interval arithmetic")
                 }
             }
         }
+        SECTION("fma()")
+        {
+            auto w = interval{ -1., 0.5 };
+            auto z = fma(x, y, w);
+            CAPTURE(z);
+            if (!possibly(intervals::isinf(x) | intervals::isinf(y)))
+            {
+                CHECK(z.lower() == std::min({ std::fma(a, c, -1.), std::fma(a, d, -1.), std::fma(b, c, -1.), std::fma(b, d, -1.) }));
+                CHECK(z.upper() == std::max({ std::fma(a, c, 0.5), std::fma(a, d, 0.5), std::fma(b, c, 0.5), std::fma(b, d, 0.5) }));
+                CHECK(fma(x, c, 0.5).matches(interval{ std::min(std::fma(a, c, 0.5), std::fma(b, c, 0.5)), std::max(std::fma(a, c, 0.5), std::fma(b, c, 0.5)) }));
+                CHECK(fma(a, c, w).matches(interval{ std::fma(a, c, -1.), std::fma(a, c, 0.5) }));
+            }
+            else
+            {
+                    // Infinite bounds are handled by the operators.
+                auto zr = x*y + w;
+                CHECK(((z.lower() == zr.lower()) || (std::isnan(z.lower()) && std::isnan(zr.lower()))));
+                CHECK(((z.upper() == zr.upper()) || (std::isnan(z.upper()) && std::isnan(zr.upper()))));
+            }
+        }
     }
     SECTION("pow()")
     {
@@ -535,6 +555,72 @@ TEST_CASE("interval<>", "interval arithmetic")
             }
         }
     }
+    SECTION("pown()")
+    {
+        auto check_bound = [](double actual, double expected)
+        {
+            if (std::isinf(expected))
+            {
+                CHECK(actual == expected);
+            }
+            else
+            {
+                CHECK(actual == Catch::Approx(expected));
+            }
+        };
+
+        auto xs = std::array{ -2.3, -2., -1., -0.7, 0., 0.4, 1., 1.4, 2.3 };
+        for (gsl::index i = 0; i < gsl::ssize(xs); ++i)
+        {
+            auto a = xs[i];
+            for (gsl::index j = i; j < gsl::ssize(xs); ++j)
+            {
+                auto b = xs[j];
+                auto x = interval{ a, b };
+                CAPTURE(x);
+                for (int n = -4; n <= 5; ++n)
+                {
+                    CAPTURE(n);
+                    auto z = pown(x, n);
+                    CAPTURE(z);
+                    auto v1 = std::pow(a, n);
+                    auto v2 = std::pow(b, n);
+                    bool even = n % 2 == 0;
+                    if (0 < a || b < 0 || (a == 0 && b == 0) || n >= 0)
+                    {
+                        check_bound(z.lower(), even && n > 0 && x.contains(0.) ? 0. : std::min(v1, v2));
+                        check_bound(z.upper(), std::max(v1, v2));
+                    }
+                    else if (a == 0)  // 1/[0,b]ᵏ
+                    {
+                        check_bound(z.lower(), v2);
+                        CHECK(z.upper() == inf);
+                    }
+                    else if (b == 0)  // 1/[a,0]ᵏ
+                    {
+                        check_bound(z.lower(), even ? v1 : -inf);
+                        check_bound(z.upper(), even ? inf : v1);
+                    }
+                    else  // 1/[a,b]ᵏ  with  a < 0 < b
+                    {
+                        check_bound(z.lower(), even ? std::min(v1, v2) : -inf);
+                        CHECK(z.upper() == inf);
+                    }
+                }
+                CHECK(pow<3>(x).matches(pown(x, 3)));
+                CHECK(pow<-2>(x).matches(pown(x, -2)));
+            }
+        }
+
+        CHECK(pown(interval{ -2, 3 }, 3).matches(interval{ -8, 27 }));
+        CHECK(pown(interval{ -2, 3 }, 2).matches(interval{ 0, 9 }));
+        CHECK(pown(interval{ -3, -2 }, 0).matches(1));
+        CHECK(pow<4>(interval{ -3, -2 }).matches(interval{ 16, 81 }));
+        CHECK(intervals::pown(2., -2) == 0.25);
+        CHECK(intervals::pown(-3, 3) == -27);
+        CHECK(intervals::pow<3>(2) == 8);
+        CHECK_THROWS_AS(pown(interval{ 1, 2 }, -1), gsl::fail_fast);
+    }
     SECTION("trigonometric functions")
     {
         using std::numbers::pi;
@@ -570,6 +656,9 @@ TEST_CASE("interval<>", "interval arithmetic")
                     CAPTURE(cos_x);
                     CHECK(cos_x.lower() == Catch::Approx(cos_values.front()).margin(1.e-8));
                     CHECK(cos_x.upper() == Catch::Approx(cos_values.back()).margin(1.e-8));
+                    auto [sin_x2, cos_x2] = sincos(x);
+                    CHECK(sin_x2.matches(sin_x));
+                    CHECK(cos_x2.matches(cos_x));
                     if (a >= -1.55 && b <= 1.55)
                     {
                         auto tan_x = tan(x);
@@ -580,6 +669,96 @@ TEST_CASE("interval<>", "interval arithmetic")
                 }
             }
         }
+        SECTION("sine, cosine, tangent of large arguments")
+        {
+                // The results must enclose the values at a dense set of sample points and be tight up to the sampling error.
+            for (double a : { 1.e3, -4.e5, 1.6e6, -1.e7, 3.e10, -1.e13 })
+            {
+                for (double w : { 0., 0.1, 1., 3., 5., 6.2, 7. })
+                {
+                    double b = a + w;
+                    auto x = interval{ a, b };
+                    CAPTURE(x);
+                    auto sin_x = sin(x);
+                    auto cos_x = cos(x);
+                    long double slo = 2, shi = -2, clo = 2, chi = -2;
+                    for (int i = 0; i <= 1000; ++i)
+                    {
+                        long double t = a + (static_cast<long double>(b) - a)*i/1000;
+                        slo = std::min(slo, std::sin(t));
+                        shi = std::max(shi, std::sin(t));
+                        clo = std::min(clo, std::cos(t));
+                        chi = std::max(chi, std::cos(t));
+                    }
+                    CAPTURE(sin_x, cos_x);
+                    CHECK(sin_x.lower() <= slo + 1.e-15);
+                    CHECK(sin_x.upper() >= shi - 1.e-15);
+                    CHECK(cos_x.lower() <= clo + 1.e-15);
+                    CHECK(cos_x.upper() >= chi - 1.e-15);
+                    CHECK(sin_x.lower() == Catch::Approx(slo).margin(1.e-4));
+                    CHECK(sin_x.upper() == Catch::Approx(shi).margin(1.e-4));
+                    CHECK(cos_x.lower() == Catch::Approx(clo).margin(1.e-4));
+                    CHECK(cos_x.upper() == Catch::Approx(chi).margin(1.e-4));
+                    auto [sin_x2, cos_x2] = sincos(x);
+                    CHECK(sin_x2.matches(sin_x));
+                    CHECK(cos_x2.matches(cos_x));
+                }
+            }
+            for (double a : { 1.e22, -1.e100, 1.e300 })
+            {
+                auto x = interval{ a };
+                CAPTURE(x);
+                CHECK(sin(x).lower() == Catch::Approx(std::sin(static_cast<long double>(a))).margin(1.e-15));
+                CHECK(cos(x).upper() == Catch::Approx(std::cos(static_cast<long double>(a))).margin(1.e-15));
+                CHECK(tan(x).lower() == Catch::Approx(std::tan(static_cast<long double>(a))).epsilon(1.e-14));
+            }
+            CHECK(tan(interval{ 1.e13, 1.e13 + 3.5 }).matches(interval{ -inf, inf }));
+            CHECK(cos(interval{ 1., inf }).matches(interval{ -1., 1. }));
+            CHECK(sincos(interval{ -inf, 1. }).second.matches(interval{ -1., 1. }));
+        }
+        SECTION("sincos()")
+        {
+            auto [s, c] = intervals::sincos(1.);
+            CHECK(s == std::sin(1.));
+            CHECK(c == std::cos(1.));
+            auto [sf, cf] = sincos(interval{ 1.f, 2.f });
+            CHECK(sf.matches(sin(interval{ 1.f, 2.f })));
+            CHECK(cf.matches(cos(interval{ 1.f, 2.f })));
+            constexpr auto scx = sincos(interval{ 1., 2. });
+            static_assert(scx.first.upper() == 1.);
+            static_assert(scx.second.upper() < 0.55);
+        }
+        SECTION("degenerate arguments")
+        {
+                // Degenerate arguments are evaluated once and yield degenerate results. The trigonometric functions reduce
+                // the argument themselves, so their results may differ from the scalar functions in the last place.
+            auto near_point = [](interval<double> const& r, double v)
+            {
+                return r.lower() == r.upper() && std::abs(r.lower() - v) <= 2*std::numeric_limits<double>::epsilon()*std::abs(v);
+            };
+            for (double a : { 0., 0.5, -1., 3., 1.e6, -1.e22 })
+            {
+                auto x = interval{ a };
+                CAPTURE(x);
+                CHECK(near_point(sin(x), intervals::sin(a)));
+                CHECK(near_point(cos(x), intervals::cos(a)));
+                CHECK(near_point(tan(x), intervals::tan(a)));
+                CHECK(sincos(x).first.matches(sin(x)));
+                CHECK(pow(interval{ 1.5 }, x).matches(interval{ std::pow(1.5, a) }));
+                CHECK(pow(interval{ 1.5 }, a).matches(interval{ std::pow(1.5, a) }));
+                CHECK(atan2(x, interval{ 2. }).matches(interval{ std::atan2(a, 2.) }));
+            }
+            CHECK(sin(interval{ inf }).matches(interval{ -1., 1. }));
+            CHECK(tan(interval{ -inf }).matches(interval{ -inf, inf }));
+
+                // The degenerate path pads the result if the rounding policy asks for it.
+            using I = interval<double, intervals::libm_error_padding<intervals::error_free_rounding>>;
+            auto p = pow(I{ 1.5 }, I{ 3. });
+            CHECK(p.lower() < 3.375);
+            CHECK(p.upper() > 3.375);
+            auto s = sin(I{ 1. });
+            CHECK(s.encloses(intervals::sin(1.)));
+        }
         SECTION("arc sine, arc cosine, arc tangent")
         {
             auto ratios = std::array{ -inf, -2., -1., -std::sqrt(1./2), -0.5, -std::sqrt(1./4), 0., std::sqrt(1./4), 0.5, std::sqrt(1./2), 1., 2., inf };
@@ -0,0 +1,313 @@
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+#include <cstddef>  // for size_t
+
+#include <gsl-lite/gsl-lite.hpp>  // for fail_fast, index
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <intervals/interval.hpp>
+#include <intervals/interval_array.hpp>
+
+#include "test-fixtures.hpp"  // for bounds, same_bounds()
+
+
+namespace {
+
+namespace gsl = ::gsl_lite;
+
+
+TEST_CASE("interval_array<>", "interval arithmetic")
+{
+    using namespace intervals::math;
+    using intervals::interval;
+    using intervals::interval_array;
+    using intervals::bool_set_array;
+
+        // Form all pairs of intervals from the `bounds` table such that binary operations can be tested exhaustively.
+    auto xs = std::vector<interval<double>>{ };
+    auto ys = std::vector<interval<double>>{ };
+    for (auto [a, b] : bounds)
+    {
+        for (auto [c, d] : bounds)
+        {
+            xs.push_back(interval{ a, b });
+            ys.push_back(interval{ c, d });
+        }
+    }
+    auto xa = interval_array<double>(xs);
+    auto ya = interval_array<double>(ys);
+    auto n = std::ssize(xs);
+
+    SECTION("construction and element access")
+    {
+        auto a = interval_array<double>(3);
+        CHECK(a.size() == 3);
+        CHECK(!a[0].assigned());
+        a.reset(1, interval{ 1., 2. });
+        a.assign(1, 3.);
+        a.assign(2, interval{ -1., 0. });
+        CHECK(a[1].matches(interval{ 1., 3. }));
+        CHECK(a[2].matches(interval{ -1., 0. }));
+        a.reset(1);
+        CHECK(!a[1].assigned());
+        a.resize(4);
+        CHECK(a.size() == 4);
+        CHECK(!a[3].assigned());
+
+        auto b = interval_array<double>{ 1., interval{ 2., 3. } };
+        CHECK(b.size() == 2);
+        CHECK(b[0].matches(1.));
+        CHECK(b[1].matches(interval{ 2., 3. }));
+
+        auto c = interval_array<double>(2, interval{ -1., 1. });
+        CHECK(c.lower()[1] == -1.);
+        CHECK(c.upper()[1] == 1.);
+    }
+    SECTION("unary operators")
+    {
+        auto r = -xa;
+        auto rs = square(xa);
+        auto ra = abs(xa);
+        for (gsl::index i = 0; i != n; ++i)
+        {
+            CAPTURE(xs[i]);
+            CHECK(same_bounds(r[i], -xs[i]));
+            CHECK(same_bounds(rs[i], square(xs[i])));
+            CHECK(same_bounds(ra[i], abs(xs[i])));
+        }
+    }
+    SECTION("sqrt()")
+    {
+        auto x = interval_array<double>{ 0., interval{ 0., 1. }, interval{ 0.1, 2. }, interval{ 4., inf }, inf };
+        auto r = intervals::sqrt(x);
+        for (gsl::index i = 0; i != x.size(); ++i)
+        {
+            CAPTURE(x[i]);
+            CHECK(same_bounds(r[i], sqrt(x[i])));
+        }
+        CHECK_THROWS_AS(sqrt(interval_array<double>{ interval{ -1., 1. } }), gsl::fail_fast);
+    }
+    SECTION("elementary functions")
+    {
+            // The results enclose the exact range  [lo, hi] , computed in long double precision, and they are at most a few ulp
+            // wider. (The tolerance is absolute for the bounded functions  sin  and  cos .) Where the exact values are undefined
+            // or special, the results match those of `interval<>`.
+        auto encloses = [](interval<double> const& lhs, interval<double> const& rhs, long double lo, long double hi, double absTol)
+        {
+            auto near = [absTol](double a, long double b)
+            {
+                return a == b || std::abs(a - b) <= 8*std::numeric_limits<double>::epsilon()*std::abs(b) + absTol;
+            };
+            if (!std::isfinite(double(lo)) || !std::isfinite(double(hi)) || !(lhs.lower_unchecked() == lhs.lower_unchecked()))
+            {
+                return same_bounds(lhs, rhs) || (near(lhs.lower_unchecked(), rhs.lower_unchecked()) && near(lhs.upper_unchecked(), rhs.upper_unchecked()));
+            }
+            return lhs.lower_unchecked() <= lo && hi <= lhs.upper_unchecked()
+                && near(lhs.lower_unchecked(), lo) && near(lhs.upper_unchecked(), hi);
+        };
+        constexpr double trigTol = 8*std::numeric_limits<double>::epsilon();
+        constexpr double expTol = 2*std::numeric_limits<double>::min();
+
+        auto rng = std::mt19937_64{ 42 };
+        auto dist = std::uniform_real_distribution<double>{ -1., 1. };
+        auto zs = std::vector<interval<double>>{ };
+        for (auto [a, b] : bounds)
+        {
+            zs.push_back(interval{ a, b });
+        }
+        for (double scale : { 1., 10., 700., 1.e6, 1.e7 })
+        {
+            for (int i = 0; i != 500; ++i)
+            {
+                zs.push_back(interval<double>::from_unordered_bounds(scale*dist(rng), scale*dist(rng)));
+            }
+        }
+        auto za = interval_array<double>(zs);
+        auto rexp = exp(za);
+        auto rsin = sin(za);
+        auto rcos = cos(za);
+        auto ratan = atan(za);
+        for (gsl::index i = 0; i != za.size(); ++i)
+        {
+            auto const& z = zs[i];
+            auto lo = static_cast<long double>(z.lower_unchecked());
+            auto hi = static_cast<long double>(z.upper_unchecked());
+            CAPTURE(z);
+            CHECK(encloses(rexp[i], exp(z), std::exp(lo), std::exp(hi), expTol));
+                // `interval<>` may be a few ulp off for large arguments, but it reliably detects the extrema.
+            auto s = sin(z);
+            auto c = cos(z);
+            CHECK(encloses(rsin[i], s,
+                s.lower_unchecked() == -1 ? -1.L : std::min(std::sin(lo), std::sin(hi)),
+                s.upper_unchecked() == 1 ? 1.L : std::max(std::sin(lo), std::sin(hi)), trigTol));
+            CHECK(encloses(rcos[i], c,
+                c.lower_unchecked() == -1 ? -1.L : std::min(std::cos(lo), std::cos(hi)),
+                c.upper_unchecked() == 1 ? 1.L : std::max(std::cos(lo), std::cos(hi)), trigTol));
+            CHECK(encloses(ratan[i], atan(z), std::atan(lo), std::atan(hi), 0.));
+        }
+
+        auto ps = std::vector<interval<double>>{ };
+        for (auto const& z : zs)
+        {
+            if (!std::isnan(z.lower_unchecked()))
+            {
+                ps.push_back(abs(z));
+            }
+        }
+        auto pa = interval_array<double>(ps);
+        auto rlog = log(pa);
+        for (gsl::index i = 0; i != pa.size(); ++i)
+        {
+            auto p = pa[i];
+            CAPTURE(p);
+            CHECK(encloses(rlog[i], log(p), std::log(static_cast<long double>(p.lower())), std::log(static_cast<long double>(p.upper())), 0.));
+        }
+        CHECK_THROWS_AS(log(interval_array<double>{ interval{ -1., 1. } }), gsl::fail_fast);
+
+            // Results are outward enclosures.
+        auto e = exp(interval_array<double>{ 0., 1. })[0];
+        CHECK(e.lower() < 1.);
+        CHECK(e.upper() > 1.);
+        auto c = cos(interval_array<double>{ interval{ -1., 7. } })[0];
+        CHECK(c.matches(interval{ -1., 1. }));
+
+        auto fa = interval_array<float>{ interval{ -1.f, 2.f }, interval{ 0.5f, 80.f } };
+        auto rf = exp(fa);
+        CHECK(rf[0].lower() <= std::exp(-1.));
+        CHECK(rf[0].upper() >= std::exp(2.));
+        CHECK(rf[1].lower() <= std::exp(0.5));
+        CHECK(rf[1].upper() >= std::exp(80.));
+    }
+    SECTION("binary operators")
+    {
+        auto rsum = xa + ya;
+        auto rdiff = xa - ya;
+        auto rprod = xa*ya;
+        auto rquot = xa/ya;
+        auto rmin = min(xa, ya);
+        auto rmax = intervals::max(xa, ya);
+        for (gsl::index i = 0; i != n; ++i)
+        {
+            auto const& x = xs[i];
+            auto const& y = ys[i];
+            CAPTURE(x, y);
+            CHECK(same_bounds(rsum[i], x + y));
+            CHECK(same_bounds(rdiff[i], x - y));
+            CHECK(same_bounds(rprod[i], x*y));
+            CHECK(same_bounds(rquot[i], x/y));
+            CHECK(same_bounds(rmin[i], min(x, y)));
+            CHECK(same_bounds(rmax[i], max(x, y)));
+        }
+    }
+    SECTION("broadcast operands")
+    {
+        for (auto [c, d] : bounds)
+        {
+            auto y = interval{ c, d };
+            CAPTURE(y);
+            auto rprod = xa*y;
+            auto rquot = y/xa;
+            auto rsum = xa + c;
+            auto rdiff = c - xa;
+            auto rsprod = c*xa;
+            auto rsquot = xa/c;
+            auto rsquot2 = c/xa;
+            bool nan_scalar = c != c;
+            for (gsl::index i = 0; i != n; ++i)
+            {
+                auto const& x = xs[i];
+                CAPTURE(x);
+                CHECK(same_bounds(rprod[i], x*y));
+                CHECK(same_bounds(rquot[i], y/x));
+                CHECK(same_bounds(rsum[i], x + c));
+                CHECK(same_bounds(rdiff[i], c - x));
+                CHECK(same_bounds(rsprod[i], c*x));
+                CHECK(same_bounds(rsquot[i], x/c));
+                if (!nan_scalar)
+                {
+                        // For NaN dividends, the scalar operator yields  [-∞,∞]  whereas the interval operator yields  [NaN,NaN] .
+                    CHECK(same_bounds(rsquot2[i], c/x));
+                }
+            }
+        }
+    }
+    SECTION("comparisons")
+    {
+        auto lt = (xa < ya);
+        auto leq = (xa <= ya);
+        auto gt = (xa > ya);
+        auto geq = (xa >= ya);
+        auto eq = (xa == ya);
+        auto neq = (xa != ya);
+        REQUIRE(lt.size() == n);
+        for (gsl::index i = 0; i != n; ++i)
+        {
+            auto const& x = xs[i];
+            auto const& y = ys[i];
+            CAPTURE(x, y);
+            CHECK(lt[i].matches(x < y));
+            CHECK(leq[i].matches(x <= y));
+            CHECK(gt[i].matches(x > y));
+            CHECK(geq[i].matches(x >= y));
+            CHECK(eq[i].matches(x == y));
+            CHECK(neq[i].matches(x != y));
+        }
+        for (auto [c, d] : bounds)
+        {
+            auto y = interval{ c, d };
+            CAPTURE(y);
+            auto rlt = (xa < y);
+            auto rgeq = (y >= xa);
+            auto rseq = (xa == c);
+            auto rsgt = (c > xa);
+            for (gsl::index i = 0; i != n; ++i)
+            {
+                auto const& x = xs[i];
+                CAPTURE(x);
+                CHECK(rlt[i].matches(x < y));
+                CHECK(rgeq[i].matches(y >= x));
+                CHECK(rseq[i].matches(x == c));
+                CHECK(rsgt[i].matches(c > x));
+            }
+        }
+    }
+    SECTION("if_else()")
+    {
+        auto c = (xa < ya);
+        auto r = if_else(c, xa, ya);
+        auto rb = if_else(c, xa, 0.);
+        auto rbl = if_else(c, interval{ -1., 1. }, ya);
+        for (gsl::index i = 0; i != n; ++i)
+        {
+            auto const& x = xs[i];
+            auto const& y = ys[i];
+            CAPTURE(x, y, c[i]);
+            CHECK(same_bounds(r[i], intervals::if_else(c[i], x, y)));
+            CHECK(same_bounds(rb[i], intervals::if_else(c[i], x, 0.)));
+            CHECK(same_bounds(rbl[i], intervals::if_else(c[i], interval{ -1., 1. }, y)));
+        }
+
+            // Thresholding.
+        auto s = interval_array<double>{ interval{ 0., 1. }, interval{ 2., 3. }, interval{ 0.5, 2.5 } };
+        auto t = if_else(s > 1.5, 1.5, s);
+        CHECK(t[0].matches(interval{ 0., 1. }));
+        CHECK(t[1].matches(1.5));
+        CHECK(t[2].matches(interval{ 0.5, 2.5 }));  // `s[2] > 1.5` is contingent
+
+        CHECK_THROWS_AS(if_else(bool_set_array(2), xa, ya), gsl::fail_fast);
+    }
+    SECTION("preconditions")
+    {
+        CHECK_THROWS_AS(xa + interval_array<double>(2), gsl::fail_fast);
+        CHECK_THROWS_AS(-interval_array<double>(2), gsl::fail_fast);
+        CHECK_THROWS_AS(interval_array<double>(2) < 0., gsl::fail_fast);
+    }
+}
+
+
+} // anonymous namespace
@@ -0,0 +1,159 @@
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <numbers>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <intervals/math.hpp>
+#include <intervals/interval.hpp>
+
+
+namespace {
+
+
+constexpr double inf = std::numeric_limits<double>::infinity();
+
+    // Error of  a  relative to the reference value  b , in units of the last place of  b . The reference is computed in
+    // long double precision and is thus accurate to a fraction of an ulp of `double` on most platforms.
+double
+ulps(double a, long double b)
+{
+    if (a == b)
+    {
+        return 0;
+    }
+    double bd = double(b);
+    double ulp = std::nextafter(std::abs(bd), inf) - std::abs(bd);
+    return double(std::abs(a - b)/ulp);
+}
+
+TEST_CASE("constexpr elementary functions", "math")
+{
+    using namespace intervals::detail;
+
+        // The error bounds are checked against reference values computed in long double precision, which cannot resolve them
+        // on platforms where `long double` has no more precision than `double`.
+    if (std::numeric_limits<long double>::digits <= std::numeric_limits<double>::digits)
+    {
+        SKIP("long double is not more precise than double");
+    }
+
+    auto rng = std::mt19937_64{ 42 };
+    auto dist = std::uniform_real_distribution<double>{ -1., 1. };
+    auto logUniform = [&](double lo, double hi)
+    {
+        return std::exp(std::log(lo) + (dist(rng) + 1)/2*(std::log(hi) - std::log(lo)));
+    };
+
+    SECTION("error bounds")
+    {
+        for (int i = 0; i != 10000; ++i)
+        {
+            double x = logUniform(1.e-300, 1.e300);
+            CAPTURE(x);
+            CHECK(ulps(constexpr_sqrt(x), std::sqrt((long double) x)) <= 1);
+            CHECK(ulps(constexpr_cbrt(-x), std::cbrt(-(long double) x)) <= 1);
+            CHECK(ulps(constexpr_log(x), std::log((long double) x)) <= 2);
+
+            double e = dist(rng)*708;
+            CAPTURE(e);
+            CHECK(ulps(constexpr_exp(e), std::exp((long double) e)) <= 2);
+
+            double t = dist(rng)*(i % 3 == 0 ? 1.e6 : i % 3 == 1 ? 10. : 1.);
+            CAPTURE(t);
+            CHECK(ulps(constexpr_sin(t), std::sin((long double) t)) <= 2);
+            CHECK(ulps(constexpr_cos(t), std::cos((long double) t)) <= 2);
+            CHECK(ulps(constexpr_tan(t), std::tan((long double) t)) <= 3);
+
+                // Large arguments are reduced with the Payne–Hanek algorithm.
+            double tl = (i % 2 == 0 ? 1 : -1)*logUniform(1.e6, 1.e300);
+            CAPTURE(tl);
+            CHECK(ulps(constexpr_sin(tl), std::sin((long double) tl)) <= 2);
+            CHECK(ulps(constexpr_cos(tl), std::cos((long double) tl)) <= 2);
+            CHECK(ulps(constexpr_tan(tl), std::tan((long double) tl)) <= 3);
+
+            double a = dist(rng)*(i % 2 == 0 ? 1. : 1.e5);
+            double u = dist(rng);
+            double v = dist(rng)*10.;
+            CAPTURE(a, u, v);
+            CHECK(ulps(constexpr_atan(a), std::atan((long double) a)) <= 2);
+            CHECK(ulps(constexpr_asin(u), std::asin((long double) u)) <= 3);
+            CHECK(ulps(constexpr_acos(u), std::acos((long double) u)) <= 3);
+            CHECK(ulps(constexpr_atan2(a, v), std::atan2((long double) a, (long double) v)) <= 3);
+
+            double px = logUniform(1.e-3, 1.e3);
+            double py = dist(rng)*20.;
+            CAPTURE(px, py);
+            CHECK(ulps(constexpr_pow(px, py), std::pow((long double) px, (long double) py)) <= 2 + std::abs(py*std::log(px)));
+
+            double r = dist(rng)*1.e6;
+            double m = logUniform(1.e-3, 1.e3);
+            CAPTURE(r, m);
+            CHECK(constexpr_floor(r) == std::floor(r));
+            CHECK(constexpr_ceil(r) == std::ceil(r));
+            CHECK(constexpr_round(r) == std::round(r));
+            CHECK(constexpr_fmod(r, m) == std::fmod(r, m));
+        }
+    }
+    SECTION("argument reduction")
+    {
+            // The argument closest to a multiple of  π/2  among all `double` values, for which  x mod π/2 ≈ 2⁻⁶¹ .
+        double x = std::ldexp(6381956970095103., 797);
+        auto r = constexpr_double_word<double>{ };
+        CHECK(reduce_pio2(x, r) == 1);
+        CHECK(ulps(r.hi, 4.687165924254627611122582801963884e-19L) <= 1);
+        CHECK(ulps(constexpr_cos(x), std::cos((long double) x)) <= 2);
+
+        CHECK(reduce_pio2(-x, r) == 3);
+        CHECK(r.hi < 0);
+        CHECK(reduce_pio2(std::numeric_limits<double>::max(), r) == 2);
+        CHECK(ulps(r.hi, -0.0049619751507872732039L) <= 1);
+    }
+    SECTION("special values")
+    {
+        CHECK(constexpr_exp(-inf) == 0);
+        CHECK(constexpr_exp(inf) == inf);
+        CHECK(constexpr_exp(1000.) == inf);
+        CHECK(constexpr_log(0.) == -inf);
+        CHECK(constexpr_log(inf) == inf);
+        CHECK(std::isnan(constexpr_log(-1.)));
+        CHECK(std::isnan(constexpr_sqrt(-1.)));
+        CHECK(std::isnan(constexpr_sin(inf)));
+        CHECK(constexpr_atan(inf) == std::atan(inf));
+        CHECK(constexpr_atan2(1., 0.) == std::atan2(1., 0.));
+        CHECK(constexpr_acos(-1.) == std::acos(-1.));
+        CHECK(ulps(constexpr_pow(-2., 3.), -8.L) <= 2 + 3*std::log(2.));
+        CHECK(ulps(constexpr_pow(-2., 4.), 16.L) <= 2 + 4*std::log(2.));
+        CHECK(constexpr_pow(2., 2000.) == inf);
+        CHECK(std::signbit(constexpr_floor(-0.)));
+        CHECK(std::signbit(constexpr_round(-0.25)));
+        CHECK(constexpr_sqrt(4.f) == 2.f);
+    }
+    SECTION("constant evaluation")
+    {
+        using intervals::interval;
+
+        static_assert(intervals::sqrt(4.) == 2.);
+        static_assert(intervals::exp(0.) == 1.);
+        static_assert(intervals::log(1.) == 0.);
+        static_assert(intervals::abs(intervals::sin(std::numbers::pi/6) - 0.5) < 1.e-15);
+        static_assert(intervals::abs(intervals::atan(1.) - std::numbers::pi/4) < 1.e-15);
+        static_assert(intervals::abs(intervals::sin(1.e22) - -0.8522008497671888) < 1.e-15);
+
+        constexpr auto x = interval{ 1., 2. };
+        constexpr auto ex = intervals::exp(x);
+        static_assert(ex.lower() == intervals::exp(1.) && ex.upper() == intervals::exp(2.));
+        constexpr auto sx = intervals::sin(x);
+        static_assert(sx.upper() == 1.);
+        constexpr auto rx = intervals::sqrt(x);
+        static_assert(rx.lower() == 1.);
+        CHECK(ex.lower() == std::exp(1.));
+        CHECK(ulps(sx.lower(), std::sin(1.L)) <= 2);
+        CHECK(rx.upper() == std::sqrt(2.));
+    }
+}
+
+
+} // anonymous namespace
@@ -0,0 +1,113 @@
+
+#include <cmath>
+#include <random>
+
+#include <gsl-lite/gsl-lite.hpp>  // for fail_fast
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <intervals/interval.hpp>
+#include <intervals/rounding.hpp>
+#include <intervals/packed_interval.hpp>
+
+#include "test-fixtures.hpp"  // for bounds, same_bounds()
+
+
+namespace {
+
+namespace gsl = ::gsl_lite;
+
+
+    // Check that the operations on `packed_interval<>` agree with those on `interval<>` for random finite arguments.
+template <typename PolicyT>
+void
+check_random_operations()
+{
+    using I = intervals::interval<double, PolicyT>;
+    using P = intervals::packed_interval<PolicyT>;
+
+    auto rng = std::mt19937_64{ 42 };
+    auto mantissa = std::uniform_real_distribution<double>{ -1., 1. };
+    auto exponent = std::uniform_int_distribution<int>{ -40, 40 };
+    auto random_interval = [&]
+    {
+        return I(intervals::interval<double>::from_unordered_bounds(std::ldexp(mantissa(rng), exponent(rng)), std::ldexp(mantissa(rng), exponent(rng))));
+    };
+    for (int i = 0; i != 1000; ++i)
+    {
+        auto x = random_interval();
+        auto y = random_interval();
+        CAPTURE(x, y);
+        CHECK(same_bounds(I(P(x) + P(y)), x + y));
+        CHECK(same_bounds(I(P(x) - P(y)), x - y));
+        CHECK(same_bounds(I(P(x)*P(y)), x*y));
+        CHECK(same_bounds(I(P(x)/P(y)), x/y));
+    }
+}
+
+
+TEST_CASE("packed_interval<>", "interval arithmetic")
+{
+    using intervals::interval;
+    using intervals::packed_interval;
+
+    SECTION("construction and conversion")
+    {
+        auto x = packed_interval<>{ };
+        CHECK(!x.assigned());
+        CHECK(!interval<double>(x).assigned());
+        x.reset(interval{ 1., 2. });
+        CHECK(x.lower() == 1.);
+        CHECK(x.upper() == 2.);
+        CHECK(interval<double>(x).matches(interval{ 1., 2. }));
+        CHECK(packed_interval<>{ 3. }.matches(packed_interval<>{ 3., 3. }));
+        x.reset();
+        CHECK(!x.assigned());
+        CHECK_THROWS_AS(packed_interval<>(2., 1.), gsl::fail_fast);
+    }
+    SECTION("operators")
+    {
+            // Check all pairs of intervals from the `bounds` table, including special values.
+        for (auto [a, b] : bounds)
+        {
+            auto x = interval{ a, b };
+            auto px = packed_interval<>(x);
+            CAPTURE(x);
+            CHECK(same_bounds(interval<double>(-px), -x));
+            for (auto [c, d] : bounds)
+            {
+                auto y = interval{ c, d };
+                auto py = packed_interval<>(y);
+                CAPTURE(y);
+                CHECK(same_bounds(interval<double>(px + py), x + y));
+                CHECK(same_bounds(interval<double>(px - py), x - y));
+                CHECK(same_bounds(interval<double>(px*py), x*y));
+                CHECK(same_bounds(interval<double>(px/py), x/y));
+            }
+        }
+
+            // Mixed operands convert implicitly.
+        CHECK((packed_interval<>{ 1., 2. } + 1.).matches(packed_interval<>{ 2., 3. }));
+        CHECK((2.*packed_interval<>{ 1., 2. }).matches(packed_interval<>{ 2., 4. }));
+        CHECK((interval{ -1., 2. }/packed_interval<>{ 2., 4. }).matches(packed_interval<>{ -0.5, 1. }));
+
+        check_random_operations<intervals::no_rounding>();
+    }
+    SECTION("upward_rounding")
+    {
+        using P = packed_interval<intervals::upward_rounding>;
+        {
+            auto guard = intervals::upward_rounding_guard{ };
+
+            auto x = P{ 0.1 } + 0.2;
+            CHECK(x.lower() < x.upper());
+            CHECK(x.upper() == std::nextafter(x.lower(), 1.));
+
+            check_random_operations<intervals::upward_rounding>();
+        }
+        CHECK_THROWS_AS(P{ 0.1 } + 0.2, gsl::fail_fast);  // audit check
+    }
+}
+
+
+} // anonymous namespace
@@ -0,0 +1,73 @@
+
+#include <vector>
+#include <cstring>      // for memcpy()
+#include <concepts>     // for regular<>, same_as<>
+#include <algorithm>    // for sort()
+#include <type_traits>  // for is_trivially_copyable<>
+
+#include <gsl-lite/gsl-lite.hpp>  // for fail_fast
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <intervals/interval.hpp>
+#include <intervals/rounding.hpp>
+#include <intervals/regular_interval.hpp>
+
+
+namespace {
+
+namespace gsl = ::gsl_lite;
+
+
+TEST_CASE("regular_interval<>", "interval arithmetic")
+{
+    using intervals::interval;
+    using intervals::regular_interval;
+
+    static_assert(std::regular<regular_interval<double>>);
+    static_assert(std::regular<regular_interval<int>>);
+    static_assert(std::is_trivially_copyable_v<regular_interval<double>>);
+    static_assert(sizeof(regular_interval<double>) == 2*sizeof(double));
+
+    SECTION("construction and conversion")
+    {
+        auto x = regular_interval<double>{ };
+        CHECK(x.lower() == 0.);
+        CHECK(x.upper() == 0.);
+        x = regular_interval{ interval{ 1., 2. } };
+        static_assert(std::same_as<decltype(regular_interval{ interval{ 1., 2. } }), regular_interval<double>>);
+        CHECK(x.lower() == 1.);
+        CHECK(x.upper() == 2.);
+        CHECK(interval(x).matches(interval{ 1., 2. }));
+        static_assert(std::same_as<decltype(interval(x)), interval<double>>);
+        static_assert(std::same_as<decltype(interval(regular_interval<double, intervals::finite_only>{ })), interval<double, intervals::finite_only>>);
+        CHECK(regular_interval<int>{ 3 } == regular_interval<int>{ 3, 3 });
+        CHECK_THROWS_AS(regular_interval<double>(2., 1.), gsl::fail_fast);
+        CHECK_THROWS_AS(regular_interval<double>(interval<double>{ }), gsl::fail_fast);
+    }
+    SECTION("arithmetic")
+    {
+        auto x = regular_interval<double>{ 1., 2. };
+        auto y = regular_interval<double>{ -1., 3. };
+        x = interval(x)*interval(y);
+        CHECK(x == regular_interval<double>{ -2., 6. });
+        x = interval(x) + 1.;
+        CHECK(x == regular_interval<double>{ -1., 7. });
+    }
+    SECTION("containers")
+    {
+        auto xs = std::vector<regular_interval<int>>{
+            regular_interval{ interval{ 2, 3 } }, regular_interval<int>{ 1 }, regular_interval{ interval{ 1, 4 } }
+        };
+        std::sort(xs.begin(), xs.end());
+        CHECK(xs == std::vector<regular_interval<int>>{ regular_interval<int>{ 1 }, regular_interval<int>{ 1, 4 }, regular_interval<int>{ 2, 3 } });
+        CHECK(xs[0] < xs[1]);
+
+        auto ys = std::vector<regular_interval<int>>(xs.size());
+        std::memcpy(ys.data(), xs.data(), xs.size()*sizeof(regular_interval<int>));
+        CHECK(ys == xs);
+    }
+}
+
+
+} // anonymous namespace
@@ -0,0 +1,355 @@
+
+#include <cfenv>   // for fegetround(), FE_TONEAREST
+#include <cmath>
+#include <tuple>
+#include <random>
+#include <limits>
+#include <numbers>
+#include <algorithm>    // for min(), max()
+#include <concepts>     // for same_as<>
+#include <type_traits>  // for common_type<>
+
+#include <gsl-lite/gsl-lite.hpp>  // for fail_fast
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <intervals/interval.hpp>
+#include <intervals/rounding.hpp>
+
+
+namespace {
+
+namespace gsl = ::gsl_lite;
+
+
+    // Check that  [lo,hi]  encloses the exact value  v + e , where  v  is the rounded result of an operation and  e  is the
+    // exact rounding error as determined by an error-free transformation. The rounding error may only be given by its sign.
+bool
+encloses_exact(intervals::detail::interval_base<double> const& x, double v, double e)
+{
+    double lo = x.lower_unchecked();
+    double hi = x.upper_unchecked();
+    return lo <= v && v <= hi
+        && (!(e < 0) || lo < v)
+        && (!(e > 0) || v < hi);
+}
+
+double
+random_value(std::mt19937_64& rng)
+{
+    auto mantissa = std::uniform_real_distribution<double>{ -1., 1. };
+    auto exponent = std::uniform_int_distribution<int>{ -40, 40 };
+    return std::ldexp(mantissa(rng), exponent(rng));
+}
+
+    // Error bounds which assume a correctly rounded `exp()`.
+struct exact_exp_bounds : intervals::libm_ulp_bounds
+{
+    static constexpr int exp = 0;
+};
+
+    // Evaluate  f()  in the rounding mode required by the given policy.
+template <typename PolicyT, typename F>
+auto
+evaluate_with(F&& f)
+{
+    if constexpr (std::same_as<PolicyT, intervals::upward_rounding>)
+    {
+        auto guard = intervals::upward_rounding_guard{ };
+        return f();
+    }
+    else
+    {
+        return f();
+    }
+}
+
+    // Check enclosure of the results of the arithmetic operations for random arguments. Divisors are chosen such that they do
+    // not contain 0, and the argument of `sqrt()` is nonnegative.
+template <typename PolicyT>
+void
+check_random_enclosures()
+{
+    using namespace intervals::math;
+    using I = intervals::interval<double, PolicyT>;
+
+    auto rng = std::mt19937_64{ 42 };
+    for (int i = 0; i != 1000; ++i)
+    {
+        double a = random_value(rng);
+        double b = random_value(rng);
+        double c = random_value(rng);
+        CAPTURE(a, b, c);
+
+            // Compute the results of the interval operations first because reference values must be computed with
+            // round-to-nearest.
+        auto x = I(intervals::interval<double>::from_unordered_bounds(a, b));
+        auto y = I(intervals::interval<double>::from_unordered_bounds(b, 2*b));
+        auto [sum, diff, msum, mdiff, prod, mprod, quot, mquot, sq, root, xy, xdy, fprod, xyb] = evaluate_with<PolicyT>([&]
+        {
+            return std::tuple{
+                I{ a } + I{ b }, I{ a } - I{ b }, I{ a } + b, a - I{ b },
+                I{ a }*I{ b }, I{ a }*b, I{ a }/I{ b }, a/I{ b },
+                square(I{ a }), sqrt(I{ std::abs(a) }),
+                x*y, x/y,
+                fma(I{ a }, b, I{ c }), fma(x, y, b)
+            };
+        });
+
+            // Exact errors of sum and difference, computed with TwoSum.
+        double s = a + b;
+        double d = a - b;
+        double es = intervals::detail::two_sum_error(a, b, s);
+        double ed = intervals::detail::two_sum_error(a, -b, d);
+        CHECK(encloses_exact(sum, s, es));
+        CHECK(encloses_exact(diff, d, ed));
+        CHECK(encloses_exact(msum, s, es));
+        CHECK(encloses_exact(mdiff, d, ed));
+
+            // Exact errors of product and quotient, computed with FMA. The arguments are far from underflow.
+        double p = a*b;
+        double ep = std::fma(a, b, -p);
+        double q = a/b;
+        double rq = std::fma(-q, b, a);  // the error  rq/b  has the sign of  rq⋅b
+        CHECK(encloses_exact(prod, p, ep));
+        CHECK(encloses_exact(mprod, p, ep));
+        CHECK(encloses_exact(quot, q, rq*b));
+        CHECK(encloses_exact(mquot, q, rq*b));
+        CHECK(fprod.contains(std::fma(a, b, c)));
+
+        double a2 = a*a;
+        double ea2 = std::fma(a, a, -a2);
+        CHECK(encloses_exact(sq, a2, ea2));
+
+        double r = std::sqrt(std::abs(a));
+        double er = std::fma(-r, r, std::abs(a));  // the error has the sign of  |a| - r²
+        CHECK(encloses_exact(root, r, er));
+
+            // Operations on non-degenerate intervals enclose the operations on their bounds.
+        CHECK(xy.lower() <= std::min({ a*b, a*(2*b), b*b, b*(2*b) }));
+        CHECK(xy.upper() >= std::max({ a*b, a*(2*b), b*b, b*(2*b) }));
+        CHECK(xdy.lower() <= std::min({ a/b, a/(2*b), b/b, b/(2*b) }));
+        CHECK(xdy.upper() >= std::max({ a/b, a/(2*b), b/b, b/(2*b) }));
+        CHECK(xyb.lower() <= std::min({ std::fma(a, b, b), std::fma(a, 2*b, b), std::fma(b, b, b), std::fma(b, 2*b, b) }));
+        CHECK(xyb.upper() >= std::max({ std::fma(a, b, b), std::fma(a, 2*b, b), std::fma(b, b, b), std::fma(b, 2*b, b) }));
+    }
+}
+
+
+TEST_CASE("rounding policies", "interval arithmetic")
+{
+    using namespace intervals::math;
+    using intervals::interval;
+    using intervals::no_rounding;
+    using intervals::nextafter_rounding;
+    using intervals::error_free_rounding;
+    using intervals::upward_rounding;
+
+    SECTION("policy propagation")
+    {
+        using I = interval<double, error_free_rounding>;
+        auto x = I{ 1., 2. };
+        static_assert(std::same_as<decltype(x + 1.), I>);
+        static_assert(std::same_as<decltype(1.*x), I>);
+        static_assert(std::same_as<decltype(x/x), I>);
+        static_assert(std::same_as<decltype(sqrt(x)), I>);
+        static_assert(std::same_as<decltype(min(x, 1.)), I>);
+        static_assert(std::same_as<std::common_type_t<I, double>, I>);
+        static_assert(std::same_as<decltype(interval{ x }), I>);
+        static_assert(std::same_as<interval<double>, interval<double, no_rounding>>);
+        static_assert(std::same_as<decltype(interval{ 1. } + 1.), interval<double>>);
+
+            // Intervals convert between policies.
+        auto y = interval<double>(x);
+        CHECK(y.matches(interval{ 1., 2. }));
+    }
+    SECTION("no_rounding")
+    {
+        auto x = interval{ 0.1 } + interval{ 0.2 };
+        CHECK(x.matches(0.1 + 0.2));
+    }
+    SECTION("nextafter_rounding")
+    {
+        using I = interval<double, nextafter_rounding>;
+
+            // Every rounded bound is widened, even if the operation is exact.
+        auto x = I{ 1., 2. } + 1.;
+        CHECK(x.lower() < 2.);
+        CHECK(x.upper() > 3.);
+        CHECK(x.lower() == std::nextafter(2., 0.));
+        CHECK(x.upper() == std::nextafter(3., 4.));
+
+            // Operations which are exact because of a zero operand are not widened.
+        CHECK((I{ 0., 1. }*I{ 0., 1. }).lower() == 0.);
+        CHECK((I{ 0., 1. } + 0.).matches(interval{ 0., 1. }));
+        CHECK(sqrt(I{ 0., 4. }).lower() == 0.);
+
+        check_random_enclosures<nextafter_rounding>();
+    }
+    SECTION("error_free_rounding")
+    {
+        using I = interval<double, error_free_rounding>;
+
+            // Exact operations are not widened.
+        CHECK((I{ 1., 2. } + 1.).matches(interval{ 2., 3. }));
+        CHECK((I{ 1., 2. }*I{ -3., 4. }).matches(interval{ -6., 8. }));
+        CHECK((I{ 1., 2. }/4.).matches(interval{ 0.25, 0.5 }));
+        CHECK(sqrt(I{ 4., 9. }).matches(interval{ 2., 3. }));
+
+            // Inexact operations are widened outward only.
+        auto x = I{ 0.1 } + 0.2;
+        CHECK(x.lower() < x.upper());
+        CHECK(x.upper() == std::nextafter(x.lower(), 1.));
+        auto r = sqrt(I{ 2. });
+        CHECK(r.lower() < r.upper());
+        CHECK(r.upper() == std::nextafter(r.lower(), 2.));
+
+            // Overflow yields an enclosure of the exact, finite result.
+        constexpr double max = std::numeric_limits<double>::max();
+        auto y = I{ max }*2.;
+        CHECK(y.lower() == max);
+        CHECK(y.upper() == std::numeric_limits<double>::infinity());
+
+        check_random_enclosures<error_free_rounding>();
+    }
+    SECTION("upward_rounding")
+    {
+        using I = interval<double, upward_rounding>;
+
+        auto [x, y, f, fr] = evaluate_with<upward_rounding>([]
+        {
+            return std::tuple{ I{ 0.1 } + 0.2, I{ 1., 2. }*I{ -3., 4. }, fma(I{ 0.1 }, I{ -0.3, 0.7 }, 0.2), I{ 0.1 }*I{ -0.3, 0.7 } + 0.2 };
+        });
+        CHECK(x.lower() < x.upper());
+        CHECK(x.upper() == std::nextafter(x.lower(), 1.));
+        CHECK(y.matches(interval{ -6., 8. }));
+        CHECK(fr.contains(f));  // rounded only once
+        CHECK(std::fegetround() == FE_TONEAREST);
+
+        check_random_enclosures<upward_rounding>();
+        CHECK_THROWS_AS(I{ 0.1 } + 0.2, gsl::fail_fast);  // audit check
+    }
+    SECTION("finite_only")
+    {
+        using intervals::finite_only;
+        using intervals::finite_only_policy;
+        using I = interval<double, finite_only>;
+        constexpr double inf = std::numeric_limits<double>::infinity();
+        constexpr double max = std::numeric_limits<double>::max();
+
+        static_assert(std::same_as<decltype(I{ 1. }*2.), I>);
+        static_assert(std::same_as<decltype(interval<double, finite_only_policy<error_free_rounding>>{ 1. } + 1.), interval<double, finite_only_policy<error_free_rounding>>>);
+
+            // Results agree with those of the default policy.
+        auto rng = std::mt19937_64{ 42 };
+        for (int i = 0; i != 1000; ++i)
+        {
+            double a = random_value(rng);
+            double b = random_value(rng);
+            double c = random_value(rng);
+            double d = random_value(rng);
+            CAPTURE(a, b, c, d);
+            auto x = interval<double>::from_unordered_bounds(a, b);
+            auto y = interval<double>::from_unordered_bounds(c, d);
+            auto fx = I(x);
+            auto fy = I(y);
+            CHECK((fx + fy).matches(x + y));
+            CHECK((fx - fy).matches(x - y));
+            CHECK((fx*fy).matches(x*y));
+            CHECK((fx*c).matches(x*c));
+            if (!y.contains(0))
+            {
+                CHECK((fx/fy).matches(x/y));
+                CHECK((a/fy).matches(a/y));
+            }
+            if (c != 0)
+            {
+                CHECK((fx/c).matches(x/c));
+            }
+        }
+
+            // Infinite bounds violate the precondition, including those that arise from overflow or division by 0.
+        CHECK_THROWS_AS(I{ inf }, gsl::fail_fast);
+        CHECK_THROWS_AS(I(interval{ 0., inf }), gsl::fail_fast);
+        CHECK_THROWS_AS(I{ 0. }.reset(std::numeric_limits<double>::quiet_NaN()), gsl::fail_fast);
+        CHECK_THROWS_AS(I{ max }*2., gsl::fail_fast);
+        CHECK_THROWS_AS(1./I(-1., 1.), gsl::fail_fast);
+        CHECK(!I{ }.assigned());
+    }
+    SECTION("libm_error_padding")
+    {
+        using intervals::libm_ulp_bounds;
+        using intervals::libm_error_padding;
+        using I = interval<double, libm_error_padding<error_free_rounding>>;
+        constexpr double inf = std::numeric_limits<double>::infinity();
+
+        static_assert(std::same_as<decltype(exp(I{ 1. })), I>);
+        static_assert(std::same_as<decltype(atan2(I{ 1. }, 2.)), I>);
+
+            // Padded bounds enclose the results computed in extended precision and stay within a few ulp of them.
+        auto encloses = [](I const& x, long double v)
+        {
+            return x.lower() <= v && v <= x.upper()
+                && x.lower() >= double(v) - 8*std::abs(double(v))*std::numeric_limits<double>::epsilon() - 1.e-300
+                && x.upper() <= double(v) + 8*std::abs(double(v))*std::numeric_limits<double>::epsilon() + 1.e-300;
+        };
+        auto rng = std::mt19937_64{ 42 };
+        auto dist = std::uniform_real_distribution<double>{ -20., 20. };
+        for (int i = 0; i != 1000; ++i)
+        {
+            double a = dist(rng);
+            double u = std::abs(a)/20.;
+            CAPTURE(a);
+            CHECK(encloses(exp(I{ a }), std::exp((long double) a)));
+            CHECK(encloses(log(I{ std::abs(a) }), std::log((long double) std::abs(a))));
+            CHECK(encloses(cbrt(I{ a }), std::cbrt((long double) a)));
+            CHECK(encloses(sin(I{ a }), std::sin((long double) a)));
+            CHECK(encloses(cos(I{ a }), std::cos((long double) a)));
+            CHECK(encloses(tan(I{ a }), std::tan((long double) a)));
+            CHECK(encloses(asin(I{ u }), std::asin((long double) u)));
+            CHECK(encloses(acos(I{ u }), std::acos((long double) u)));
+            CHECK(encloses(atan(I{ a }), std::atan((long double) a)));
+            double b = 1. + u;
+            CHECK(encloses(atan2(I{ a }, I{ b }), std::atan2((long double) a, (long double) b)));
+            CHECK(encloses(pow(I{ b }, I{ a }), std::pow((long double) b, (long double) a)));
+            CHECK(pow(I{ b, b + 1 }, I{ a }).contains(pow(I{ b }, I{ a })));
+        }
+
+            // Results without rounding error are padded as well, but they remain within the range of the function.
+        auto e = exp(I{ 0. });
+        CHECK(e.lower() < 1.);
+        CHECK(e.upper() > 1.);
+        CHECK(exp(I{ -inf, -1000. }).lower() == 0.);
+        CHECK(exp(I{ 1000. }).matches(interval{ std::numeric_limits<double>::max(), inf }));
+        CHECK(sin(I{ 1.5707963267948966 }).upper() == 1.);
+        CHECK(cos(I{ 3.141592653589793 }).lower() == -1.);
+        CHECK(log(I{ 0., 1. }).lower() == -inf);
+
+            // The inverse trigonometric functions are clamped at the endpoints of their range.
+        constexpr long double pi = std::numbers::pi_v<long double>;
+        constexpr double piUp = intervals::detail::pi_up<double>;
+        CHECK(acos(I{ 1. }).lower() == 0.);
+        CHECK(sqrt(acos(I{ 1. })).lower() == 0.);
+        CHECK(acos(I{ -1. }).upper() >= pi);
+        CHECK(acos(I{ -1. }).upper() <= piUp);
+        CHECK(asin(I{ 1. }).upper() >= pi/2);
+        CHECK(asin(I{ 1. }).upper() <= piUp/2);
+        CHECK(asin(I{ -1. }).lower() >= -piUp/2);
+        CHECK(atan(I{ -inf, inf }).lower() >= -piUp/2);
+        CHECK(atan(I{ -inf, inf }).upper() <= piUp/2);
+        CHECK(atan(I{ inf }).upper() >= pi/2);
+        CHECK(atan2(I{ 1.e-300 }, I{ -1. }).upper() >= pi);
+        CHECK(atan2(I{ 1.e-300 }, I{ -1. }).upper() <= piUp);
+        CHECK(atan2(I{ -1.e-300 }, I{ -1. }).lower() >= -piUp);
+
+            // Error bounds can be configured.
+        CHECK(exp(interval<double, libm_error_padding<no_rounding, exact_exp_bounds>>{ 0. }).matches(interval{ 1. }));
+
+            // During constant evaluation, the error bounds of the `constexpr` implementations are used.
+        static_assert(exp(I{ 1. }).contains(2.718281828459045));
+        static_assert(exp(I{ 1. }).lower() < 2.718281828459045);
+    }
+}
+
+
+} // anonymous namespace
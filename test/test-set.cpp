@@ -1,6 +1,8 @@
 
 #include <array>
+#include <cstdint>      // for uint64_t
 #include <functional>
+#include <type_traits>  // for is_trivially_copyable<>
 #include <initializer_list>
 
 #include <gsl-lite/gsl-lite.hpp>  // for fail_fast, type_identity<>
@@ -10,6 +12,8 @@
 
 #include <intervals/set.hpp>
 
+#include "test-enums.hpp"  // for Wide
+
 
 namespace {
 
@@ -23,6 +27,14 @@ reflect(gsl::type_identity<Color>)
     return std::array{ red, green, blue };
 }
 
+    // Enumeration whose values are too far apart for a direct-index table.
+enum Sparse : long long { s0 = -1000000, s1 = 7, s2 = 1 << 20, s3 = 1ll << 40 };
+consteval auto
+reflect(gsl::type_identity<Sparse>)
+{
+    return std::array{ s2, s0, s3, s1 };
+}
+
 
 template <typename F>
 intervals::set<bool>
@@ -179,6 +191,128 @@ TEST_CASE("set<>", "algebra with bounds")
             CHECK(svalue.value() == value);
         }
     }
+    SECTION("storage")
+    {
+        static_assert(sizeof(set<bool>) == 1);
+        static_assert(sizeof(set<Color>) == 1);
+        static_assert(std::is_trivially_copyable_v<set<bool>>);
+        static_assert(std::is_trivially_copyable_v<set<Color>>);
+
+        CHECK(set{ red, blue }.to_bits() == 0b101u);
+        CHECK(set<Color>::from_bits(0b110u).matches(set{ green, blue }));
+        CHECK(set<Color>::from_bits(0b11111000u).to_bits() == 0);
+        CHECK(set<Color>::from_bits(0b11111010u).value() == green);
+
+        auto w = set{ Wide(0), Wide(63), Wide(64), Wide(69) };
+        CHECK(w.contains(Wide(64)));
+        CHECK_FALSE(w.contains(Wide(65)));
+        CHECK(set{ Wide(69) }.value() == Wide(69));
+        CHECK_THROWS_AS(w.value(), gsl::fail_fast);
+        CHECK((w == Wide(63)).matches(set{ false, true }));
+        CHECK((w == set{ Wide(1), Wide(68) }).matches(false));
+
+        static_assert(sizeof(set<Wide>) == 16);
+        static_assert(std::is_trivially_copyable_v<set<Wide>>);
+        CHECK(w.to_words() == std::array<std::uint64_t, 2>{ 1 | (1ull << 63), 0b100001u });
+        CHECK(set<Wide>::from_words({ 1u, ~0ull }).matches(set{ Wide(0), Wide(64), Wide(65), Wide(66), Wide(67), Wide(68), Wide(69) }));
+        CHECK(set{ Wide(0), Wide(63) }.to_bits() == (1 | (1ull << 63)));
+        CHECK_THROWS_AS(w.to_bits(), gsl::fail_fast);
+        CHECK(set<Wide>::from_bits(0b110u).matches(set{ Wide(1), Wide(2) }));
+    }
+    SECTION("value lookup")
+    {
+            // Contiguous values.
+        CHECK(set{ true }.to_bits() == 0b10u);
+        CHECK(set{ Wide(5) }.to_bits() == 1ull << 5);
+
+            // Values in a small range, but not contiguous.
+        CHECK(set{ green }.to_bits() == 0b010u);
+        CHECK(set{ blue }.to_bits() == 0b100u);
+        CHECK_THROWS_AS(set{ Color(3) }, gsl::fail_fast);
+        CHECK_THROWS_AS(set{ Color(0) }, gsl::fail_fast);
+        CHECK_THROWS_AS(set{ Color(8) }, gsl::fail_fast);
+
+            // Values spread over a large range.
+        CHECK(set{ s0 }.to_bits() == 0b0010u);
+        CHECK(set{ s1 }.to_bits() == 0b1000u);
+        CHECK(set{ s2, s3 }.to_bits() == 0b0101u);
+        CHECK(set{ s0, s1 }.contains(s1));
+        CHECK_FALSE(set{ s0, s1 }.contains(s3));
+        CHECK_THROWS_AS(set{ Sparse(8) }, gsl::fail_fast);
+        CHECK_THROWS_AS(set{ Sparse(-1) }, gsl::fail_fast);
+    }
+    SECTION("lift()")
+    {
+        using intervals::lift;
+
+            // Small argument sets are looked up in a table of all argument combinations.
+        auto rotate = [](Color c) { return c == red ? green : c == green ? blue : red; };
+        CHECK_FALSE(lift(rotate, set<Color>{ }).assigned());
+        CHECK(lift(rotate, set{ red }).matches(green));
+        CHECK(lift(rotate, set{ red, blue }).matches(set{ green, red }));
+        CHECK(lift([](Color) { return true; }, set{ red, blue }).matches(true));
+
+        auto same = [](Color a, Color b) { return a == b; };
+        for (unsigned x = 0; x != 8; ++x)
+        {
+            for (unsigned y = 0; y != 8; ++y)
+            {
+                auto sx = set<Color>::from_bits(x);
+                auto sy = set<Color>::from_bits(y);
+                auto expected = set<bool>{ };
+                if (sx.assigned() && sy.assigned())
+                {
+                    expected.reset(sx == sy);
+                }
+                CHECK(lift(same, sx, sy).matches(expected));
+            }
+        }
+
+            // `set<sign>` arithmetic is implemented with `lift()`.
+        using intervals::sign;
+        for (unsigned x = 1; x != 8; ++x)
+        {
+            auto sx = set<sign>::from_bits(x);
+            auto expected = set<sign>{ };
+            for (sign a : set<sign>::values)
+            {
+                if (sx.contains(a))
+                {
+                    expected.assign(-a);
+                }
+            }
+            CHECK((-sx).matches(expected));
+            for (unsigned y = 1; y != 8; ++y)
+            {
+                auto sy = set<sign>::from_bits(y);
+                expected.reset();
+                for (sign a : set<sign>::values)
+                {
+                    for (sign b : set<sign>::values)
+                    {
+                        if (sx.contains(a) && sy.contains(b))
+                        {
+                            expected.assign(a*b);
+                        }
+                    }
+                }
+                CHECK((sx*sy).matches(expected));
+            }
+        }
+
+            // The product with an empty set is empty, even if the other operand contains `zero_sign`.
+        CHECK_FALSE((set{ intervals::zero_sign }*set<sign>{ }).assigned());
+        CHECK_FALSE((set<sign>{ }*set{ intervals::zero_sign }).assigned());
+        CHECK_FALSE((-set<sign>{ }).assigned());
+
+            // Larger argument sets combine the images of the individual values.
+        auto next = [](Wide w) { return Wide((int(w) + 1) % 70); };
+        CHECK(lift(next, set{ Wide(0), Wide(63), Wide(69) }).matches(set{ Wide(1), Wide(64), Wide(0) }));
+        auto pick = [](Color c, Wide w) { return c == red ? w : Wide(0); };
+        CHECK(lift(pick, set{ red }, set{ Wide(65), Wide(66) }).matches(set{ Wide(65), Wide(66) }));
+        CHECK(lift(pick, set{ red, green }, set{ Wide(65) }).matches(set{ Wide(0), Wide(65) }));
+        CHECK_FALSE(lift(pick, set<Color>{ }, set{ Wide(65) }).assigned());
+    }
     SECTION("negation")
     {
             // !
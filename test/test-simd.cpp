@@ -0,0 +1,325 @@
+
+#include <array>
+#include <limits>
+#include <random>
+#include <vector>
+#include <type_traits>  // for is_convertible<>
+
+#include <gsl-lite/gsl-lite.hpp>  // for fail_fast
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <intervals/set.hpp>
+#include <intervals/interval.hpp>
+#include <intervals/rounding.hpp>
+#include <intervals/interval_array.hpp>
+#include <intervals/simd.hpp>
+
+#include "test-fixtures.hpp"  // for bounds, same_bounds(), max3()
+
+
+namespace {
+
+namespace gsl = ::gsl_lite;
+
+
+    // Clamp  x  to  [lo,hi]  with nested branches. Every value assigned in a branch is constrained by the branch condition, as
+    // is required for masked execution on SIMD lanes.
+template <typename T>
+T
+clamp(T x, T lo, T hi)
+{
+    using namespace intervals::math;
+    using namespace intervals::logic;
+    auto result = T{ };
+    auto below = (x < lo);
+    if (possibly(below))
+    {
+        assign_partial(result, constrain(lo, below));
+    }
+    if (possibly_not(below))
+    {
+        auto xb = constrain(x, !below);
+        auto above = (xb > hi);
+        if (possibly(above))
+        {
+            assign_partial(result, constrain(hi, above));
+        }
+        if (possibly_not(above))
+        {
+            assign_partial(result, constrain(xb, !above));
+        }
+    }
+    return result;
+}
+
+
+TEST_CASE("simd<>")
+{
+    using intervals::simd;
+    using intervals::simd_mask;
+
+    auto x = simd<double, 4>({ 1., -2., 3., 0. });
+    auto y = simd<double, 4>(2.);
+    auto s = x*y + 1.;
+    CHECK(s[0] == 3.);
+    CHECK(s[1] == -3.);
+    CHECK(s[3] == 1.);
+    CHECK(((x < y) == simd_mask<4>({ true, true, false, true })));
+    CHECK(any_of(x > y));
+    CHECK(!all_of(x > y));
+    CHECK(none_of(x > 3.));
+    CHECK(all_of(abs(x) >= 0.));
+    auto z = if_else(x < 0., -x, x);
+    CHECK(z[1] == 2.);
+    CHECK(max(x, y)[2] == 3.);
+}
+
+TEST_CASE("simd_bool_set<>")
+{
+    using namespace intervals::logic;
+    using intervals::set;
+    using intervals::simd_mask;
+    using intervals::simd_bool_set;
+
+    auto a = simd_bool_set<4>(simd_mask<4>({ true, true, false, true }), simd_mask<4>({ false, true, true, false }));
+    CHECK(a[0].matches(set{ true }));
+    CHECK(a[1].matches(set{ false, true }));
+    CHECK(a[2].matches(set{ false }));
+    CHECK(!a[3].matches(set{ false }));
+    CHECK(possibly(a));
+    CHECK(possibly_not(a));
+    CHECK(!always(a));
+    CHECK(!never(a));
+    CHECK(contingent(a));
+    CHECK(!vacuous(a));
+    CHECK(always(simd_bool_set<4>(true)));
+    CHECK(never(simd_bool_set<4>(set{ false })));
+    CHECK(vacuous(simd_bool_set<4>{ }));
+
+        // The logical operators agree with those of `set<bool>` in every lane.
+    auto b = simd_bool_set<4>(simd_mask<4>({ false, true, true, true }), simd_mask<4>({ true, true, false, true }));
+    auto na = !a;
+    auto ab = a & b;
+    auto aob = a | b;
+    for (int i = 0; i != 3; ++i)
+    {
+        CAPTURE(i);
+        CHECK(na[i].matches(!a[i]));
+        CHECK(ab[i].matches(a[i] & b[i]));
+        CHECK(aob[i].matches(a[i] | b[i]));
+    }
+}
+
+template <typename X, typename Y>
+concept addable = requires(X const& x, Y const& y) { x + y; };
+
+
+TEST_CASE("interval<simd<>>")
+{
+    using namespace intervals::math;
+    using intervals::simd;
+    using intervals::interval;
+    using intervals::interval_array;
+
+    using I = interval<simd<double, 4>>;
+
+        // Form all pairs of intervals from the `bounds` table and distribute them over the lanes, repeating the first pair to
+        // fill the last vector.
+    auto xs = std::vector<interval<double>>{ };
+    auto ys = std::vector<interval<double>>{ };
+    for (auto [a, b] : bounds)
+    {
+        for (auto [c, d] : bounds)
+        {
+            xs.push_back(interval{ a, b });
+            ys.push_back(interval{ c, d });
+        }
+    }
+    while (xs.size() % 4 != 0)
+    {
+        xs.push_back(xs.front());
+        ys.push_back(ys.front());
+    }
+    auto lanes = [](std::vector<interval<double>> const& v, std::size_t i)
+    {
+        return I(std::array{ v[i], v[i + 1], v[i + 2], v[i + 3] });
+    };
+
+    SECTION("construction and lane access")
+    {
+        auto u = I{ };
+        CHECK(!u.assigned());
+        CHECK(!u[2].assigned());
+        auto v = I{ 2. };
+        CHECK(v.assigned());
+        CHECK(v[3].matches(2.));
+        auto w = I(interval{ 1., 2. });
+        CHECK(w[0].matches(interval{ 1., 2. }));
+        auto x = I(simd<double, 4>({ 0., 1., 2., 3. }), simd<double, 4>({ 1., 1., 4., 3. }));
+        CHECK(x[2].matches(interval{ 2., 4. }));
+        CHECK_THROWS_AS(I(simd<double, 4>(1.), simd<double, 4>({ 2., 0., 2., 2. })), gsl::fail_fast);
+        auto y = interval{ simd<double, 4>(1.) };
+        CHECK(y.matches(I{ 1. }));
+
+            // Scalar intervals are broadcast only if they have the same rounding policy.
+        using J = interval<double, intervals::error_free_rounding>;
+        static_assert(std::is_convertible_v<interval<double>, I>);
+        static_assert(!std::is_convertible_v<J, I>);
+        static_assert(addable<I, interval<double>>);
+        static_assert(!addable<I, J>);
+        static_assert(!addable<J, I>);
+    }
+    SECTION("arithmetic")
+    {
+        for (std::size_t i = 0; i + 4 <= xs.size(); i += 4)
+        {
+            auto x = lanes(xs, i);
+            auto y = lanes(ys, i);
+            auto rn = -x;
+            auto ra = x + y;
+            auto rs = x - y;
+            auto rm = x*y;
+            auto rd = x/y;
+            auto rmin = min(x, y);
+            auto rsq = square(x);
+            auto rabs = abs(x);
+            for (int j = 0; j != 4; ++j)
+            {
+                CAPTURE(xs[i + j], ys[i + j]);
+                CHECK(same_bounds(rn[j], -xs[i + j]));
+                CHECK(same_bounds(ra[j], xs[i + j] + ys[i + j]));
+                CHECK(same_bounds(rs[j], xs[i + j] - ys[i + j]));
+                CHECK(same_bounds(rm[j], xs[i + j]*ys[i + j]));
+                CHECK(same_bounds(rd[j], xs[i + j]/ys[i + j]));
+                CHECK(same_bounds(rmin[j], min(xs[i + j], ys[i + j])));
+                CHECK(same_bounds(rsq[j], square(xs[i + j])));
+                CHECK(same_bounds(rabs[j], abs(xs[i + j])));
+            }
+        }
+
+            // Scalars and intervals are broadcast.
+        auto x = I(std::array{ interval{ 1., 2. }, interval{ -1., 1. }, interval{ 0. }, interval{ 3., 4. } });
+        auto r = 2.*x - interval{ 0., 1. };
+        CHECK(r[0].matches(interval{ 1., 4. }));
+        CHECK(r[1].matches(interval{ -3., 2. }));
+        CHECK(r[2].matches(interval{ -1., 0. }));
+    }
+    SECTION("elementary functions")
+    {
+            // The kernels of `interval_array<>` are used.
+        auto zs = std::vector<interval<double>>{ interval{ -1., 1. }, interval{ 0.5, 3. }, interval{ 10., 12. }, interval{ -1.e7, -0.5e7 } };
+        auto z = I(std::array{ zs[0], zs[1], zs[2], zs[3] });
+        auto za = interval_array<double>(zs);
+        auto rexp = exp(z);
+        auto rsin = sin(z);
+        auto rcos = cos(z);
+        auto ratan = atan(z);
+        auto aexp = exp(za);
+        auto asin = sin(za);
+        auto acos = cos(za);
+        auto aatan = atan(za);
+        for (int j = 0; j != 4; ++j)
+        {
+            CHECK(same_bounds(rexp[j], aexp[j]));
+            CHECK(same_bounds(rsin[j], asin[j]));
+            CHECK(same_bounds(rcos[j], acos[j]));
+            CHECK(same_bounds(ratan[j], aatan[j]));
+        }
+        CHECK(same_bounds(sqrt(abs(z))[1], sqrt(zs[1])));
+        CHECK(same_bounds(log(abs(z))[2], log(abs(za))[2]));
+        CHECK_THROWS_AS(sqrt(z), gsl::fail_fast);
+    }
+    SECTION("comparisons")
+    {
+        for (std::size_t i = 0; i + 4 <= xs.size(); i += 4)
+        {
+            auto x = lanes(xs, i);
+            auto y = lanes(ys, i);
+            auto lt = (x < y);
+            auto leq = (x <= y);
+            auto gt = (x > y);
+            auto eq = (x == y);
+            auto neq = (x != y);
+            for (int j = 0; j != 4; ++j)
+            {
+                auto const& xj = xs[i + j];
+                auto const& yj = ys[i + j];
+                CAPTURE(xj, yj);
+                CHECK(lt[j].matches(xj < yj));
+                CHECK(leq[j].matches(xj <= yj));
+                CHECK(gt[j].matches(xj > yj));
+                CHECK(eq[j].matches(xj == yj));
+                CHECK(neq[j].matches(xj != yj));
+                if (lt[j].assigned())  // comparisons involving NaN yield the empty set
+                {
+                    CHECK((!lt)[j].matches(!(xj < yj)));
+                }
+            }
+        }
+
+            // Unassigned lanes are ignored.
+        auto u = I(std::array{ interval{ 1., 2. }, interval<double>{ }, interval{ 1., 2. }, interval{ 1., 2. } });
+        auto c = (u < 3.);
+        CHECK(c[1].matches(intervals::set<bool>{ }));
+        CHECK(intervals::always(c));
+    }
+    SECTION("masked execution")
+    {
+        using namespace intervals::logic;
+
+        auto rng = std::mt19937_64{ 42 };
+        auto dist = std::uniform_real_distribution<double>{ -1., 1. };
+        auto random_interval = [&]
+        {
+            return dist(rng) < -0.5
+                ? interval{ dist(rng) }  // include degenerate intervals
+                : interval<double>::from_unordered_bounds(dist(rng), dist(rng));
+        };
+        for (int k = 0; k != 200; ++k)
+        {
+            auto as = std::array{ random_interval(), random_interval(), random_interval(), random_interval() };
+            auto bs = std::array{ random_interval(), random_interval(), random_interval(), random_interval() };
+            auto r = max3(I(as), I(bs));
+            auto rc = clamp(I(as), I(bs), I(1.));
+            for (int j = 0; j != 4; ++j)
+            {
+                CAPTURE(as[j], bs[j]);
+                CHECK(same_bounds(r[j], max3(as[j], bs[j])));
+                if (bs[j].upper() <= 1.)
+                {
+                    CHECK(same_bounds(rc[j], clamp(as[j], bs[j], interval{ 1. })));
+                }
+            }
+        }
+
+            // Lanes for which the condition cannot hold are unassigned, and they remain unassigned in arithmetic operations.
+        auto x = I(std::array{ interval{ 0., 1. }, interval{ 2., 3. }, interval{ -1., 4. }, interval{ 5. } });
+        auto c = (x < 2.);
+        auto xc = constrain(x, c);
+        CHECK(xc[0].matches(interval{ 0., 1. }));
+        CHECK(!xc[1].assigned());
+        CHECK(xc[2].matches(interval{ -1., 2. }));
+        CHECK(!xc[3].assigned());
+        auto y = xc*xc - 1.;
+        CHECK(!y[1].assigned());
+        CHECK(y[2].matches(interval{ -3., 3. }));
+        auto z = I{ 10. };
+        assign_partial(z, y);
+        CHECK(z[1].matches(10.));
+        CHECK(z[2].matches(interval{ -3., 10. }));
+
+        auto s = if_else(x <= 1., I{ 0. }, x);
+        CHECK(s[0].matches(0.));
+        CHECK(s[1].matches(interval{ 2., 3. }));
+        CHECK(s[2].matches(interval{ -1., 4. }));
+        CHECK(s[3].matches(5.));
+
+            // A condition must refer to the interval being constrained.
+        auto w = I{ 1. };
+        CHECK_THROWS_AS(constrain(w, c), gsl::fail_fast);
+    }
+}
+
+
+} // anonymous namespace